@@ -0,0 +1,75 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/art_tree.h"
+#include "include/binary_search_tree.h"
+#include "include/c_hash_map.h"
+
+// Usage: example_art_performance [keys] [lookups]
+// Dense id lookups: adaptive radix tree vs pooled BST vs hash map.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int lookups = (argc > 2) ? atoi(argv[2]) : 5000000;
+
+    // Dense ids inserted in random order so the BST stays shallow
+    int *ids = malloc(sizeof(int) * n);
+    int *probes = malloc(sizeof(int) * lookups);
+    if (ids == NULL || probes == NULL) return 1;
+    for (int i = 0; i < n; i++) ids[i] = i;
+    srand(42);
+    for (int i = n - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int tmp = ids[i]; ids[i] = ids[j]; ids[j] = tmp;
+    }
+    for (int i = 0; i < lookups; i++) probes[i] = rand() % n;
+
+    printf("=== %d dense ids, %d lookups ===\n\n", n, lookups);
+
+    ArtTree *art = create_art_tree();
+    BSTree *bst = create_bst_tree();
+    HashMap *map = create_hash_map(n);
+    char key[16];
+    for (int i = 0; i < n; i++) {
+        art_insert(art, ids[i], i);
+        bst_insert(bst, ids[i]);
+        snprintf(key, sizeof(key), "%d", ids[i]);
+        hash_map_insert(map, key, "1");
+    }
+
+    long long found = 0;
+    double start = now_seconds();
+    for (int i = 0; i < lookups; i++) found += art_search(art, probes[i], NULL);
+    double art_time = now_seconds() - start;
+
+    start = now_seconds();
+    for (int i = 0; i < lookups; i++) found += bst_search(bst, probes[i]) != NULL;
+    double bst_time = now_seconds() - start;
+
+    // The hash map takes string keys, so formatting is part of its lookup cost
+    start = now_seconds();
+    for (int i = 0; i < lookups; i++) {
+        snprintf(key, sizeof(key), "%d", probes[i]);
+        found += hash_map_get(map, key) != NULL;
+    }
+    double map_time = now_seconds() - start;
+
+    printf("ART lookups:      %8.3fs (%.1f ns each)\n", art_time, art_time * 1e9 / lookups);
+    printf("BST lookups:      %8.3fs (%.1f ns each)\n", bst_time, bst_time * 1e9 / lookups);
+    printf("Hash map lookups: %8.3fs (%.1f ns each)\n", map_time, map_time * 1e9 / lookups);
+    printf("ART memory: %lld bytes (%.1f per key), found %lld\n", art_memory_usage(art),
+           (double)art_memory_usage(art) / n, found);
+
+    destroy_art_tree(art);
+    destroy_bst_tree(bst);
+    destroy_hash_map(map);
+    free(ids);
+    free(probes);
+    return 0;
+}
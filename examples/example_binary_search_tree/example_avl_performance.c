@@ -0,0 +1,84 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/binary_search_tree.h"
+#include "include/avl_tree.h"
+
+// Usage: example_avl_performance [avl_keys] [bst_keys]
+// The plain BST degenerates into a list on sorted input (O(n^2) build), so it
+// is run on fewer keys by default; its destroy is also recursive in tree depth.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Fills keys with the requested order: 0 sorted, 1 reverse-sorted, 2 random permutation
+void make_keys(int *keys, int n, int order) {
+    for (int i = 0; i < n; i++) keys[i] = (order == 1) ? n - 1 - i : i;
+    if (order == 2) {
+        for (int i = n - 1; i > 0; i--) {
+            int j = rand() % (i + 1);
+            int tmp = keys[i];
+            keys[i] = keys[j];
+            keys[j] = tmp;
+        }
+    }
+}
+
+void run_bst(const int *keys, int n, const char *label) {
+    double start = now_seconds();
+    Node *root = create_node(keys[0]);
+    for (int i = 1; i < n; i++) binary_insert(root, keys[i]);
+    double built = now_seconds();
+
+    int found = 0;
+    for (int i = 0; i < n; i++) found += (binary_search(root, keys[i]) != NULL);
+    double searched = now_seconds();
+
+    printf("  BST %-8s n=%-9d insert %8.3fs  search %8.3fs  (%d found)\n", label, n, built - start,
+           searched - built, found);
+    destroy_binary_search_tree(root);
+}
+
+void run_avl(const int *keys, int n, const char *label) {
+    double start = now_seconds();
+    AvlNode *root = NULL;
+    for (int i = 0; i < n; i++) avl_insert(&root, keys[i]);
+    double built = now_seconds();
+
+    int found = 0;
+    for (int i = 0; i < n; i++) found += (avl_search(root, keys[i]) != NULL);
+    double searched = now_seconds();
+
+    printf("  AVL %-8s n=%-9d insert %8.3fs  search %8.3fs  (%d found, height %d)\n", label, n,
+           built - start, searched - built, found, avl_height(root));
+    destroy_avl_tree(root);
+}
+
+int main(int argc, char **argv) {
+    int avl_n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int bst_n = (argc > 2) ? atoi(argv[2]) : 20000;
+    const char *labels[] = {"sorted", "reverse", "random"};
+
+    printf("=== AVL vs. Binary Search Tree ===\n\n");
+    srand(1);
+
+    int max_n = (avl_n > bst_n) ? avl_n : bst_n;
+    int *keys = malloc(sizeof(int) * max_n);
+    if (keys == NULL) return 1;
+
+    for (int order = 0; order < 3; order++) {
+        printf("%s keys:\n", labels[order]);
+        make_keys(keys, bst_n, order);
+        run_bst(keys, bst_n, labels[order]);
+        run_avl(keys, bst_n, labels[order]);
+        make_keys(keys, avl_n, order);
+        run_avl(keys, avl_n, labels[order]);
+        printf("\n");
+    }
+
+    free(keys);
+    return 0;
+}
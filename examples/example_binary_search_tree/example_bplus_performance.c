@@ -0,0 +1,69 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/binary_search_tree.h"
+#include "include/bplus_tree.h"
+
+// Usage: example_bplus_performance [keys] [lookups]
+// Random keys, so the plain BST stays near log depth and the comparison is fair.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 5000000;
+    int lookups = (argc > 2) ? atoi(argv[2]) : 5000000;
+
+    printf("=== B+ Tree vs. Binary Search Tree (%d random keys) ===\n\n", n);
+    srand(11);
+    int *keys = malloc(sizeof(int) * n);
+    int *probes = malloc(sizeof(int) * lookups);
+    if (keys == NULL || probes == NULL) return 1;
+    for (int i = 0; i < n; i++) keys[i] = (rand() << 8) ^ rand();
+    for (int i = 0; i < lookups; i++) probes[i] = keys[rand() % n];
+
+    double start = now_seconds();
+    Node *root = create_node(keys[0]);
+    for (int i = 1; i < n; i++) binary_insert(root, keys[i]);
+    double bst_build = now_seconds() - start;
+
+    start = now_seconds();
+    long long bst_found = 0;
+    for (int i = 0; i < lookups; i++) bst_found += (binary_search(root, probes[i]) != NULL);
+    double bst_search = now_seconds() - start;
+
+    start = now_seconds();
+    BPlusTree *tree = create_bplus_tree();
+    for (int i = 0; i < n; i++) bplus_insert(tree, keys[i], i);
+    double bplus_build = now_seconds() - start;
+
+    start = now_seconds();
+    long long bplus_found = 0;
+    for (int i = 0; i < lookups; i++) bplus_found += bplus_search(tree, probes[i], NULL);
+    double bplus_search_time = now_seconds() - start;
+
+    start = now_seconds();
+    long long in_range = bplus_range_count(tree, 0, 1 << 30);
+    double range_time = now_seconds() - start;
+
+    // Each Node is one malloc of sizeof(Node); 16 bytes of allocator overhead is typical
+    double bst_bytes = (double)n * (sizeof(Node) + 16);
+    double bplus_bytes = (double)bplus_memory_usage(tree);
+
+    printf("             build      %d lookups   bytes/key\n", lookups);
+    printf("  BST      %7.3fs   %7.3fs          %6.1f\n", bst_build, bst_search, bst_bytes / n);
+    printf("  B+ tree  %7.3fs   %7.3fs          %6.1f  (height %d, key/value pairs)\n", bplus_build,
+           bplus_search_time, bplus_bytes / bplus_size(tree), tree->height);
+    printf("\nLookup speedup: %.1fx (found %lld / %lld)\n", bst_search / bplus_search_time, bst_found,
+           bplus_found);
+    printf("Range count over [0, 2^30]: %lld keys in %.4fs via linked leaves\n", in_range, range_time);
+
+    destroy_binary_search_tree(root);
+    destroy_bplus_tree(tree);
+    free(keys);
+    free(probes);
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/binary_search_tree.h"
+
+// Usage: example_bulk_build [keys] [insert_keys]
+// Key-by-key insertion of sorted keys is O(n^2), so it runs on insert_keys only.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 50000000;
+    int insert_n = (argc > 2) ? atoi(argv[2]) : 20000;
+
+    printf("=== Bulk build from sorted input ===\n\n");
+    int *keys = malloc(sizeof(int) * n);
+    if (keys == NULL) return 1;
+    for (int i = 0; i < n; i++) keys[i] = i * 2;
+
+    double start = now_seconds();
+    Node *root = create_node(keys[0]);
+    for (int i = 1; i < insert_n; i++) binary_insert(root, keys[i]);
+    double insert_time = now_seconds() - start;
+    destroy_binary_search_tree(root);
+    printf("binary_insert, %9d sorted keys: %8.3fs\n", insert_n, insert_time);
+
+    start = now_seconds();
+    BSTree *tree = bst_build_sorted(keys, n);
+    double build_time = now_seconds() - start;
+    if (tree == NULL) return 1;
+    printf("bst_build_sorted, %6d sorted keys: %8.3fs\n", n, build_time);
+
+    // Odd keys interleave with every existing key
+    int batch_n = n / 10;
+    int *batch = malloc(sizeof(int) * batch_n);
+    if (batch == NULL) return 1;
+    for (int i = 0; i < batch_n; i++) batch[i] = i * 20 + 1;
+
+    start = now_seconds();
+    bst_merge_sorted(tree, batch, batch_n);
+    double merge_time = now_seconds() - start;
+    printf("bst_merge_sorted, %6d batch keys:  %8.3fs (tree now %lld keys)\n", batch_n, merge_time,
+           bst_size(tree));
+
+    destroy_bst_tree(tree);
+    free(batch);
+    free(keys);
+    return 0;
+}
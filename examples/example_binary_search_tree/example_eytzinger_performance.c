@@ -0,0 +1,68 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/binary_search_tree.h"
+#include "include/eytzinger_index.h"
+
+// Usage: example_eytzinger_performance [keys] [lookups]
+// Compares lookups in a balanced pointer tree, a sorted array and the frozen index.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int sorted_array_search(const int *values, int n, int target) {
+    int lo = 0, hi = n;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (values[mid] < target) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo < n && values[lo] == target;
+}
+
+int main(int argc, char **argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    int lookups = (argc > 2) ? atoi(argv[2]) : 10000000;
+
+    printf("=== Eytzinger index vs. pointer tree (%d keys) ===\n\n", n);
+    int *values = malloc(sizeof(int) * n);
+    int *probes = malloc(sizeof(int) * lookups);
+    if (values == NULL || probes == NULL) return 1;
+    for (int i = 0; i < n; i++) values[i] = i * 2;
+    srand(4);
+    for (int i = 0; i < lookups; i++) probes[i] = rand() % (2 * n); // Half the probes hit
+
+    BSTree *tree = bst_build_sorted(values, n); // Best case for the pointer tree: perfectly balanced
+
+    double start = now_seconds();
+    EytzingerIndex *index = bst_freeze(tree->root);
+    double freeze_time = now_seconds() - start;
+
+    long long found[3] = {0, 0, 0};
+    start = now_seconds();
+    for (int i = 0; i < lookups; i++) found[0] += (bst_search(tree, probes[i]) != NULL);
+    double tree_time = now_seconds() - start;
+
+    start = now_seconds();
+    for (int i = 0; i < lookups; i++) found[1] += sorted_array_search(values, n, probes[i]);
+    double array_time = now_seconds() - start;
+
+    start = now_seconds();
+    for (int i = 0; i < lookups; i++) found[2] += eytzinger_search(index, probes[i]);
+    double eytzinger_time = now_seconds() - start;
+
+    printf("bst_freeze:             %.3fs\n\n", freeze_time);
+    printf("  pointer tree   %7.3fs  (%lld found)\n", tree_time, found[0]);
+    printf("  sorted array   %7.3fs  (%lld found)\n", array_time, found[1]);
+    printf("  eytzinger      %7.3fs  (%lld found)\n", eytzinger_time, found[2]);
+    printf("\nSpeedup over the pointer tree: %.1fx\n", tree_time / eytzinger_time);
+
+    destroy_eytzinger_index(index);
+    destroy_bst_tree(tree);
+    free(values);
+    free(probes);
+    return 0;
+}
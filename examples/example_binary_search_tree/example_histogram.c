@@ -0,0 +1,49 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/binary_search_tree.h"
+#include "include/ordered_map.h"
+
+// Usage: example_histogram [samples] [distinct]
+// Skewed samples: duplicate BST nodes vs one counted node per key.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    int samples = (argc > 1) ? atoi(argv[1]) : 2000000;
+    int distinct = (argc > 2) ? atoi(argv[2]) : 1000;
+
+    // Squaring a uniform draw skews the samples toward small keys
+    int *data = malloc(sizeof(int) * samples);
+    if (data == NULL) return 1;
+    srand(44);
+    for (int i = 0; i < samples; i++) {
+        double u = (double)rand() / RAND_MAX;
+        data[i] = (int)(u * u * distinct);
+    }
+
+    printf("=== Histogram of %d samples over %d keys ===\n\n", samples, distinct);
+
+    double start = now_seconds();
+    BSTree *tree = create_bst_tree();
+    for (int i = 0; i < samples; i++) bst_insert(tree, data[i]);
+    double bst_time = now_seconds() - start;
+    printf("BST (duplicate nodes):  %8.3fs, %lld nodes\n", bst_time, bst_size(tree));
+    destroy_bst_tree(tree);
+
+    start = now_seconds();
+    OrderedMap *map = create_ordered_map(1);
+    for (int i = 0; i < samples; i++) ordered_map_put(map, data[i], NULL, NULL);
+    double map_time = now_seconds() - start;
+    printf("Ordered map (multiset): %8.3fs, %lld nodes for %lld samples\n", map_time, ordered_map_size(map),
+           ordered_map_total(map));
+    printf("Count of key 0: %lld\n", ordered_map_count(map, 0));
+
+    destroy_ordered_map(map, NULL);
+    free(data);
+    return 0;
+}
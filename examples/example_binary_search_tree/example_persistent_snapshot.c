@@ -0,0 +1,75 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/binary_search_tree.h"
+#include "include/persistent_tree.h"
+
+// Usage: example_persistent_snapshot [keys] [updates]
+// Compares a full node-by-node copy of a tree with a persistent snapshot.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Copies a balanced tree, as a reader needing a stable view would have to
+Node *copy_tree(Node *root) {
+    if (root == NULL) return NULL;
+    Node *copy = create_node(root->value);
+    copy->size = root->size;
+    copy->left = copy_tree(root->left);
+    copy->right = copy_tree(root->right);
+    return copy;
+}
+
+int main(int argc, char **argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 5000000;
+    int updates = (argc > 2) ? atoi(argv[2]) : 1000000;
+
+    printf("=== Snapshot cost with %d keys ===\n\n", n);
+    int *keys = malloc(sizeof(int) * n);
+    if (keys == NULL) return 1;
+    for (int i = 0; i < n; i++) keys[i] = i * 2;
+
+    BSTree *tree = bst_build_sorted(keys, n);
+    if (tree == NULL) return 1;
+    double start = now_seconds();
+    Node *copy = copy_tree(tree->root);
+    double copy_time = now_seconds() - start;
+    printf("Full tree copy:       %10.6fs\n", copy_time);
+    destroy_binary_search_tree(copy);
+    destroy_bst_tree(tree);
+
+    PersistentTree *version = create_persistent_tree();
+    start = now_seconds();
+    for (int i = 0; i < n; i++) {
+        PersistentTree *next = persistent_insert(version, keys[i]);
+        destroy_persistent_tree(version);
+        version = next;
+    }
+    printf("Persistent build:     %10.3fs (height %d)\n", now_seconds() - start, persistent_height(version));
+
+    start = now_seconds();
+    PersistentTree *snapshot = persistent_snapshot(version);
+    double snapshot_time = now_seconds() - start;
+    printf("persistent_snapshot:  %10.6fs\n", snapshot_time);
+
+    // Updates after the snapshot copy only their search paths
+    srand(41);
+    start = now_seconds();
+    for (int i = 0; i < updates; i++) {
+        PersistentTree *next = persistent_insert(version, (rand() % n) * 2 + 1);
+        destroy_persistent_tree(version);
+        version = next;
+    }
+    double update_time = now_seconds() - start;
+    printf("%d updates:      %10.3fs (%.0f ns each)\n", updates, update_time, update_time * 1e9 / updates);
+    printf("Snapshot still holds %lld keys, current version %lld\n", persistent_size(snapshot),
+           persistent_size(version));
+
+    destroy_persistent_tree(snapshot);
+    destroy_persistent_tree(version);
+    free(keys);
+    return 0;
+}
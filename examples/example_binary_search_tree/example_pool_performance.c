@@ -0,0 +1,54 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/binary_search_tree.h"
+
+// Usage: example_pool_performance [nodes]
+// Random keys keep both trees near log depth, so the difference is the allocator.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    if (n < 1) {
+        fprintf(stderr, "nodes must be at least 1\n");
+        return 1;
+    }
+
+    printf("=== Pooled vs. malloc'd BST nodes (%d random keys) ===\n\n", n);
+    srand(5);
+    int *keys = malloc(sizeof(int) * n);
+    if (keys == NULL) return 1;
+    for (int i = 0; i < n; i++) keys[i] = (rand() << 8) ^ rand();
+
+    double start = now_seconds();
+    Node *root = create_node(keys[0]);
+    for (int i = 1; i < n; i++) binary_insert(root, keys[i]);
+    double malloc_build = now_seconds() - start;
+
+    start = now_seconds();
+    destroy_binary_search_tree(root);
+    double malloc_teardown = now_seconds() - start;
+
+    start = now_seconds();
+    BSTree *tree = create_bst_tree();
+    for (int i = 0; i < n; i++) bst_insert(tree, keys[i]);
+    double pool_build = now_seconds() - start;
+
+    start = now_seconds();
+    destroy_bst_tree(tree);
+    double pool_teardown = now_seconds() - start;
+
+    printf("              build      teardown\n");
+    printf("  malloc    %7.3fs   %8.4fs\n", malloc_build, malloc_teardown);
+    printf("  pooled    %7.3fs   %8.4fs\n", pool_build, pool_teardown);
+    printf("\nBuild speedup: %.1fx, teardown speedup: %.0fx\n", malloc_build / pool_build,
+           malloc_teardown / pool_teardown);
+
+    free(keys);
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/binary_search_tree.h"
+#include "include/skip_list.h"
+
+// Usage: example_skip_list_performance [ops_per_thread] [max_threads]
+// Compares the lock-free skip list with the BST behind one global mutex.
+
+#define KEY_RANGE 200000
+
+typedef struct {
+    SkipList *list;
+    BSTree *tree;
+    pthread_mutex_t *lock;
+    int id;
+    int ops;
+    int read_percent;
+} bench_args;
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void *skip_list_worker(void *arg) {
+    bench_args *args = arg;
+    SkipListHandle *handle = skip_list_attach(args->list);
+    unsigned int seed = 77 + args->id;
+    for (int i = 0; i < args->ops; i++) {
+        int key = rand_r(&seed) % KEY_RANGE;
+        int roll = rand_r(&seed) % 100;
+        if (roll < args->read_percent) skip_list_search(handle, key);
+        else if (roll % 2) skip_list_insert(handle, key);
+        else skip_list_delete(handle, key);
+    }
+    skip_list_detach(handle);
+    return NULL;
+}
+
+void *locked_tree_worker(void *arg) {
+    bench_args *args = arg;
+    unsigned int seed = 77 + args->id;
+    for (int i = 0; i < args->ops; i++) {
+        int key = rand_r(&seed) % KEY_RANGE;
+        int roll = rand_r(&seed) % 100;
+        pthread_mutex_lock(args->lock);
+        if (roll < args->read_percent) bst_search(args->tree, key);
+        else if (roll % 2) {
+            if (bst_search(args->tree, key) == NULL) bst_insert(args->tree, key); // Same set semantics
+        }
+        else bst_delete(args->tree, key);
+        pthread_mutex_unlock(args->lock);
+    }
+    return NULL;
+}
+
+double run(void *(*worker)(void *), SkipList *list, BSTree *tree, pthread_mutex_t *lock, int threads, int ops,
+           int read_percent) {
+    pthread_t ids[64];
+    bench_args args[64];
+    double start = now_seconds();
+    for (int t = 0; t < threads; t++) {
+        args[t] = (bench_args){list, tree, lock, t, ops, read_percent};
+        pthread_create(&ids[t], NULL, worker, &args[t]);
+    }
+    for (int t = 0; t < threads; t++) pthread_join(ids[t], NULL);
+    return (double)threads * ops / (now_seconds() - start) / 1e6;
+}
+
+int main(int argc, char **argv) {
+    int ops = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int max_threads = (argc > 2) ? atoi(argv[2]) : 8;
+    if (max_threads > 64) max_threads = 64;
+    int read_mixes[] = {100, 90, 50, 0};
+
+    printf("=== Skip list vs. mutex-protected BST (Mops/s, %d ops per thread) ===\n\n", ops);
+    printf("reads%%  threads   skip list   BST+mutex\n");
+
+    for (int m = 0; m < 4; m++) {
+        for (int threads = 1; threads <= max_threads; threads *= 2) {
+            // Fresh structures holding half the key range
+            SkipList *list = create_skip_list();
+            BSTree *tree = create_bst_tree();
+            SkipListHandle *loader = skip_list_attach(list);
+            unsigned int seed = 3;
+            for (int i = 0; i < KEY_RANGE / 2; i++) {
+                int key = rand_r(&seed) % KEY_RANGE;
+                if (skip_list_insert(loader, key) == 1) bst_insert(tree, key);
+            }
+            skip_list_detach(loader);
+            pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+            double skip = run(skip_list_worker, list, tree, &lock, threads, ops, read_mixes[m]);
+            double locked = run(locked_tree_worker, list, tree, &lock, threads, ops, read_mixes[m]);
+            printf("%5d   %7d   %9.2f   %9.2f\n", read_mixes[m], threads, skip, locked);
+
+            destroy_skip_list(list);
+            destroy_bst_tree(tree);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/treap.h"
+
+// Usage: example_treap_set_operations [keys] [threads]
+// Union of two large sets: key-by-key insertion vs join-based union.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 2000000;
+    int threads = (argc > 2) ? atoi(argv[2]) : 0;
+
+    int *a = malloc(sizeof(int) * n);
+    int *b = malloc(sizeof(int) * n);
+    if (a == NULL || b == NULL) return 1;
+    srand(43);
+    for (int i = 0; i < n; i++) {
+        a[i] = rand() % (4 * n);
+        b[i] = rand() % (4 * n);
+    }
+
+    printf("=== Union of two sets of %d random keys ===\n\n", n);
+
+    TreapNode *left = NULL;
+    TreapNode *right = NULL;
+    treap_insert_batch(&left, a, n, threads);
+    treap_insert_batch(&right, b, n, threads);
+
+    double start = now_seconds();
+    for (int i = 0; i < n; i++) treap_insert(&left, b[i]);
+    double insert_time = now_seconds() - start;
+    printf("Key-by-key insert:    %8.3fs (%d keys)\n", insert_time, treap_size(left));
+    destroy_treap(left);
+
+    int runs[] = {1, threads};
+    for (int r = 0; r < 2; r++) {
+        left = NULL;
+        TreapNode *copy = NULL;
+        treap_insert_batch(&left, a, n, threads);
+        treap_insert_batch(&copy, b, n, threads);
+
+        start = now_seconds();
+        TreapNode *result = treap_union(left, copy, runs[r]);
+        double union_time = now_seconds() - start;
+        if (runs[r] <= 0)
+            printf("treap_union, all CPUs: %7.3fs (%d keys)\n", union_time, treap_size(result));
+        else
+            printf("treap_union, %d thread(s): %4.3fs (%d keys)\n", runs[r], union_time, treap_size(result));
+        destroy_treap(result);
+    }
+
+    start = now_seconds();
+    left = NULL;
+    treap_insert_batch(&left, a, n, threads);
+    printf("treap_insert_batch:   %8.3fs\n", now_seconds() - start);
+
+    destroy_treap(left);
+    destroy_treap(right);
+    free(a);
+    free(b);
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/c_concurrent_vector.h"
+#include "include/c_vector.h"
+
+// Usage: example_concurrent_performance [readers] [appends]
+// Compares one producer + N readers on a mutex-protected Vector
+// against the lock-free-read ConcurrentVector, then measures multi-producer appends.
+
+static int num_appends = 5000000;
+static atomic_int producer_done;
+static atomic_llong total_reads;
+static atomic_llong read_checksum;   // Sum of every value read, printed so the reads stay live
+
+static Vector *locked_vec;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static ConcurrentVector *concurrent_vec;
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void *locked_producer(void *arg) {
+    (void)arg;
+    for (int i = 0; i < num_appends; i++) {
+        pthread_mutex_lock(&lock);
+        add_at_end(locked_vec, i);
+        pthread_mutex_unlock(&lock);
+    }
+    atomic_store(&producer_done, 1);
+    return NULL;
+}
+
+void *locked_reader(void *arg) {
+    (void)arg;
+    long long reads = 0, sink = 0;
+    while (!atomic_load(&producer_done)) {
+        pthread_mutex_lock(&lock);
+        int size = current_size(locked_vec);
+        if (size > 0) sink += get_value_at_index(locked_vec, size - 1 - (int)(reads % size));
+        pthread_mutex_unlock(&lock);
+        reads++;
+    }
+    atomic_fetch_add(&total_reads, reads);
+    atomic_fetch_add(&read_checksum, sink);
+    return NULL;
+}
+
+void *concurrent_producer(void *arg) {
+    int count = *(int *)arg;
+    for (int i = 0; i < count; i++) concurrent_add_at_end(concurrent_vec, i);
+    atomic_store(&producer_done, 1);
+    return NULL;
+}
+
+void *concurrent_reader(void *arg) {
+    (void)arg;
+    long long reads = 0, sink = 0;
+    while (!atomic_load(&producer_done)) {
+        long long size = concurrent_current_size(concurrent_vec);
+        if (size > 0) sink += concurrent_get_value_at_index(concurrent_vec, size - 1 - reads % size);
+        reads++;
+    }
+    atomic_fetch_add(&total_reads, reads);
+    atomic_fetch_add(&read_checksum, sink);
+    return NULL;
+}
+
+double run(void *(*producer)(void *), void *(*reader)(void *), int readers, void *producer_arg) {
+    pthread_t producer_thread, reader_threads[64];
+    atomic_store(&producer_done, 0);
+    atomic_store(&total_reads, 0);
+
+    double start = now_seconds();
+    for (int r = 0; r < readers; r++) pthread_create(&reader_threads[r], NULL, reader, NULL);
+    pthread_create(&producer_thread, NULL, producer, producer_arg);
+    pthread_join(producer_thread, NULL);
+    for (int r = 0; r < readers; r++) pthread_join(reader_threads[r], NULL);
+    return now_seconds() - start;
+}
+
+int main(int argc, char **argv) {
+    int readers = (argc > 1) ? atoi(argv[1]) : 4;
+    if (argc > 2) num_appends = atoi(argv[2]);
+    if (readers > 64) readers = 64;
+
+    printf("=== Concurrent Vector Performance Test ===\n");
+    printf("1 producer, %d readers, %d appends\n\n", readers, num_appends);
+
+    locked_vec = create_vector(16);
+    double t = run(locked_producer, locked_reader, readers, NULL);
+    printf("Vector + mutex:    %.4f s, %.1f M appends/s, %.1f M reads/s\n", t, num_appends / t / 1e6,
+           atomic_load(&total_reads) / t / 1e6);
+    destroy_vector(locked_vec);
+
+    concurrent_vec = create_concurrent_vector();
+    t = run(concurrent_producer, concurrent_reader, readers, &num_appends);
+    printf("ConcurrentVector:  %.4f s, %.1f M appends/s, %.1f M reads/s\n", t, num_appends / t / 1e6,
+           atomic_load(&total_reads) / t / 1e6);
+    destroy_concurrent_vector(concurrent_vec);
+
+    // Multi-producer appends via fetch-add reservation
+    for (int producers = 1; producers <= 8; producers *= 2) {
+        concurrent_vec = create_concurrent_vector();
+        pthread_t threads[8];
+        int per_producer = num_appends / producers;
+        double start = now_seconds();
+        for (int p = 0; p < producers; p++) pthread_create(&threads[p], NULL, concurrent_producer, &per_producer);
+        for (int p = 0; p < producers; p++) pthread_join(threads[p], NULL);
+        t = now_seconds() - start;
+        printf("%d producer(s):     %.1f M appends/s\n", producers, per_producer * producers / t / 1e6);
+        destroy_concurrent_vector(concurrent_vec);
+    }
+
+    printf("\nRead checksum: %lld\n", atomic_load(&read_checksum));
+    return 0;
+}
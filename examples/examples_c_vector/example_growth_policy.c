@@ -0,0 +1,49 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include "include/c_vector.h"
+
+// Usage: example_growth_policy [double|half|class] [elements] [huge]
+// Run once per policy: peak RSS is a per-process high-water mark.
+
+int main(int argc, char **argv) {
+    const char *policy = (argc > 1) ? argv[1] : "double";
+    int n = (argc > 2) ? atoi(argv[2]) : 300000000;
+    int huge = (argc > 3) && strcmp(argv[3], "huge") == 0;
+
+    printf("=== Vector Growth Policy Example ===\n\n");
+
+    Vector *vec = create_vector(16);
+    if (!vec) {
+        printf("Failed to create vector!\n");
+        return 1;
+    }
+    if (strcmp(policy, "half") == 0) vector_set_growth(vec, VECTOR_GROWTH_ONE_AND_HALF);
+    if (strcmp(policy, "class") == 0) vector_set_growth(vec, VECTOR_GROWTH_SIZE_CLASS);
+    vector_use_huge_pages(vec, huge);
+
+    clock_t start = clock();
+    for (int i = 0; i < n; i++) {
+        if (add_at_end(vec, i) != 1) {
+            printf("Allocation failed at %d elements\n", i);
+            break;
+        }
+    }
+    double elapsed = ((double)(clock() - start)) / CLOCKS_PER_SEC;
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    printf("Policy: %s%s\n", policy, huge ? " + huge pages" : "");
+    printf("Ingested %d elements in %.4f seconds\n", current_size(vec), elapsed);
+    printf("Capacity: %d (%.1f%% unused)\n", current_capacity(vec),
+           100.0 * (current_capacity(vec) - current_size(vec)) / current_capacity(vec));
+    printf("Mapped buffer: %s\n", (vec->flags & VECTOR_FLAG_MAPPED) ? "yes" : "no");
+    printf("Peak RSS: %.1f MB (payload %.1f MB)\n", usage.ru_maxrss / 1024.0,
+           (double)current_size(vec) * sizeof(int) / (1024.0 * 1024.0));
+
+    destroy_vector(vec);
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/c_vector_simd.h"
+
+#define NUM_ELEMENTS 20000000
+#define REPEATS 5
+
+// Reference scalar pass used as the baseline
+long long scalar_sum(Vector *vec) {
+    long long sum = 0;
+    for (int i = 0; i < vec->size; i++) sum += vec->collection[i];
+    return sum;
+}
+
+int scalar_count_eq(Vector *vec, int value) {
+    int count = 0;
+    for (int i = 0; i < vec->size; i++) {
+        if (vec->collection[i] == value) count++;
+    }
+    return count;
+}
+
+double elapsed(clock_t start) {
+    return ((double)(clock() - start)) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char **argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : NUM_ELEMENTS;
+
+    printf("=== Vector SIMD Performance Test ===\n");
+    printf("Elements: %d, backend: %s\n\n", n, vector_simd_backend());
+
+    Vector *vec = create_vector(n);
+    if (!vec) {
+        printf("Failed to create vector!\n");
+        return 1;
+    }
+    srand(1);
+    for (int i = 0; i < n; i++) add_at_end(vec, rand() % 1000);
+
+    clock_t start;
+    volatile long long sink = 0;
+
+    start = clock();
+    for (int r = 0; r < REPEATS; r++) sink += scalar_sum(vec);
+    double t_scalar = elapsed(start) / REPEATS;
+
+    start = clock();
+    for (int r = 0; r < REPEATS; r++) sink += vector_sum(vec);
+    double t_simd = elapsed(start) / REPEATS;
+    printf("sum:       scalar %.6f s, simd %.6f s (%.1fx)\n", t_scalar, t_simd, t_scalar / t_simd);
+
+    start = clock();
+    for (int r = 0; r < REPEATS; r++) sink += scalar_count_eq(vec, 7);
+    t_scalar = elapsed(start) / REPEATS;
+
+    start = clock();
+    for (int r = 0; r < REPEATS; r++) sink += vector_count_eq(vec, 7);
+    t_simd = elapsed(start) / REPEATS;
+    printf("count_eq:  scalar %.6f s, simd %.6f s (%.1fx)\n", t_scalar, t_simd, t_scalar / t_simd);
+
+    int min, max;
+    start = clock();
+    for (int r = 0; r < REPEATS; r++) vector_min_max(vec, &min, &max);
+    printf("min_max:   simd %.6f s (min %d, max %d)\n", elapsed(start) / REPEATS, min, max);
+
+    start = clock();
+    for (int r = 0; r < REPEATS; r++) sink += vector_find(vec, -1);
+    printf("find miss: simd %.6f s\n", elapsed(start) / REPEATS);
+
+    start = clock();
+    Vector *filtered = vector_filter(vec, 100, 199);
+    printf("filter:    simd %.6f s (%d of %d kept)\n", elapsed(start), current_size(filtered), n);
+
+    printf("checksum:  %lld\n", sink);
+
+    destroy_vector(filtered);
+    destroy_vector(vec);
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include <stdio.h>
+#include <time.h>
+#include "include/c_vector.h"
+#include "include/c_small_vector.h"
+
+#define NUM_REQUESTS 5000000
+#define ITEMS_PER_REQUEST 8
+
+// Simulates a per-request scratch list that rarely grows past a few elements
+int main() {
+    printf("=== Small Vector Example ===\n\n");
+
+    clock_t start = clock();
+    long long checksum = 0;
+    for (int r = 0; r < NUM_REQUESTS; r++) {
+        Vector *scratch = create_vector(4); // two mallocs, plus a realloc at 5 items
+        for (int i = 0; i < ITEMS_PER_REQUEST; i++) add_at_end(scratch, r + i);
+        checksum += get_value_at_index(scratch, ITEMS_PER_REQUEST - 1);
+        destroy_vector(scratch);
+    }
+    double t_vector = ((double)(clock() - start)) / CLOCKS_PER_SEC;
+    printf("Vector:       %.4f seconds (3 allocations per request)\n", t_vector);
+
+    start = clock();
+    for (int r = 0; r < NUM_REQUESTS; r++) {
+        SmallVector scratch; // lives on the stack, no allocation at all
+        init_small_vector(&scratch);
+        for (int i = 0; i < ITEMS_PER_REQUEST; i++) small_add_at_end(&scratch, r + i);
+        checksum -= small_get_value_at_index(&scratch, ITEMS_PER_REQUEST - 1);
+        free_small_vector(&scratch);
+    }
+    double t_small = ((double)(clock() - start)) / CLOCKS_PER_SEC;
+    printf("SmallVector:  %.4f seconds (0 allocations per request)\n", t_small);
+
+    printf("\nSpeedup: %.1fx (checksum %lld)\n", t_vector / t_small, checksum);
+    return 0;
+}
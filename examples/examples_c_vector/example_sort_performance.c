@@ -0,0 +1,88 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "include/c_vector_sort.h"
+
+// Usage: example_sort_performance [max_elements] [threads]
+// Sizes grow 10x from 1M up to max_elements (default 10M, pass 100000000 for 100M).
+
+int qsort_compare(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+// Wall-clock seconds; clock() would sum CPU time across sort threads
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int is_sorted(const int *data, int n) {
+    for (int i = 1; i < n; i++) {
+        if (data[i - 1] > data[i]) return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    long max_n = (argc > 1) ? atol(argv[1]) : 10000000;
+    int threads = (argc > 2) ? atoi(argv[2]) : 0;
+
+    printf("=== Sort Performance Test ===\n");
+
+    for (long n = 1000000; n <= max_n; n *= 10) {
+        int *original = malloc(sizeof(int) * n);
+        int *work = malloc(sizeof(int) * n);
+        if (!original || !work) {
+            printf("Failed to allocate %ld elements!\n", n);
+            free(original);
+            free(work);
+            break;
+        }
+
+        srand(42);
+        for (long i = 0; i < n; i++) original[i] = rand() - RAND_MAX / 2;
+
+        printf("\nElements: %ld\n", n);
+        printf("===========================\n");
+
+        double start;
+
+        memcpy(work, original, sizeof(int) * n);
+        start = now_seconds();
+        qsort(work, n, sizeof(int), qsort_compare);
+        double t_qsort = now_seconds() - start;
+        printf("qsort:               %.4f seconds\n", t_qsort);
+
+        memcpy(work, original, sizeof(int) * n);
+        start = now_seconds();
+        radix_sort_ints(work, (int)n);
+        double t = now_seconds() - start;
+        printf("radix sort:          %.4f seconds (%.1fx) %s\n", t, t_qsort / t, is_sorted(work, n) ? "" : "UNSORTED");
+
+        memcpy(work, original, sizeof(int) * n);
+        start = now_seconds();
+        introsort_ints(work, (int)n, NULL);
+        t = now_seconds() - start;
+        printf("introsort:           %.4f seconds (%.1fx) %s\n", t, t_qsort / t, is_sorted(work, n) ? "" : "UNSORTED");
+
+        memcpy(work, original, sizeof(int) * n);
+        start = now_seconds();
+        parallel_merge_sort_ints(work, (int)n, threads);
+        t = now_seconds() - start;
+        printf("parallel merge sort: %.4f seconds (%.1fx) %s\n", t, t_qsort / t, is_sorted(work, n) ? "" : "UNSORTED");
+
+        start = now_seconds();
+        int *perm = argsort_ints(original, (int)n);
+        t = now_seconds() - start;
+        printf("argsort:             %.4f seconds\n", t);
+
+        free(perm);
+        free(original);
+        free(work);
+    }
+
+    return 0;
+}
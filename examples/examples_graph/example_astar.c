@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "include/c_graph.h"
+#include "include/c_graph_internal.h"
+
+// Usage: example_astar [grid_side] [queries] [landmarks]
+// Road-like grid with coordinates: Dijkstra vs A* with coordinate and landmark heuristics.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Edge weights are at least the Euclidean length of the edge (1), so this never overestimates
+double euclidean(int vertex_id, int end_id, void* ctx) {
+    int side = *(int*)ctx;
+    double dx = vertex_id % side - end_id % side;
+    double dy = vertex_id / side - end_id / side;
+    return sqrt(dx * dx + dy * dy);
+}
+
+c_graph_t* build_grid(int side) {
+    c_graph_t* graph = graph_create(0);
+    for (int i = 0; i < side * side; i++) graph_add_vertex(graph, i);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int id = r * side + c;
+            if (c + 1 < side) graph_add_edge(graph, id, id + 1, 1 + rand() % 3);
+            if (r + 1 < side) graph_add_edge(graph, id, id + side, 1 + rand() % 3);
+        }
+    }
+    return graph;
+}
+
+int main(int argc, char** argv) {
+    int side = (argc > 1) ? atoi(argv[1]) : 100;
+    int queries = (argc > 2) ? atoi(argv[2]) : 20;
+    int landmark_count = (argc > 3) ? atoi(argv[3]) : 8;
+    int n = side * side;
+
+    srand(46);
+    c_graph_t* graph = build_grid(side);
+    double start = now_seconds();
+    c_graph_landmarks_t* landmarks = graph_landmarks_create(graph, landmark_count);
+    printf("=== %d x %d grid, %d queries, %d landmarks (%.3fs to precompute) ===\n\n", side, side, queries,
+           landmark_count, now_seconds() - start);
+
+    const char* names[] = {"graph_dijkstra", "A*, no heuristic", "A*, Euclidean", "A*, landmarks (ALT)"};
+    double times[4] = {0};
+    long long settled[4] = {0};
+    for (int q = 0; q < queries; q++) {
+        int s = rand() % n, t = rand() % n;
+        for (int method = 0; method < 4; method++) {
+            int len = 0;
+            int* path = NULL;
+            start = now_seconds();
+            if (method == 0) path = graph_dijkstra(graph, s, t, &len);
+            if (method == 1) path = graph_astar(graph, s, t, NULL, NULL, &len);
+            if (method == 2) path = graph_astar(graph, s, t, euclidean, &side, &len);
+            if (method == 3) path = graph_astar(graph, s, t, graph_landmark_heuristic, landmarks, &len);
+            times[method] += now_seconds() - start;
+            if (method > 0) settled[method] += graph_settled_count;
+            free(path);
+        }
+    }
+
+    for (int method = 0; method < 4; method++) {
+        printf("%-20s %9.3f ms/query", names[method], times[method] * 1e3 / queries);
+        if (method > 0) printf(", %6lld vertices settled", settled[method] / queries);
+        printf("\n");
+    }
+
+    graph_landmarks_destroy(landmarks);
+    graph_destroy(graph);
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/c_graph.h"
+#include "include/c_graph_internal.h"
+
+// Usage: example_contraction_hierarchy [grid_side] [queries] [threads]
+// Road-like grid: preprocessing cost of a contraction hierarchy and query time against Dijkstra.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+c_graph_t* build_grid(int side) {
+    c_graph_t* graph = graph_create(0);
+    for (int i = 0; i < side * side; i++) graph_add_vertex(graph, i);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int id = r * side + c;
+            if (c + 1 < side) graph_add_edge(graph, id, id + 1, 1 + rand() % 3);
+            if (r + 1 < side) graph_add_edge(graph, id, id + side, 1 + rand() % 3);
+        }
+    }
+    return graph;
+}
+
+int main(int argc, char** argv) {
+    int side = (argc > 1) ? atoi(argv[1]) : 100;
+    int queries = (argc > 2) ? atoi(argv[2]) : 200;
+    int threads = (argc > 3) ? atoi(argv[3]) : 0;
+    int n = side * side;
+    const char* filename = "example_graph.ch";
+
+    srand(47);
+    c_graph_t* graph = build_grid(side);
+    printf("=== %d x %d grid, %d queries ===\n\n", side, side, queries);
+
+    double start = now_seconds();
+    c_graph_ch_t* ch = graph_ch_build(graph, 1);
+    printf("build, 1 thread      %9.3f s\n", now_seconds() - start);
+    graph_ch_destroy(ch);
+
+    start = now_seconds();
+    ch = graph_ch_build(graph, threads);
+    printf("build, %s %9.3f s\n", threads > 0 ? "given threads " : "all CPUs      ", now_seconds() - start);
+
+    start = now_seconds();
+    graph_ch_save(ch, filename);
+    c_graph_ch_t* loaded = graph_ch_load(filename);
+    printf("save + load          %9.3f s\n\n", now_seconds() - start);
+    remove(filename);
+
+    const char* names[] = {"graph_dijkstra", "bidirectional", "contraction hier."};
+    double times[3] = {0};
+    long long settled[3] = {0};
+    int mismatches = 0;
+    for (int q = 0; q < queries; q++) {
+        int s = rand() % n, t = rand() % n;
+        int lengths[3] = {0};
+        for (int method = 0; method < 3; method++) {
+            int* path = NULL;
+            if (method == 0 && q >= 20) continue; // Quadratic; a few queries are enough
+            start = now_seconds();
+            if (method == 0) path = graph_dijkstra(graph, s, t, &lengths[method]);
+            if (method == 1) path = graph_bidirectional_dijkstra(graph, s, t, &lengths[method]);
+            if (method == 2) path = graph_ch_query(loaded, s, t, &lengths[method]);
+            times[method] += now_seconds() - start;
+            settled[method] += graph_settled_count;
+            free(path);
+        }
+        if (!lengths[1] != !lengths[2]) mismatches++;
+    }
+
+    for (int method = 0; method < 3; method++) {
+        int count = (method == 0 && queries > 20) ? 20 : queries;
+        printf("%-20s %9.3f ms/query", names[method], times[method] * 1e3 / count);
+        if (method > 0) printf(", %6lld vertices settled", settled[method] / count);
+        printf("\n");
+    }
+    printf("\nreachability mismatches: %d\n", mismatches);
+
+    graph_ch_destroy(ch);
+    graph_ch_destroy(loaded);
+    graph_destroy(graph);
+    return 0;
+}
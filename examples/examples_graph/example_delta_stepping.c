@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "include/c_graph.h"
+#include "include/c_graph_internal.h"
+
+// Usage: example_delta_stepping [vertices] [runs]
+// Delta-stepping against Dijkstra across thread counts and bucket widths,
+// on a road-like grid and on a power-law (preferential attachment) graph.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+c_graph_t* build_grid(int side) {
+    c_graph_t* graph = graph_create(0);
+    for (int i = 0; i < side * side; i++) graph_add_vertex(graph, i);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int id = r * side + c;
+            if (c + 1 < side) graph_add_edge(graph, id, id + 1, 1 + rand() % 10);
+            if (r + 1 < side) graph_add_edge(graph, id, id + side, 1 + rand() % 10);
+        }
+    }
+    return graph;
+}
+
+// Each new vertex links to 4 earlier ones picked in proportion to their degree
+c_graph_t* build_power_law(int n) {
+    c_graph_t* graph = graph_create(0);
+    int* endpoints = (int*)malloc(8 * n * sizeof(int));
+    int count = 0;
+    for (int i = 0; i < n; i++) graph_add_vertex(graph, i);
+    for (int i = 1; i < n; i++) {
+        for (int k = 0; k < 4 && k < i; k++) {
+            int target = (count > 0 && rand() % 2) ? endpoints[rand() % count] : rand() % i;
+            graph_add_edge(graph, i, target, 1 + rand() % 100);
+            endpoints[count++] = i;
+            endpoints[count++] = target;
+        }
+    }
+    free(endpoints);
+    return graph;
+}
+
+void run(const char* name, c_graph_t* graph, int n, int runs) {
+    int source = 0;
+    printf("--- %s, %d vertices ---\n", name, n);
+
+    double start = now_seconds();
+    c_graph_spt_t* expected = NULL;
+    for (int r = 0; r < runs; r++) {
+        graph_spt_destroy(expected);
+        expected = graph_spt_dijkstra(graph, source);
+    }
+    double base = (now_seconds() - start) / runs;
+    printf("graph_spt_dijkstra          %8.3f ms\n", base * 1e3);
+
+    double deltas[] = {0, 1, 10, 100, 1000};
+    int thread_counts[] = {1, 2, 4, 8};
+    printf("%-10s", "delta");
+    for (int t = 0; t < 4; t++) printf("  %4d thr (ms)", thread_counts[t]);
+    printf("  relaxed/vertex\n");
+
+    for (int d = 0; d < 5; d++) {
+        if (deltas[d] == 0) printf("%-10s", "auto");
+        else printf("%-10g", deltas[d]);
+        long long processed = 0;
+        int mismatches = 0;
+        for (int t = 0; t < 4; t++) {
+            start = now_seconds();
+            c_graph_spt_t* tree = NULL;
+            for (int r = 0; r < runs; r++) {
+                graph_spt_destroy(tree);
+                tree = graph_spt_delta_stepping(graph, source, deltas[d], thread_counts[t]);
+            }
+            printf("  %13.3f", (now_seconds() - start) / runs * 1e3);
+            processed = graph_settled_count;
+            for (int v = 0; v < n; v++) {
+                if (graph_spt_distance(tree, v) != graph_spt_distance(expected, v)) mismatches++;
+            }
+            graph_spt_destroy(tree);
+        }
+        printf("  %14.2f%s\n", (double)processed / n, mismatches ? "  MISMATCH" : "");
+    }
+    printf("\n");
+    graph_spt_destroy(expected);
+}
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 10000;
+    int runs = (argc > 2) ? atoi(argv[2]) : 5;
+    int side = 1;
+    while ((side + 1) * (side + 1) <= n) side++;
+
+    srand(50);
+    c_graph_t* road = build_grid(side);
+    run("road-like grid", road, side * side, runs);
+    graph_destroy(road);
+
+    c_graph_t* power_law = build_power_law(n);
+    run("power-law graph", power_law, n, runs);
+    graph_destroy(power_law);
+    return 0;
+}
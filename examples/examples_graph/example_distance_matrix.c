@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <time.h>
+#include "include/c_graph.h"
+
+// Usage: example_distance_matrix [grid_side] [sources] [targets]
+// Road-like grid: one graph_distance_matrix call against a shortest-path query per pair.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+c_graph_t* build_grid(int side) {
+    c_graph_t* graph = graph_create(0);
+    for (int i = 0; i < side * side; i++) graph_add_vertex(graph, i);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int id = r * side + c;
+            if (c + 1 < side) graph_add_edge(graph, id, id + 1, 1 + rand() % 3);
+            if (r + 1 < side) graph_add_edge(graph, id, id + side, 1 + rand() % 3);
+        }
+    }
+    return graph;
+}
+
+int main(int argc, char** argv) {
+    int side = (argc > 1) ? atoi(argv[1]) : 100;
+    int n = (argc > 2) ? atoi(argv[2]) : 50;
+    int m = (argc > 3) ? atoi(argv[3]) : 50;
+
+    srand(48);
+    c_graph_t* graph = build_grid(side);
+    int* sources = (int*)malloc(n * sizeof(int));
+    int* targets = (int*)malloc(m * sizeof(int));
+    double* matrix = (double*)malloc((size_t)n * m * sizeof(double));
+    for (int i = 0; i < n; i++) sources[i] = rand() % (side * side);
+    for (int j = 0; j < m; j++) targets[j] = rand() % (side * side);
+    printf("=== %d x %d grid, %d x %d matrix ===\n\n", side, side, n, m);
+
+    double start = now_seconds();
+    graph_distance_matrix(graph, sources, n, targets, m, matrix);
+    double matrix_time = now_seconds() - start;
+    printf("graph_distance_matrix        %10.3f s\n", matrix_time);
+
+    // Per-pair searches for comparison; graph_dijkstra is timed on a sample
+    start = now_seconds();
+    int mismatches = 0;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < m; j++) {
+            int len = 0;
+            int* path = graph_bidirectional_dijkstra(graph, sources[i], targets[j], &len);
+            if ((path == NULL) != (matrix[(size_t)i * m + j] == DBL_MAX)) mismatches++;
+            free(path);
+        }
+    }
+    printf("bidirectional, per pair      %10.3f s\n", now_seconds() - start);
+
+    int sample = 5;
+    start = now_seconds();
+    for (int q = 0; q < sample; q++) {
+        int len = 0;
+        free(graph_dijkstra(graph, sources[q % n], targets[q % m], &len));
+    }
+    double per_call = (now_seconds() - start) / sample;
+    printf("graph_dijkstra, per pair     %10.3f s (estimated from %d calls)\n", per_call * n * m, sample);
+    printf("\nreachability mismatches: %d\n", mismatches);
+
+    free(sources);
+    free(targets);
+    free(matrix);
+    graph_destroy(graph);
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <time.h>
+#include "include/c_graph.h"
+
+// Usage: example_shortest_path_tree [grid_side] [facilities] [nearest]
+// Nearest facilities from a depot: one shortest-path tree against one graph_dijkstra call per facility.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+c_graph_t* build_grid(int side) {
+    c_graph_t* graph = graph_create(0);
+    for (int i = 0; i < side * side; i++) graph_add_vertex(graph, i);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int id = r * side + c;
+            if (c + 1 < side) graph_add_edge(graph, id, id + 1, 1 + rand() % 3);
+            if (r + 1 < side) graph_add_edge(graph, id, id + side, 1 + rand() % 3);
+        }
+    }
+    return graph;
+}
+
+int main(int argc, char** argv) {
+    int side = (argc > 1) ? atoi(argv[1]) : 100;
+    int k = (argc > 2) ? atoi(argv[2]) : 50;
+    int nearest = (argc > 3) ? atoi(argv[3]) : 5;
+
+    srand(49);
+    c_graph_t* graph = build_grid(side);
+    int depot = rand() % (side * side);
+    int* facilities = (int*)malloc(k * sizeof(int));
+    double* dist = (double*)malloc(k * sizeof(double));
+    for (int i = 0; i < k; i++) facilities[i] = rand() % (side * side);
+    printf("=== %d x %d grid, %d facilities ===\n\n", side, side, k);
+
+    // One search per facility, keeping only the path each returns
+    double start = now_seconds();
+    long long total_len = 0;
+    for (int i = 0; i < k; i++) {
+        int len = 0;
+        int* path = graph_dijkstra(graph, depot, facilities[i], &len);
+        total_len += len;
+        free(path);
+    }
+    printf("graph_dijkstra per facility %9.3f s\n", now_seconds() - start);
+
+    start = now_seconds();
+    c_graph_spt_t* tree = graph_spt_dijkstra(graph, depot);
+    long long tree_len = 0;
+    for (int i = 0; i < k; i++) {
+        int len = 0;
+        int* path = graph_spt_path(tree, facilities[i], &len);
+        dist[i] = graph_spt_distance(tree, facilities[i]);
+        tree_len += len;
+        free(path);
+    }
+    printf("one shortest-path tree      %9.3f s\n", now_seconds() - start);
+    printf("path vertices: %lld vs %lld\n\n", total_len, tree_len);
+
+    printf("nearest facilities to depot %d:\n", depot);
+    for (int r = 0; r < nearest && r < k; r++) {
+        int best = -1;
+        for (int i = 0; i < k; i++) {
+            if (dist[i] != DBL_MAX && (best == -1 || dist[i] < dist[best])) best = i;
+        }
+        if (best == -1) break;
+        printf("  vertex %5d at distance %.0f\n", facilities[best], dist[best]);
+        dist[best] = DBL_MAX;
+    }
+
+    graph_spt_destroy(tree);
+    free(facilities);
+    free(dist);
+    graph_destroy(graph);
+    return 0;
+}
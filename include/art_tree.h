@@ -0,0 +1,81 @@
+#ifndef ART_TREE_H
+#define ART_TREE_H
+
+#include <stdint.h>
+
+/*
+ * Adaptive radix tree over 64-bit signed keys. Keys are stored with the sign
+ * bit flipped and split into big-endian bytes, so byte order matches signed
+ * order and the tree is at most eight levels deep. Inner nodes grow and shrink
+ * between four sizes, and runs of single-child levels are collapsed into a
+ * prefix, so dense sets of 32-bit ids keep their shared leading bytes in a
+ * single prefix instead of extra levels.
+ *
+ * Child pointers with the low bit set point to an ArtLeaf, not an inner node.
+ */
+#define ART_KEY_BYTES 8
+
+enum art_node_type{
+    ART_NODE4,
+    ART_NODE16,
+    ART_NODE48,
+    ART_NODE256
+};
+
+typedef struct art_node{
+    uint8_t type;
+    uint8_t prefix_len;             /* Key bytes skipped before this node branches */
+    uint16_t count;                 /* Number of children */
+    uint8_t prefix[ART_KEY_BYTES];
+}ArtNode;
+
+typedef struct art_leaf{
+    uint64_t key;                   /* Sign-flipped key */
+    int value;
+}ArtLeaf;
+
+/* Up to 4 children, keys kept sorted */
+typedef struct art_node4{
+    ArtNode header;
+    uint8_t keys[4];
+    ArtNode *children[4];
+}ArtNode4;
+
+/* Up to 16 children, keys kept sorted and searched 16 at a time */
+typedef struct art_node16{
+    ArtNode header;
+    uint8_t keys[16];
+    ArtNode *children[16];
+}ArtNode16;
+
+/* Up to 48 children; index maps a key byte to its slot plus one (0 if absent) */
+typedef struct art_node48{
+    ArtNode header;
+    uint8_t index[256];
+    ArtNode *children[48];
+}ArtNode48;
+
+/* One child per key byte */
+typedef struct art_node256{
+    ArtNode header;
+    ArtNode *children[256];
+}ArtNode256;
+
+typedef struct art_tree{
+    ArtNode *root;
+    long long size;
+}ArtTree;
+
+typedef void (*art_visit_fn)(long long key, int value, void *context);
+
+ArtTree *create_art_tree(void);
+void destroy_art_tree(ArtTree *tree);
+int art_insert(ArtTree *tree, long long key, int value);
+int art_search(ArtTree *tree, long long key, int *value);
+int art_delete(ArtTree *tree, long long key);
+long long art_size(ArtTree *tree);
+long long art_memory_usage(ArtTree *tree);
+long long art_range(ArtTree *tree, long long low, long long high, art_visit_fn visit, void *context);
+
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef AVL_TREE_H
+#define AVL_TREE_H
+
+/* Height-balanced variant of the binary_search_tree API: O(log n) worst case */
+typedef struct avl_node{
+    int value;
+    int height;
+    struct avl_node *right;
+    struct avl_node *left;
+}AvlNode;
+
+AvlNode *avl_create_node(int value);
+void destroy_avl_tree(AvlNode *root);
+AvlNode *avl_insert(AvlNode **root, int value);
+AvlNode *avl_search(AvlNode *root, int target);
+int avl_delete(AvlNode **root, int target);
+int avl_height(AvlNode *root);
+
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef AVL_TREE_INTERNAL_H
+#define AVL_TREE_INTERNAL_H
+
+#include "avl_tree.h"
+
+// Shared by avl_tree.c and ordered_map.c, whose nodes embed AvlNode as their first member
+AvlNode *avl_rebalance(AvlNode *node);
+AvlNode *avl_remove_min(AvlNode *root, AvlNode **min);
+
+#endif
@@ -1,12 +1,33 @@
 #ifndef BINARY_SEARCH_TREE_H
 #define BINARY_SEARCH_TREE_H
 
+#include "c_vector.h"
+
 typedef struct node{
     int value;
+    int size;               /* Nodes in the subtree rooted here, for order statistics */
     struct node *right;
     struct node *left;
 }Node;
 
+#define BST_SLAB_NODES 4096
+
+/* In-order cursor; holds no allocations, valid until the tree is modified */
+typedef struct bst_iterator{
+    Node *root;
+    Node *current;
+    int index;
+}BSTIterator;
+
+/* Tree handle whose nodes come from slabs owned by the tree */
+typedef struct bst_tree{
+    Node *root;
+    struct node_slab *slabs;    /* Most recent slab first */
+    int slab_used;              /* Nodes handed out from the most recent slab */
+    Node *free_list;            /* Deleted nodes, linked through their right pointer */
+    long long size;
+}BSTree;
+
 Node *create_node(int value);
 void destroy_binary_search_tree(Node *root);
 Node *binary_insert(Node *root, int target);
@@ -14,5 +35,22 @@ Node *binary_search(Node *root, int target);
 Node *binary_search_recursive(Node *root, int target);
 int delete_node(Node **root, int target);
 
+BSTree *create_bst_tree(void);
+void destroy_bst_tree(BSTree *tree);
+Node *bst_insert(BSTree *tree, int value);
+Node *bst_search(BSTree *tree, int target);
+int bst_delete(BSTree *tree, int target);
+long long bst_size(BSTree *tree);
+
+Node *bst_select(Node *root, int k);
+int bst_rank(Node *root, int value);
+int bst_count_range(Node *root, int low, int high);
+void bst_iterator_seek(BSTIterator *iterator, Node *root, int value);
+int bst_iterator_next(BSTIterator *iterator, int *value);
+
+BSTree *bst_build_sorted(const int *values, int n);
+BSTree *bst_build_from_vector(Vector *vector);
+int bst_merge_sorted(BSTree *tree, const int *values, int n);
+
 
 #endif
\ No newline at end of file
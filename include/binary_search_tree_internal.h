@@ -0,0 +1,20 @@
+#ifndef BINARY_SEARCH_TREE_INTERNAL_H
+#define BINARY_SEARCH_TREE_INTERNAL_H
+
+#include "binary_search_tree.h"
+
+// Block of nodes carved out by the pooled tree; slabs form a singly linked list
+typedef struct node_slab{
+    struct node_slab *next;
+    int capacity;
+    Node nodes[];
+}NodeSlab;
+
+// Shared by delete_node and the pooled tree: they differ only in how nodes are released
+void bst_attach_node(Node *root, Node *node);
+Node *bst_unlink(Node **root, int target);
+
+// Writes the values in sorted order without recursion; returns the count
+int bst_flatten(Node *root, int *out);
+
+#endif
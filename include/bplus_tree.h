@@ -0,0 +1,56 @@
+#ifndef BPLUS_TREE_H
+#define BPLUS_TREE_H
+
+/*
+ * Nodes are sized in whole cache lines so one lookup touches one line-aligned
+ * node per level instead of one pointer per comparison. Key counts are
+ * multiples of 4 so in-node search can compare four keys per instruction.
+ */
+#define BPLUS_NODE_ALIGNMENT 64
+#define BPLUS_LEAF_KEYS 28      /* 256-byte leaves */
+#define BPLUS_INTERNAL_KEYS 40  /* 512-byte internal nodes */
+#define BPLUS_MAX_HEIGHT 32
+
+typedef struct bplus_node{
+    int count;      /* Number of keys in use */
+    int is_leaf;
+}BPlusNode;
+
+typedef struct bplus_leaf{
+    BPlusNode header;
+    struct bplus_leaf *next;    /* Next leaf in key order, for range scans */
+    int keys[BPLUS_LEAF_KEYS];
+    int values[BPLUS_LEAF_KEYS];
+}BPlusLeaf;
+
+typedef struct bplus_internal{
+    BPlusNode header;
+    int keys[BPLUS_INTERNAL_KEYS];
+    BPlusNode *children[BPLUS_INTERNAL_KEYS + 1];
+}BPlusInternal;
+
+typedef struct bplus_tree{
+    BPlusNode *root;
+    long long size;
+    int height;     /* Levels including the leaves */
+}BPlusTree;
+
+/* Position in the linked leaves; stays valid until the tree is modified */
+typedef struct bplus_iterator{
+    BPlusLeaf *leaf;
+    int index;
+}BPlusIterator;
+
+BPlusTree *create_bplus_tree(void);
+void destroy_bplus_tree(BPlusTree *tree);
+int bplus_insert(BPlusTree *tree, int key, int value);
+int bplus_search(BPlusTree *tree, int key, int *value);
+int bplus_delete(BPlusTree *tree, int key);
+long long bplus_size(BPlusTree *tree);
+long long bplus_memory_usage(BPlusTree *tree);
+void bplus_seek(BPlusTree *tree, int key, BPlusIterator *iterator);
+int bplus_next(BPlusIterator *iterator, int *key, int *value);
+long long bplus_range_count(BPlusTree *tree, int low, int high);
+
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef BPLUS_TREE_INTERNAL_H
+#define BPLUS_TREE_INTERNAL_H
+
+#include "bplus_tree.h"
+#include <stddef.h>
+
+// Allocates node memory with aligned_alloc semantics; nodes are released with free
+typedef void *(*BPlusAllocator)(size_t alignment, size_t size);
+
+// Replaces the node allocator, e.g. so tests can fail allocations; NULL restores aligned_alloc
+void bplus_set_allocator(BPlusAllocator allocator);
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef C_BIT_VECTOR_H
+#define C_BIT_VECTOR_H
+
+typedef struct bit_vector{
+    unsigned long long *words;     /* 64 bits per word, bit i lives in words[i / 64] */
+    long long size;                /* Number of bits */
+    long long word_count;
+    unsigned long long *rank_blocks;  /* Set bits before each 512-bit block, built lazily */
+    long long *select_samples;        /* Block holding every 512th set bit, built lazily */
+    long long ones;                   /* Total set bits when the index was built */
+    int index_valid;                  /* Cleared by every modification */
+}BitVector;
+
+BitVector *create_bit_vector(long long size);
+void destroy_bit_vector(BitVector *bits);
+void bit_vector_set(BitVector *bits, long long index);
+void bit_vector_clear(BitVector *bits, long long index);
+int bit_vector_get(BitVector *bits, long long index);
+int bit_vector_test_and_set(BitVector *bits, long long index);
+void bit_vector_reset(BitVector *bits);
+int bit_vector_and(BitVector *dst, BitVector *src);
+int bit_vector_or(BitVector *dst, BitVector *src);
+int bit_vector_andnot(BitVector *dst, BitVector *src);
+long long bit_vector_count(BitVector *bits);
+int bit_vector_build_index(BitVector *bits);
+long long bit_vector_rank(BitVector *bits, long long index);
+long long bit_vector_select(BitVector *bits, long long k);
+
+
+#endif
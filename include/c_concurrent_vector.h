@@ -0,0 +1,25 @@
+#ifndef C_CONCURRENT_VECTOR_H
+#define C_CONCURRENT_VECTOR_H
+
+#include <stdatomic.h>
+
+/* Segment k holds (1 << (CONCURRENT_VECTOR_FIRST_SEGMENT_BITS + k)) elements */
+#define CONCURRENT_VECTOR_FIRST_SEGMENT_BITS 10
+#define CONCURRENT_VECTOR_MAX_SEGMENTS 40
+
+typedef struct concurrent_vector{
+    _Atomic(int *) segments[CONCURRENT_VECTOR_MAX_SEGMENTS];   /* Never moved once allocated */
+    atomic_llong reserved;   /* Next index handed out to a producer */
+    atomic_llong size;       /* Number of published elements visible to readers */
+    atomic_int failed;       /* Set when a segment allocation fails */
+}ConcurrentVector;
+
+ConcurrentVector *create_concurrent_vector(void);
+void destroy_concurrent_vector(ConcurrentVector *vector);
+long long concurrent_current_size(ConcurrentVector *vector);
+long long concurrent_add_at_end(ConcurrentVector *vector, int value);
+int concurrent_get_value_at_index(ConcurrentVector *vector, long long index);
+const int *concurrent_vector_at(ConcurrentVector *vector, long long index);
+
+
+#endif
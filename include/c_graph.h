@@ -92,4 +92,236 @@ int* graph_dfs(c_graph_t* graph, int start_id, int* path_len);
  */
 int* graph_dijkstra(c_graph_t* graph, int start_id, int end_id, int* path_len);
 
+/**
+ * @brief Finds the shortest path with a bidirectional Dijkstra search.
+ *
+ * Searches forward from the start and backward from the end at the same time
+ * and stops when the two searches can no longer improve on the best path
+ * through a vertex reached by both. Same result contract as graph_dijkstra;
+ * edge weights must be non-negative.
+ *
+ * @param graph The graph (directed or undirected).
+ * @param start_id The starting vertex ID.
+ * @param end_id The ending vertex ID.
+ * @param path_len A pointer to store the length of the path.
+ * @return An array of vertex IDs representing the shortest path, or NULL if no path is found. The caller must free this array.
+ */
+int* graph_bidirectional_dijkstra(c_graph_t* graph, int start_id, int end_id, int* path_len);
+
+/**
+ * @brief Estimate of the remaining distance from a vertex to the goal, used by graph_astar.
+ *
+ * Must never overestimate. May return DBL_MAX for vertices that cannot reach the goal.
+ */
+typedef double (*graph_heuristic_fn)(int vertex_id, int end_id, void* ctx);
+
+/**
+ * @brief Finds the shortest path with A* search.
+ *
+ * Same result contract as graph_dijkstra; edge weights must be non-negative.
+ *
+ * @param graph The graph.
+ * @param start_id The starting vertex ID.
+ * @param end_id The ending vertex ID.
+ * @param heuristic Admissible distance estimate, or NULL to search like Dijkstra.
+ * @param ctx User data passed to the heuristic.
+ * @param path_len A pointer to store the length of the path.
+ * @return An array of vertex IDs representing the shortest path, or NULL if no path is found. The caller must free this array.
+ */
+int* graph_astar(c_graph_t* graph, int start_id, int end_id, graph_heuristic_fn heuristic, void* ctx, int* path_len);
+
+/**
+ * @brief Opaque table of precomputed landmark distances for the ALT heuristic.
+ */
+typedef struct c_graph_landmarks_t c_graph_landmarks_t;
+
+/**
+ * @brief Selects landmarks and precomputes distances to and from them.
+ *
+ * The table reflects the graph at the time of the call; rebuild it after changing the graph.
+ *
+ * @param graph The graph.
+ * @param count The number of landmarks (more give tighter bounds at count doubles per vertex).
+ * @return A pointer to the landmark table, or NULL on failure.
+ */
+c_graph_landmarks_t* graph_landmarks_create(c_graph_t* graph, int count);
+
+/**
+ * @brief Destroys a landmark table.
+ *
+ * @param landmarks The landmark table to destroy.
+ */
+void graph_landmarks_destroy(c_graph_landmarks_t* landmarks);
+
+/**
+ * @brief ALT heuristic for graph_astar; pass the landmark table as ctx.
+ *
+ * @param vertex_id The vertex to estimate from.
+ * @param end_id The goal vertex.
+ * @param landmarks The table returned by graph_landmarks_create.
+ * @return A lower bound on the distance, or DBL_MAX if vertex_id cannot reach end_id.
+ */
+double graph_landmark_heuristic(int vertex_id, int end_id, void* landmarks);
+
+/**
+ * @brief Opaque contraction hierarchy: a preprocessed graph for fast shortest-path queries.
+ */
+typedef struct c_graph_ch_t c_graph_ch_t;
+
+/**
+ * @brief Preprocesses a graph into a contraction hierarchy.
+ *
+ * Vertices are contracted one independent set at a time, adding shortcut
+ * edges that preserve shortest distances. The hierarchy reflects the graph at
+ * the time of the call; rebuild it after changing the graph. Edge weights
+ * must be non-negative.
+ *
+ * @param graph The graph (directed or undirected).
+ * @param threads The number of threads to use, or <= 0 for one per online CPU.
+ * @return A pointer to the hierarchy, or NULL on failure.
+ */
+c_graph_ch_t* graph_ch_build(c_graph_t* graph, int threads);
+
+/**
+ * @brief Destroys a contraction hierarchy.
+ *
+ * @param ch The hierarchy to destroy.
+ */
+void graph_ch_destroy(c_graph_ch_t* ch);
+
+/**
+ * @brief Finds the shortest path using a contraction hierarchy.
+ *
+ * Same result contract as graph_dijkstra; shortcuts are unpacked, so the
+ * path lists original vertices. Safe to call from several threads at once.
+ *
+ * @param ch The hierarchy.
+ * @param start_id The starting vertex ID.
+ * @param end_id The ending vertex ID.
+ * @param path_len A pointer to store the length of the path.
+ * @return An array of vertex IDs representing the shortest path, or NULL if no path is found. The caller must free this array.
+ */
+int* graph_ch_query(c_graph_ch_t* ch, int start_id, int end_id, int* path_len);
+
+/**
+ * @brief Writes a contraction hierarchy to a file.
+ *
+ * The format uses the machine's native byte order.
+ *
+ * @param ch The hierarchy.
+ * @param filename The path of the file to write.
+ * @return 0 on success, -1 on failure.
+ */
+int graph_ch_save(const c_graph_ch_t* ch, const char* filename);
+
+/**
+ * @brief Reads a contraction hierarchy written by graph_ch_save.
+ *
+ * @param filename The path of the file to read.
+ * @return A pointer to the hierarchy, or NULL if the file is missing or invalid.
+ */
+c_graph_ch_t* graph_ch_load(const char* filename);
+
+/**
+ * @brief Computes shortest distances from each source to each target.
+ *
+ * Runs one Dijkstra search per source in parallel, one thread per online
+ * CPU; each search stops once all targets are settled. Edge weights must be
+ * non-negative.
+ *
+ * @param graph The graph (directed or undirected).
+ * @param sources The source vertex IDs.
+ * @param n The number of sources.
+ * @param targets The target vertex IDs.
+ * @param m The number of targets.
+ * @param out An array of n * m doubles; out[i * m + j] receives the distance from sources[i] to targets[j], or DBL_MAX if unreachable.
+ * @return 0 on success, -1 if an ID is not a vertex or on failure.
+ */
+int graph_distance_matrix(c_graph_t* graph, const int* sources, int n, const int* targets, int m, double* out);
+
+/**
+ * @brief Opaque shortest-path tree: distances and predecessors of every vertex from one source.
+ */
+typedef struct c_graph_spt_t c_graph_spt_t;
+
+/**
+ * @brief Computes the shortest-path tree of a source with Dijkstra's algorithm.
+ *
+ * The tree reflects the graph at the time of the call. Edge weights must be non-negative.
+ *
+ * @param graph The graph (directed or undirected).
+ * @param source The source vertex ID.
+ * @return A pointer to the tree, or NULL if source is not a vertex or on failure.
+ */
+c_graph_spt_t* graph_spt_dijkstra(c_graph_t* graph, int source);
+
+/**
+ * @brief Computes the breadth-first tree of a source; distances count edges.
+ *
+ * @param graph The graph (directed or undirected).
+ * @param source The source vertex ID.
+ * @return A pointer to the tree, or NULL if source is not a vertex or on failure.
+ */
+c_graph_spt_t* graph_spt_bfs(c_graph_t* graph, int source);
+
+/**
+ * @brief Destroys a shortest-path tree.
+ *
+ * @param tree The tree to destroy.
+ */
+void graph_spt_destroy(c_graph_spt_t* tree);
+
+/**
+ * @brief Returns the source vertex of a tree.
+ *
+ * @param tree The tree.
+ * @return The source vertex ID, or -1 if tree is NULL.
+ */
+int graph_spt_source(const c_graph_spt_t* tree);
+
+/**
+ * @brief Returns the shortest distance from the source to a vertex.
+ *
+ * @param tree The tree.
+ * @param target The vertex ID.
+ * @return The distance, or DBL_MAX if target is unreachable or invalid.
+ */
+double graph_spt_distance(const c_graph_spt_t* tree, int target);
+
+/**
+ * @brief Returns the predecessor of a vertex on its shortest path from the source.
+ *
+ * @param tree The tree.
+ * @param target The vertex ID.
+ * @return The predecessor ID, or -1 for the source, unreachable and invalid vertices.
+ */
+int graph_spt_parent(const c_graph_spt_t* tree, int target);
+
+/**
+ * @brief Extracts the shortest path from the source to a vertex in O(path length).
+ *
+ * Same result contract as graph_dijkstra.
+ *
+ * @param tree The tree.
+ * @param target The destination vertex ID.
+ * @param path_len A pointer to store the length of the path.
+ * @return An array of vertex IDs representing the shortest path, or NULL if no path is found. The caller must free this array.
+ */
+int* graph_spt_path(const c_graph_spt_t* tree, int target, int* path_len);
+
+/**
+ * @brief Computes the shortest-path tree of a source with parallel delta-stepping.
+ *
+ * Vertices are grouped into buckets of width delta by tentative distance and
+ * each bucket is relaxed by all threads at once. Produces the same distances
+ * as graph_spt_dijkstra. Edge weights must be non-negative.
+ *
+ * @param graph The graph (directed or undirected).
+ * @param source The source vertex ID.
+ * @param delta The bucket width, or <= 0 for the average edge weight.
+ * @param threads The number of threads to use, or <= 0 for one per online CPU.
+ * @return A pointer to the tree, or NULL if source is not a vertex or on failure.
+ */
+c_graph_spt_t* graph_spt_delta_stepping(c_graph_t* graph, int source, double delta, int threads);
+
 #endif // C_GRAPH_H
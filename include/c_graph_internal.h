@@ -2,6 +2,7 @@
 #define C_GRAPH_INTERNAL_H
 
 #include "c_graph.h"
+#include <pthread.h>
 
 // Internal data structures
 typedef struct c_graph_edge_t {
@@ -16,9 +17,70 @@ typedef struct c_graph_vertex_t {
     struct c_graph_vertex_t* next;
 } c_graph_vertex_t;
 
+typedef struct c_graph_csr_t c_graph_csr_t;
+
 struct c_graph_t {
     int directed;
     c_graph_vertex_t* vertices;
+    c_graph_csr_t* csr[2];      // Cached forward and reverse CSR views, dropped on every change
+    pthread_mutex_t csr_lock;
+};
+
+// Compressed sparse row snapshot of a graph, indexed by vertex id.
+// The edges of id v are targets/weights[offsets[v] .. offsets[v + 1]).
+struct c_graph_csr_t {
+    int num_ids;            // Largest vertex id + 1
+    int num_edges;
+    int* offsets;           // num_ids + 1 entries
+    int* targets;
+    double* weights;
+    unsigned char* present; // 1 if the id is a vertex of the graph
 };
 
+c_graph_csr_t* graph_csr_build(c_graph_t* graph, int reverse);
+void graph_csr_destroy(c_graph_csr_t* csr);
+c_graph_csr_t* graph_csr_get(c_graph_t* graph, int reverse);
+void graph_csr_invalidate(c_graph_t* graph);
+int* graph_path_from_parents(const int* parent, int end_id, int* path_len);
+
+// Binary min-heap of vertex ids with decrease-key: position[id] is its heap
+// slot, GRAPH_HEAP_NEW if it was never pushed and GRAPH_HEAP_SETTLED once popped.
+#define GRAPH_HEAP_NEW (-1)
+#define GRAPH_HEAP_SETTLED (-2)
+
+typedef struct c_graph_heap_t {
+    int* ids;               // Heap-ordered vertex ids
+    double* keys;           // Key per vertex id
+    int* position;          // Heap slot per vertex id
+    int* touched;           // Ids pushed since the last reset
+    int size;
+    int touched_count;
+    int capacity;           // Number of vertex ids
+} c_graph_heap_t;
+
+c_graph_heap_t* graph_heap_create(int capacity);
+void graph_heap_destroy(c_graph_heap_t* heap);
+void graph_heap_reset(c_graph_heap_t* heap);
+int graph_heap_push(c_graph_heap_t* heap, int id, double key);
+int graph_heap_pop(c_graph_heap_t* heap);
+double graph_heap_min_key(const c_graph_heap_t* heap);
+
+void graph_csr_dijkstra(const c_graph_csr_t* csr, c_graph_heap_t* heap, int source, double* dist, int* parent);
+
+// Shortest-path tree shared by the single-source algorithms
+struct c_graph_spt_t {
+    int source;
+    int num_ids;
+    double* dist;   // DBL_MAX for ids the source does not reach
+    int* parent;    // -1 for the source and unreached ids
+};
+
+c_graph_spt_t* graph_spt_alloc(int source, int num_ids);
+
+// Thread count for parallel algorithms: threads itself if positive, otherwise the number of online CPUs
+int graph_thread_count(int threads);
+
+// Vertices settled by the last search on the calling thread, for benchmarks
+extern _Thread_local long long graph_settled_count;
+
 #endif // C_GRAPH_INTERNAL_H
@@ -0,0 +1,35 @@
+#ifndef C_MAPPED_VECTOR_H
+#define C_MAPPED_VECTOR_H
+
+#include "c_vector.h"
+
+/* On-disk header stored at the start of the backing file */
+typedef struct mapped_vector_header{
+    unsigned long long magic;
+    long long size;
+    long long capacity;
+    long long reserved[5];   /* Pads the header to 64 bytes */
+}MappedVectorHeader;
+
+typedef struct mapped_vector{
+    int fd;
+    void *map;                   /* Whole mapping: header followed by the elements */
+    unsigned long long map_length;
+    MappedVectorHeader *header;
+    int *collection;
+}MappedVector;
+
+MappedVector *open_mapped_vector(const char *path, long long capacity);
+void close_mapped_vector(MappedVector *vector);
+int mapped_vector_sync(MappedVector *vector);
+long long mapped_current_size(MappedVector *vector);
+long long mapped_current_capacity(MappedVector *vector);
+int mapped_add_at_end(MappedVector *vector, int value);
+int mapped_remove_at_end(MappedVector *vector);
+int mapped_resize_auto(MappedVector *vector);
+int mapped_get_value_at_index(MappedVector *vector, long long index);
+MappedVector *mapped_set_at_index(MappedVector *vector, long long index, int value);
+int mapped_vector_view(MappedVector *vector, Vector *view);
+
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef C_SMALL_VECTOR_H
+#define C_SMALL_VECTOR_H
+
+/* Number of elements stored inline before the vector spills to the heap */
+#ifndef SMALL_VECTOR_INLINE_CAPACITY
+#define SMALL_VECTOR_INLINE_CAPACITY 16
+#endif
+
+typedef struct small_vector{
+    int *heap;          /* NULL while the elements fit in inline_storage */
+    int capacity;
+    int size;
+    int inline_storage[SMALL_VECTOR_INLINE_CAPACITY];
+}SmallVector;
+
+void init_small_vector(SmallVector *vector);
+void free_small_vector(SmallVector *vector);
+SmallVector *create_small_vector(int capacity);
+void destroy_small_vector(SmallVector *vector);
+int *small_vector_data(SmallVector *vector);
+int small_current_size(SmallVector *vector);
+int small_current_capacity(SmallVector *vector);
+int small_isFull(SmallVector *vector);
+int small_add_at_end(SmallVector *vector, int value);
+int small_remove_at_end(SmallVector *vector);
+int small_resize_auto(SmallVector *vector);
+int small_get_value_at_index(SmallVector *vector, int index);
+SmallVector *small_set_at_index(SmallVector *vector, int index, int value);
+
+
+#endif
@@ -1,10 +1,28 @@
 #ifndef C_VECTOR_H
 #define C_VECTOR_H
 
+/* Buffers at least this large are allocated with mmap and grown with mremap */
+#ifndef VECTOR_MMAP_THRESHOLD
+#define VECTOR_MMAP_THRESHOLD (16 * 1024 * 1024)
+#endif
+
+/* Growth policies applied by resize_auto */
+typedef enum vector_growth{
+    VECTOR_GROWTH_DOUBLE,        /* 2x (default) */
+    VECTOR_GROWTH_ONE_AND_HALF,  /* 1.5x, wastes at most a third of the capacity */
+    VECTOR_GROWTH_SIZE_CLASS     /* 1.5x rounded up to the allocator's size class */
+}VectorGrowth;
+
+/* Bits of Vector::flags */
+#define VECTOR_FLAG_MAPPED 0x1       /* collection comes from mmap */
+#define VECTOR_FLAG_HUGE_PAGES 0x2   /* request transparent huge pages for mapped buffers */
+
 typedef struct vector{
     int *collection;
     int capacity;
     int size;
+    int growth;   /* VectorGrowth used by resize_auto */
+    int flags;
 }Vector;
 
 Vector *create_vector(int capacity);
@@ -17,6 +35,8 @@ int remove_at_end(Vector *vector);
 int resize_auto(Vector **vector);
 int get_value_at_index(Vector *vector, int index);
 Vector *set_at_index(Vector *vector, int index, int value);
+int vector_set_growth(Vector *vector, VectorGrowth growth);
+int vector_use_huge_pages(Vector *vector, int enable);
 
 
 #endif
\ No newline at end of file
@@ -0,0 +1,14 @@
+#ifndef C_VECTOR_SIMD_H
+#define C_VECTOR_SIMD_H
+
+#include "c_vector.h"
+
+long long vector_sum(Vector *vector);
+int vector_min_max(Vector *vector, int *min, int *max);
+int vector_find(Vector *vector, int value);
+int vector_count_eq(Vector *vector, int value);
+Vector *vector_filter(Vector *vector, int low, int high);
+const char *vector_simd_backend(void);
+
+
+#endif
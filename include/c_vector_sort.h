@@ -0,0 +1,20 @@
+#ifndef C_VECTOR_SORT_H
+#define C_VECTOR_SORT_H
+
+#include "c_vector.h"
+
+/* Comparator for introsort: negative if a < b, zero if equal, positive if a > b */
+typedef int (*int_compare_fn)(int a, int b);
+
+int radix_sort_ints(int *data, int n);
+void introsort_ints(int *data, int n, int_compare_fn compare);
+int parallel_merge_sort_ints(int *data, int n, int threads);
+int *argsort_ints(const int *data, int n);
+
+int vector_radix_sort(Vector *vector);
+int vector_introsort(Vector *vector, int_compare_fn compare);
+int vector_parallel_merge_sort(Vector *vector, int threads);
+int *vector_argsort(Vector *vector);
+
+
+#endif
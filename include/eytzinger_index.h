@@ -0,0 +1,24 @@
+#ifndef EYTZINGER_INDEX_H
+#define EYTZINGER_INDEX_H
+
+#include "binary_search_tree.h"
+
+/*
+ * Read-only sorted set stored in BFS order (keys[1] is the root, the children
+ * of keys[k] are keys[2k] and keys[2k + 1]). The top levels of every search
+ * share the same few cache lines, and the 16 descendants four levels below
+ * keys[k] are contiguous, so one prefetch per step hides most memory latency.
+ */
+typedef struct eytzinger_index{
+    int *keys;      /* 1-based, 64-byte aligned */
+    int size;
+}EytzingerIndex;
+
+EytzingerIndex *eytzinger_from_sorted(const int *values, int n);
+EytzingerIndex *bst_freeze(Node *root);
+void destroy_eytzinger_index(EytzingerIndex *index);
+int eytzinger_search(EytzingerIndex *index, int target);
+int eytzinger_lower_bound(EytzingerIndex *index, int target, int *value);
+
+
+#endif
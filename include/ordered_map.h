@@ -0,0 +1,40 @@
+#ifndef ORDERED_MAP_H
+#define ORDERED_MAP_H
+
+#include "avl_tree.h"
+
+/*
+ * AVL-balanced map from int keys to caller-owned payload pointers. In
+ * multiset mode each key is stored once with an occurrence count instead of
+ * one node per duplicate. Nodes start with an AvlNode whose value is the key,
+ * so the balancing code of avl_tree.c maintains their links and heights.
+ */
+typedef struct ordered_map_node{
+    AvlNode avl;            /* Must stay first; avl.value is the key */
+    long long count;        /* Occurrences of key; always 1 in map mode */
+    void *value;
+}OrderedMapNode;
+
+typedef struct ordered_map{
+    OrderedMapNode *root;
+    long long size;         /* Distinct keys */
+    long long total;        /* Sum of counts */
+    int multiset;
+}OrderedMap;
+
+typedef void (*ordered_map_free_fn)(void *value);
+typedef void (*ordered_map_visit_fn)(int key, void *value, long long count, void *context);
+
+OrderedMap *create_ordered_map(int multiset);
+void destroy_ordered_map(OrderedMap *map, ordered_map_free_fn free_value);
+int ordered_map_put(OrderedMap *map, int key, void *value, void **old_value);
+OrderedMapNode *ordered_map_find(OrderedMap *map, int key);
+void *ordered_map_get(OrderedMap *map, int key);
+long long ordered_map_count(OrderedMap *map, int key);
+int ordered_map_remove(OrderedMap *map, int key, void **value);
+long long ordered_map_size(OrderedMap *map);
+long long ordered_map_total(OrderedMap *map);
+long long ordered_map_range(OrderedMap *map, int low, int high, ordered_map_visit_fn visit, void *context);
+
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef PERSISTENT_TREE_H
+#define PERSISTENT_TREE_H
+
+#include <stdatomic.h>
+
+/*
+ * Immutable AVL node. Versions share unchanged subtrees, so a node is freed
+ * when the last version (or parent node) referencing it is released.
+ */
+typedef struct persistent_node{
+    int value;
+    int height;
+    atomic_int refs;
+    struct persistent_node *right;
+    struct persistent_node *left;
+}PersistentNode;
+
+/* One version of the tree; never modified after it is returned */
+typedef struct persistent_tree{
+    PersistentNode *root;
+    long long size;
+}PersistentTree;
+
+PersistentTree *create_persistent_tree(void);
+void destroy_persistent_tree(PersistentTree *version);
+PersistentTree *persistent_snapshot(PersistentTree *version);
+PersistentTree *persistent_insert(PersistentTree *version, int value);
+PersistentTree *persistent_delete(PersistentTree *version, int value, int *deleted);
+PersistentNode *persistent_search(PersistentTree *version, int target);
+long long persistent_size(PersistentTree *version);
+int persistent_height(PersistentTree *version);
+
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+#define SKIP_LIST_MAX_LEVEL 24
+#define SKIP_LIST_MAX_THREADS 64
+
+/*
+ * Next pointers carry a mark in their low bit: a marked next[i] means the node
+ * is logically deleted at level i. Marked nodes are unlinked by whichever
+ * thread walks past them next.
+ */
+typedef struct skip_list_node{
+    int key;
+    int level;
+    atomic_int owners;                  /* Insert and delete each release once; last one retires */
+    struct skip_list_node *retired_next;
+    _Atomic(uintptr_t) next[];
+}SkipListNode;
+
+/* Nodes retired during one epoch, freed two epochs later */
+typedef struct skip_list_limbo{
+    SkipListNode *nodes;
+    unsigned long long epoch;
+}SkipListLimbo;
+
+/*
+ * Per-thread handle: every operation runs inside an epoch critical section
+ * published through state ((epoch << 1) | 1 while active, 0 otherwise).
+ */
+typedef struct skip_list_handle{
+    struct skip_list *list;
+    atomic_int in_use;
+    _Atomic(unsigned long long) state;
+    SkipListLimbo limbo[3];
+    unsigned long long random_state;
+    int retired_since_collect;
+}SkipListHandle;
+
+typedef struct skip_list{
+    SkipListNode *head;                 /* Sentinel with SKIP_LIST_MAX_LEVEL levels */
+    _Atomic(unsigned long long) epoch;
+    atomic_llong size;
+    SkipListHandle handles[SKIP_LIST_MAX_THREADS];
+}SkipList;
+
+typedef void (*skip_list_visit_fn)(int key, void *context);
+
+SkipList *create_skip_list(void);
+void destroy_skip_list(SkipList *list);
+SkipListHandle *skip_list_attach(SkipList *list);
+void skip_list_detach(SkipListHandle *handle);
+int skip_list_insert(SkipListHandle *handle, int key);
+int skip_list_search(SkipListHandle *handle, int key);
+int skip_list_delete(SkipListHandle *handle, int key);
+long long skip_list_range(SkipListHandle *handle, int low, int high, skip_list_visit_fn visit, void *context);
+long long skip_list_size(SkipList *list);
+
+
+#endif
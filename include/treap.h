@@ -0,0 +1,37 @@
+#ifndef TREAP_H
+#define TREAP_H
+
+/*
+ * Treap ordered set with split/join primitives. Priorities are a hash of the
+ * key, so a set always has the same shape no matter how it was built, and
+ * set operations need no shared random state when run on several threads.
+ *
+ * Set operations consume their input trees and return the result; nodes that
+ * do not make it into the result are freed.
+ */
+typedef struct treap_node{
+    int key;
+    unsigned int priority;
+    int size;                   /* Nodes in this subtree */
+    struct treap_node *right;
+    struct treap_node *left;
+}TreapNode;
+
+TreapNode *treap_create_node(int key);
+void destroy_treap(TreapNode *root);
+int treap_insert(TreapNode **root, int key);
+int treap_delete(TreapNode **root, int key);
+TreapNode *treap_search(TreapNode *root, int key);
+int treap_size(TreapNode *root);
+
+TreapNode *treap_split(TreapNode *root, int key, TreapNode **less, TreapNode **greater);
+TreapNode *treap_join(TreapNode *less, TreapNode *greater);
+
+TreapNode *treap_union(TreapNode *a, TreapNode *b, int threads);
+TreapNode *treap_intersection(TreapNode *a, TreapNode *b, int threads);
+TreapNode *treap_difference(TreapNode *a, TreapNode *b, int threads);
+int treap_insert_batch(TreapNode **root, const int *keys, int n, int threads);
+int treap_delete_batch(TreapNode **root, const int *keys, int n, int threads);
+
+
+#endif
@@ -0,0 +1,773 @@
+#include "art_tree.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define ART_SIGN_FLIP 0x8000000000000000ull
+
+/* Leaves are tagged in the low bit of child pointers; both are malloc'd and at least 4-byte aligned */
+#define IS_LEAF(pointer) (((uintptr_t)(pointer)) & 1)
+#define AS_LEAF(pointer) ((ArtLeaf *)(((uintptr_t)(pointer)) & ~(uintptr_t)1))
+#define TAG_LEAF(leaf) ((ArtNode *)(((uintptr_t)(leaf)) | 1))
+
+/* Maps a signed key to one whose unsigned byte order matches signed order */
+static inline uint64_t encode_key(long long key){
+    return (uint64_t)key ^ ART_SIGN_FLIP;
+}
+
+static inline long long decode_key(uint64_t key){
+    return (long long)(key ^ ART_SIGN_FLIP);
+}
+
+/* Byte of key at depth, most significant first */
+static inline uint8_t key_byte(uint64_t key, int depth){
+    return (uint8_t)(key >> (8 * (ART_KEY_BYTES - 1 - depth)));
+}
+
+static ArtLeaf *create_leaf(uint64_t key, int value){
+    ArtLeaf *leaf = malloc(sizeof(ArtLeaf));
+    if (leaf == NULL) return NULL;
+    leaf->key = key;
+    leaf->value = value;
+    return leaf;
+}
+
+/*
+ * Function: create_node
+ * ---------------------
+ * Allocates a zeroed inner node of the given type, so unused child slots and
+ * Node48 index entries start out empty.
+ *
+ * returns: pointer to the node, or NULL on allocation failure
+ */
+static ArtNode *create_node(int type){
+    size_t bytes;
+    switch (type){
+        case ART_NODE4: bytes = sizeof(ArtNode4); break;
+        case ART_NODE16: bytes = sizeof(ArtNode16); break;
+        case ART_NODE48: bytes = sizeof(ArtNode48); break;
+        default: bytes = sizeof(ArtNode256); break;
+    }
+
+    ArtNode *node = calloc(1, bytes);
+    if (node == NULL) return NULL;
+    node->type = (uint8_t)type;
+    return node;
+}
+
+/* Copies the prefix and child count of one node header into another */
+static void copy_header(ArtNode *destination, const ArtNode *source){
+    destination->prefix_len = source->prefix_len;
+    destination->count = source->count;
+    memcpy(destination->prefix, source->prefix, ART_KEY_BYTES);
+}
+
+/*
+ * Function: find_child
+ * --------------------
+ * Looks up the child slot for a key byte. Node16 compares all 16 key bytes
+ * in one SSE2 instruction and takes the first match from the bit mask.
+ *
+ * node: inner node
+ * byte: key byte at the node's depth
+ *
+ * returns: pointer to the child slot, or NULL if there is no such child
+ */
+static ArtNode **find_child(ArtNode *node, uint8_t byte){
+    switch (node->type){
+        case ART_NODE4:{
+            ArtNode4 *n = (ArtNode4 *)node;
+            for (int i = 0; i < node->count; i++){
+                if (n->keys[i] == byte) return &n->children[i];
+            }
+            return NULL;
+        }
+        case ART_NODE16:{
+            ArtNode16 *n = (ArtNode16 *)node;
+#ifdef __SSE2__
+            __m128i match = _mm_cmpeq_epi8(_mm_set1_epi8((char)byte), _mm_loadu_si128((const __m128i *)n->keys));
+            int mask = _mm_movemask_epi8(match) & ((1 << node->count) - 1);
+            return (mask != 0) ? &n->children[__builtin_ctz(mask)] : NULL;
+#else
+            for (int i = 0; i < node->count; i++){
+                if (n->keys[i] == byte) return &n->children[i];
+            }
+            return NULL;
+#endif
+        }
+        case ART_NODE48:{
+            ArtNode48 *n = (ArtNode48 *)node;
+            return (n->index[byte] != 0) ? &n->children[n->index[byte] - 1] : NULL;
+        }
+        default:{
+            ArtNode256 *n = (ArtNode256 *)node;
+            return (n->children[byte] != NULL) ? &n->children[byte] : NULL;
+        }
+    }
+}
+
+/* Inserts a child into the sorted key array of a Node4 or Node16 with room for it */
+static void sorted_insert(uint8_t *keys, ArtNode **children, int count, uint8_t byte, ArtNode *child){
+    int position = 0;
+    while (position < count && keys[position] < byte) position++;
+
+    memmove(keys + position + 1, keys + position, (size_t)(count - position));
+    memmove(children + position + 1, children + position, sizeof(ArtNode *) * (size_t)(count - position));
+    keys[position] = byte;
+    children[position] = child;
+}
+
+/*
+ * Function: grow_node
+ * -------------------
+ * Copies a full node into the next larger type.
+ *
+ * returns: the larger node, or NULL on allocation failure (node is unchanged)
+ */
+static ArtNode *grow_node(ArtNode *node){
+    switch (node->type){
+        case ART_NODE4:{
+            ArtNode4 *old = (ArtNode4 *)node;
+            ArtNode16 *n = (ArtNode16 *)create_node(ART_NODE16);
+            if (n == NULL) return NULL;
+            copy_header(&n->header, node);
+            memcpy(n->keys, old->keys, 4);
+            memcpy(n->children, old->children, sizeof(old->children));
+            return &n->header;
+        }
+        case ART_NODE16:{
+            ArtNode16 *old = (ArtNode16 *)node;
+            ArtNode48 *n = (ArtNode48 *)create_node(ART_NODE48);
+            if (n == NULL) return NULL;
+            copy_header(&n->header, node);
+            for (int i = 0; i < 16; i++){
+                n->index[old->keys[i]] = (uint8_t)(i + 1);
+                n->children[i] = old->children[i];
+            }
+            return &n->header;
+        }
+        default:{
+            ArtNode48 *old = (ArtNode48 *)node;
+            ArtNode256 *n = (ArtNode256 *)create_node(ART_NODE256);
+            if (n == NULL) return NULL;
+            copy_header(&n->header, node);
+            for (int b = 0; b < 256; b++){
+                if (old->index[b] != 0) n->children[b] = old->children[old->index[b] - 1];
+            }
+            return &n->header;
+        }
+    }
+}
+
+/*
+ * Function: add_child
+ * -------------------
+ * Adds a child under a key byte that is not yet present, replacing the node
+ * in its parent slot with a larger type first if it is full.
+ *
+ * ref: parent slot holding node
+ * node: inner node
+ * byte: key byte of the new child
+ * child: child to add
+ *
+ * returns: 1 if successful, -1 on allocation failure (the tree is unchanged)
+ */
+static int add_child(ArtNode **ref, ArtNode *node, uint8_t byte, ArtNode *child){
+    static const int capacity[] = {4, 16, 48, 256};
+
+    if (node->count == capacity[node->type]){
+        ArtNode *larger = grow_node(node);
+        if (larger == NULL) return -1;
+        free(node);
+        *ref = node = larger;
+    }
+
+    switch (node->type){
+        case ART_NODE4:{
+            ArtNode4 *n = (ArtNode4 *)node;
+            sorted_insert(n->keys, n->children, node->count, byte, child);
+            break;
+        }
+        case ART_NODE16:{
+            ArtNode16 *n = (ArtNode16 *)node;
+            sorted_insert(n->keys, n->children, node->count, byte, child);
+            break;
+        }
+        case ART_NODE48:{
+            /* Slots are freed in place by deletes, so take the first empty one */
+            ArtNode48 *n = (ArtNode48 *)node;
+            int slot = 0;
+            while (n->children[slot] != NULL) slot++;
+            n->children[slot] = child;
+            n->index[byte] = (uint8_t)(slot + 1);
+            break;
+        }
+        default:
+            ((ArtNode256 *)node)->children[byte] = child;
+            break;
+    }
+
+    node->count++;
+    return 1;
+}
+
+/*
+ * Function: shrink_node
+ * ---------------------
+ * Copies an underfull node into the next smaller type. The thresholds leave
+ * slack below each capacity so alternating inserts and deletes at a boundary
+ * do not resize on every operation.
+ *
+ * returns: the smaller node, or node itself if no shrink is due or allocation fails
+ */
+static ArtNode *shrink_node(ArtNode *node){
+    switch (node->type){
+        case ART_NODE16:{
+            if (node->count > 3) return node;
+            ArtNode16 *old = (ArtNode16 *)node;
+            ArtNode4 *n = (ArtNode4 *)create_node(ART_NODE4);
+            if (n == NULL) return node;
+            copy_header(&n->header, node);
+            memcpy(n->keys, old->keys, node->count);
+            memcpy(n->children, old->children, sizeof(ArtNode *) * node->count);
+            free(node);
+            return &n->header;
+        }
+        case ART_NODE48:{
+            if (node->count > 12) return node;
+            ArtNode48 *old = (ArtNode48 *)node;
+            ArtNode16 *n = (ArtNode16 *)create_node(ART_NODE16);
+            if (n == NULL) return node;
+            copy_header(&n->header, node);
+            int count = 0;
+            for (int b = 0; b < 256; b++){
+                if (old->index[b] == 0) continue;
+                n->keys[count] = (uint8_t)b;
+                n->children[count++] = old->children[old->index[b] - 1];
+            }
+            free(node);
+            return &n->header;
+        }
+        case ART_NODE256:{
+            if (node->count > 37) return node;
+            ArtNode256 *old = (ArtNode256 *)node;
+            ArtNode48 *n = (ArtNode48 *)create_node(ART_NODE48);
+            if (n == NULL) return node;
+            copy_header(&n->header, node);
+            int count = 0;
+            for (int b = 0; b < 256; b++){
+                if (old->children[b] == NULL) continue;
+                n->children[count] = old->children[b];
+                n->index[b] = (uint8_t)(++count);
+            }
+            free(node);
+            return &n->header;
+        }
+        default:
+            return node;
+    }
+}
+
+/*
+ * Function: remove_child
+ * ----------------------
+ * Removes the child under a key byte, then shrinks the node or, if a Node4 is
+ * left with one child, replaces it by that child. An inner child absorbs the
+ * node's prefix and key byte into its own prefix.
+ *
+ * ref: parent slot holding node
+ * node: inner node
+ * byte: key byte of the child to remove
+ */
+static void remove_child(ArtNode **ref, ArtNode *node, uint8_t byte){
+    switch (node->type){
+        case ART_NODE4:
+        case ART_NODE16:{
+            uint8_t *keys = (node->type == ART_NODE4) ? ((ArtNode4 *)node)->keys : ((ArtNode16 *)node)->keys;
+            ArtNode **children = (node->type == ART_NODE4) ? ((ArtNode4 *)node)->children : ((ArtNode16 *)node)->children;
+            int position = 0;
+            while (keys[position] != byte) position++;
+            int after = node->count - position - 1;
+            memmove(keys + position, keys + position + 1, (size_t)after);
+            memmove(children + position, children + position + 1, sizeof(ArtNode *) * (size_t)after);
+            break;
+        }
+        case ART_NODE48:{
+            ArtNode48 *n = (ArtNode48 *)node;
+            n->children[n->index[byte] - 1] = NULL;
+            n->index[byte] = 0;
+            break;
+        }
+        default:
+            ((ArtNode256 *)node)->children[byte] = NULL;
+            break;
+    }
+    node->count--;
+
+    if (node->type == ART_NODE4 && node->count == 1){
+        ArtNode4 *n = (ArtNode4 *)node;
+        ArtNode *child = n->children[0];
+        if (!IS_LEAF(child)){
+            /* Full keys are ART_KEY_BYTES long, so the merged prefix always fits */
+            uint8_t prefix[ART_KEY_BYTES];
+            int length = node->prefix_len;
+            memcpy(prefix, node->prefix, length);
+            prefix[length++] = n->keys[0];
+            memcpy(prefix + length, child->prefix, child->prefix_len);
+            length += child->prefix_len;
+            memcpy(child->prefix, prefix, length);
+            child->prefix_len = (uint8_t)length;
+        }
+        free(node);
+        *ref = child;
+        return;
+    }
+
+    *ref = shrink_node(node);
+}
+
+/* Number of prefix bytes of node that match key from depth on */
+static int prefix_match(const ArtNode *node, uint64_t key, int depth){
+    int i = 0;
+    while (i < node->prefix_len && node->prefix[i] == key_byte(key, depth + i)) i++;
+    return i;
+}
+
+/*
+ * Function: split_leaf
+ * --------------------
+ * Replaces a leaf slot with a Node4 holding the existing leaf and a new one,
+ * prefixed by the key bytes the two keys share below depth.
+ *
+ * returns: 1 if successful, -1 on allocation failure (the tree is unchanged)
+ */
+static int split_leaf(ArtNode **ref, uint64_t key, int value, int depth){
+    ArtLeaf *existing = AS_LEAF(*ref);
+    ArtLeaf *leaf = create_leaf(key, value);
+    ArtNode4 *n = (ArtNode4 *)create_node(ART_NODE4);
+    if (leaf == NULL || n == NULL){
+        free(leaf);
+        free(n);
+        return -1;
+    }
+
+    int length = 0;
+    while (key_byte(existing->key, depth + length) == key_byte(key, depth + length)){
+        n->header.prefix[length] = key_byte(key, depth + length);
+        length++;
+    }
+    n->header.prefix_len = (uint8_t)length;
+
+    int branch = depth + length;
+    n->header.count = 2;
+    sorted_insert(n->keys, n->children, 0, key_byte(existing->key, branch), *ref);
+    sorted_insert(n->keys, n->children, 1, key_byte(key, branch), TAG_LEAF(leaf));
+    *ref = &n->header;
+    return 1;
+}
+
+/*
+ * Function: split_prefix
+ * ----------------------
+ * Inserts a new Node4 above an inner node whose prefix differs from key at
+ * position mismatch. The new node keeps the shared part of the prefix; the old
+ * node keeps what follows the branching byte.
+ *
+ * returns: 1 if successful, -1 on allocation failure (the tree is unchanged)
+ */
+static int split_prefix(ArtNode **ref, uint64_t key, int value, int depth, int mismatch){
+    ArtNode *node = *ref;
+    ArtLeaf *leaf = create_leaf(key, value);
+    ArtNode4 *n = (ArtNode4 *)create_node(ART_NODE4);
+    if (leaf == NULL || n == NULL){
+        free(leaf);
+        free(n);
+        return -1;
+    }
+
+    memcpy(n->header.prefix, node->prefix, mismatch);
+    n->header.prefix_len = (uint8_t)mismatch;
+    n->header.count = 2;
+    sorted_insert(n->keys, n->children, 0, node->prefix[mismatch], node);
+    sorted_insert(n->keys, n->children, 1, key_byte(key, depth + mismatch), TAG_LEAF(leaf));
+
+    int remaining = node->prefix_len - mismatch - 1;
+    memmove(node->prefix, node->prefix + mismatch + 1, remaining);
+    node->prefix_len = (uint8_t)remaining;
+
+    *ref = &n->header;
+    return 1;
+}
+
+/*
+ * Function: insert_key
+ * --------------------
+ * Descends from a slot at depth and inserts or updates key.
+ *
+ * returns: 1 if inserted, 0 if the key existed and its value was updated, -1 on allocation failure
+ */
+static int insert_key(ArtNode **ref, uint64_t key, int value, int depth){
+    while (1){
+        ArtNode *node = *ref;
+
+        if (node == NULL){
+            ArtLeaf *leaf = create_leaf(key, value);
+            if (leaf == NULL) return -1;
+            *ref = TAG_LEAF(leaf);
+            return 1;
+        }
+
+        if (IS_LEAF(node)){
+            ArtLeaf *leaf = AS_LEAF(node);
+            if (leaf->key == key){
+                leaf->value = value;
+                return 0;
+            }
+            return split_leaf(ref, key, value, depth);
+        }
+
+        int matched = prefix_match(node, key, depth);
+        if (matched < node->prefix_len) return split_prefix(ref, key, value, depth, matched);
+        depth += node->prefix_len;
+
+        uint8_t byte = key_byte(key, depth);
+        ArtNode **child = find_child(node, byte);
+        if (child == NULL){
+            ArtLeaf *leaf = create_leaf(key, value);
+            if (leaf == NULL) return -1;
+            if (add_child(ref, node, byte, TAG_LEAF(leaf)) != 1){
+                free(leaf);
+                return -1;
+            }
+            return 1;
+        }
+
+        ref = child;
+        depth++;
+    }
+}
+
+/* Frees a subtree; recursion depth is at most ART_KEY_BYTES */
+static void free_subtree(ArtNode *node){
+    if (node == NULL) return;
+    if (IS_LEAF(node)){
+        free(AS_LEAF(node));
+        return;
+    }
+
+    switch (node->type){
+        case ART_NODE4:
+            for (int i = 0; i < node->count; i++) free_subtree(((ArtNode4 *)node)->children[i]);
+            break;
+        case ART_NODE16:
+            for (int i = 0; i < node->count; i++) free_subtree(((ArtNode16 *)node)->children[i]);
+            break;
+        case ART_NODE48:
+            for (int i = 0; i < 48; i++) free_subtree(((ArtNode48 *)node)->children[i]);
+            break;
+        default:
+            for (int i = 0; i < 256; i++) free_subtree(((ArtNode256 *)node)->children[i]);
+            break;
+    }
+    free(node);
+}
+
+/*
+ * Function: create_art_tree
+ * -------------------------
+ * Creates an empty tree.
+ *
+ * returns: pointer to the tree, or NULL on allocation failure
+ */
+ArtTree *create_art_tree(void){
+    ArtTree *tree = malloc(sizeof(ArtTree));
+    if (tree == NULL) return NULL;
+
+    tree->root = NULL;
+    tree->size = 0;
+    return tree;
+}
+
+/*
+ * Function: destroy_art_tree
+ * --------------------------
+ * Frees all nodes and leaves, then the tree.
+ *
+ * tree: pointer to the ArtTree to destroy
+ *
+ * returns: void
+ */
+void destroy_art_tree(ArtTree *tree){
+    if (tree == NULL) return;
+    free_subtree(tree->root);
+    free(tree);
+}
+
+/*
+ * Function: art_insert
+ * --------------------
+ * Inserts a key with a value, or updates the value if the key exists.
+ *
+ * tree: pointer to the ArtTree
+ * key: key to insert
+ * value: value to store
+ *
+ * returns: 1 if inserted, 0 if updated, -1 on failure
+ */
+int art_insert(ArtTree *tree, long long key, int value){
+    if (tree == NULL) return -1;
+
+    int status = insert_key(&tree->root, encode_key(key), value, 0);
+    if (status == 1) tree->size++;
+    return status;
+}
+
+/*
+ * Function: art_search
+ * --------------------
+ * Looks up a key. Each level costs one node visit, and prefixes let dense
+ * key sets skip the levels where all keys agree.
+ *
+ * tree: pointer to the ArtTree
+ * key: key to look up
+ * value: receives the value if found (may be NULL)
+ *
+ * returns: 1 if found, 0 otherwise
+ */
+int art_search(ArtTree *tree, long long key, int *value){
+    if (tree == NULL) return 0;
+
+    uint64_t encoded = encode_key(key);
+    ArtNode *node = tree->root;
+    int depth = 0;
+
+    while (node != NULL){
+        if (IS_LEAF(node)){
+            ArtLeaf *leaf = AS_LEAF(node);
+            if (leaf->key != encoded) return 0;
+            if (value != NULL) *value = leaf->value;
+            return 1;
+        }
+
+        if (prefix_match(node, encoded, depth) != node->prefix_len) return 0;
+        depth += node->prefix_len;
+
+        ArtNode **child = find_child(node, key_byte(encoded, depth));
+        if (child == NULL) return 0;
+        node = *child;
+        depth++;
+    }
+    return 0;
+}
+
+/*
+ * Function: art_delete
+ * --------------------
+ * Removes a key, shrinking or collapsing the nodes on its path as needed.
+ *
+ * tree: pointer to the ArtTree
+ * key: key to delete
+ *
+ * returns: 1 if deleted, 0 if not found
+ */
+int art_delete(ArtTree *tree, long long key){
+    if (tree == NULL || tree->root == NULL) return 0;
+
+    uint64_t encoded = encode_key(key);
+    ArtNode **ref = &tree->root;
+    int depth = 0;
+
+    if (IS_LEAF(*ref)){
+        if (AS_LEAF(*ref)->key != encoded) return 0;
+        free(AS_LEAF(*ref));
+        *ref = NULL;
+        tree->size--;
+        return 1;
+    }
+
+    while (1){
+        ArtNode *node = *ref;
+        if (prefix_match(node, encoded, depth) != node->prefix_len) return 0;
+        depth += node->prefix_len;
+
+        uint8_t byte = key_byte(encoded, depth);
+        ArtNode **child = find_child(node, byte);
+        if (child == NULL) return 0;
+
+        if (IS_LEAF(*child)){
+            ArtLeaf *leaf = AS_LEAF(*child);
+            if (leaf->key != encoded) return 0;
+            free(leaf);
+            remove_child(ref, node, byte);
+            tree->size--;
+            return 1;
+        }
+
+        ref = child;
+        depth++;
+    }
+}
+
+/*
+ * Function: art_size
+ * ------------------
+ * Returns the number of keys in the tree.
+ *
+ * tree: pointer to the ArtTree
+ *
+ * returns: number of keys, or -1 if tree is NULL
+ */
+long long art_size(ArtTree *tree){
+    if (tree == NULL) return -1;
+    return tree->size;
+}
+
+/* Bytes used by a subtree's nodes and leaves */
+static long long subtree_memory(ArtNode *node){
+    if (node == NULL) return 0;
+    if (IS_LEAF(node)) return sizeof(ArtLeaf);
+
+    long long bytes = 0;
+    switch (node->type){
+        case ART_NODE4:
+            bytes = sizeof(ArtNode4);
+            for (int i = 0; i < node->count; i++) bytes += subtree_memory(((ArtNode4 *)node)->children[i]);
+            break;
+        case ART_NODE16:
+            bytes = sizeof(ArtNode16);
+            for (int i = 0; i < node->count; i++) bytes += subtree_memory(((ArtNode16 *)node)->children[i]);
+            break;
+        case ART_NODE48:
+            bytes = sizeof(ArtNode48);
+            for (int i = 0; i < 48; i++) bytes += subtree_memory(((ArtNode48 *)node)->children[i]);
+            break;
+        default:
+            bytes = sizeof(ArtNode256);
+            for (int i = 0; i < 256; i++) bytes += subtree_memory(((ArtNode256 *)node)->children[i]);
+            break;
+    }
+    return bytes;
+}
+
+/*
+ * Function: art_memory_usage
+ * --------------------------
+ * Computes the memory held by the tree's nodes and leaves.
+ *
+ * tree: pointer to the ArtTree
+ *
+ * returns: number of bytes, or -1 if tree is NULL
+ */
+long long art_memory_usage(ArtTree *tree){
+    if (tree == NULL) return -1;
+    return sizeof(ArtTree) + subtree_memory(tree->root);
+}
+
+typedef struct range_scan{
+    uint64_t low;
+    uint64_t high;
+    art_visit_fn visit;
+    void *context;
+    long long count;
+}RangeScan;
+
+static void scan_subtree(ArtNode *node, uint64_t path, int depth, RangeScan *scan);
+
+/*
+ * Function: scan_child
+ * --------------------
+ * Visits the child under a key byte if its key range can overlap the scan.
+ *
+ * returns: 0 once the child starts above the scan's upper bound, 1 otherwise
+ */
+static int scan_child(ArtNode *child, uint64_t path, int depth, uint8_t byte, RangeScan *scan){
+    int shift = 8 * (ART_KEY_BYTES - 1 - depth);
+    uint64_t first = path | ((uint64_t)byte << shift);
+    uint64_t last = first | (((uint64_t)1 << shift) - 1);
+
+    if (first > scan->high) return 0;
+    if (last >= scan->low) scan_subtree(child, first, depth + 1, scan);
+    return 1;
+}
+
+/*
+ * Function: scan_subtree
+ * ----------------------
+ * Visits keys in [low, high] in ascending order. path holds the key bytes
+ * above depth; children are walked in byte order and skipped when their
+ * whole key range lies outside the scan.
+ */
+static void scan_subtree(ArtNode *node, uint64_t path, int depth, RangeScan *scan){
+    if (IS_LEAF(node)){
+        ArtLeaf *leaf = AS_LEAF(node);
+        if (leaf->key >= scan->low && leaf->key <= scan->high){
+            if (scan->visit != NULL) scan->visit(decode_key(leaf->key), leaf->value, scan->context);
+            scan->count++;
+        }
+        return;
+    }
+
+    for (int i = 0; i < node->prefix_len; i++){
+        path |= (uint64_t)node->prefix[i] << (8 * (ART_KEY_BYTES - 1 - depth - i));
+    }
+    depth += node->prefix_len;
+
+    switch (node->type){
+        case ART_NODE4:{
+            ArtNode4 *n = (ArtNode4 *)node;
+            for (int i = 0; i < node->count; i++){
+                if (!scan_child(n->children[i], path, depth, n->keys[i], scan)) return;
+            }
+            break;
+        }
+        case ART_NODE16:{
+            ArtNode16 *n = (ArtNode16 *)node;
+            for (int i = 0; i < node->count; i++){
+                if (!scan_child(n->children[i], path, depth, n->keys[i], scan)) return;
+            }
+            break;
+        }
+        case ART_NODE48:{
+            ArtNode48 *n = (ArtNode48 *)node;
+            for (int b = 0; b < 256; b++){
+                if (n->index[b] == 0) continue;
+                if (!scan_child(n->children[n->index[b] - 1], path, depth, (uint8_t)b, scan)) return;
+            }
+            break;
+        }
+        default:{
+            ArtNode256 *n = (ArtNode256 *)node;
+            for (int b = 0; b < 256; b++){
+                if (n->children[b] == NULL) continue;
+                if (!scan_child(n->children[b], path, depth, (uint8_t)b, scan)) return;
+            }
+            break;
+        }
+    }
+}
+
+/*
+ * Function: art_range
+ * -------------------
+ * Visits every key in [low, high] in ascending order. Use LLONG_MIN and
+ * LLONG_MAX to iterate over the whole tree.
+ *
+ * tree: pointer to the ArtTree
+ * low: smallest key to visit
+ * high: largest key to visit
+ * visit: called with each key, its value and context (may be NULL to only count)
+ * context: passed through to visit
+ *
+ * returns: number of keys visited, or -1 if tree is NULL
+ */
+long long art_range(ArtTree *tree, long long low, long long high, art_visit_fn visit, void *context){
+    if (tree == NULL) return -1;
+    if (low > high || tree->root == NULL) return 0;
+
+    RangeScan scan = {encode_key(low), encode_key(high), visit, context, 0};
+    scan_subtree(tree->root, 0, 0, &scan);
+    return scan.count;
+}
@@ -0,0 +1,232 @@
+#include "c_graph_internal.h"
+#include "c_graph.h"
+#include <stdlib.h>
+#include <float.h>
+
+/*
+ * Landmark distances are stored vertex-major, so evaluating the heuristic for
+ * a pair of vertices reads two contiguous rows of count entries each.
+ */
+struct c_graph_landmarks_t {
+    int count;
+    int num_ids;
+    double* from;   // from[v * count + i]: distance from landmark i to v
+    double* to;     // to[v * count + i]: distance from v to landmark i (aliases from when undirected)
+};
+
+/*
+ * Function: graph_astar
+ * ---------------------
+ * Finds the shortest path between start_id and end_id with A*: vertices are
+ * expanded in order of distance from the start plus the heuristic's estimate
+ * of the distance left, so the search heads toward the end instead of
+ * growing a ball around the start. The heuristic must never overestimate;
+ * if it is also consistent every vertex is expanded at most once, otherwise
+ * vertices are reopened when a shorter route to them turns up.
+ *
+ * graph: pointer to the graph structure
+ * start_id: ID of the starting vertex
+ * end_id: ID of the destination vertex
+ * heuristic: lower bound on the distance from a vertex to end_id (NULL for plain Dijkstra);
+ *            may return DBL_MAX for vertices known not to reach end_id
+ * ctx: passed through to the heuristic
+ * path_len: pointer to an integer to store the length of the path
+ *
+ * returns: array of vertex IDs representing the shortest path
+ *          or NULL if no path exists or input is invalid
+ */
+int* graph_astar(c_graph_t* graph, int start_id, int end_id, graph_heuristic_fn heuristic, void* ctx, int* path_len) {
+    if (!path_len) return NULL;
+    *path_len = 0;
+    graph_settled_count = 0;
+
+    c_graph_csr_t* csr = graph_csr_get(graph, 0);
+    if (!csr) return NULL;
+    if (start_id < 0 || start_id >= csr->num_ids || !csr->present[start_id]) return NULL;
+    if (end_id < 0 || end_id >= csr->num_ids || !csr->present[end_id]) return NULL;
+
+    int n = csr->num_ids;
+    c_graph_heap_t* heap = graph_heap_create(n);
+    double* dist = (double*)malloc(n * sizeof(double));
+    int* parent = (int*)malloc(n * sizeof(int));
+    if (!heap || !dist || !parent) {
+        graph_heap_destroy(heap);
+        free(dist);
+        free(parent);
+        return NULL;
+    }
+
+    for (int i = 0; i < n; i++) {
+        dist[i] = DBL_MAX;
+        parent[i] = -1;
+    }
+    dist[start_id] = 0;
+    graph_heap_push(heap, start_id, heuristic ? heuristic(start_id, end_id, ctx) : 0);
+
+    int u;
+    while ((u = graph_heap_pop(heap)) != -1) {
+        graph_settled_count++;
+        if (u == end_id) break; // Every queued estimate is at least dist[end_id] now
+
+        for (int i = csr->offsets[u]; i < csr->offsets[u + 1]; i++) {
+            int v = csr->targets[i];
+            double candidate = dist[u] + csr->weights[i];
+            if (candidate >= dist[v]) continue;
+
+            double remaining = heuristic ? heuristic(v, end_id, ctx) : 0;
+            if (remaining == DBL_MAX) continue; // v cannot reach the end
+            dist[v] = candidate;
+            parent[v] = u;
+            graph_heap_push(heap, v, candidate + remaining);
+        }
+    }
+
+    int* path = NULL;
+    if (dist[end_id] != DBL_MAX) {
+        path = graph_path_from_parents(parent, end_id, path_len);
+    }
+
+    graph_heap_destroy(heap);
+    free(dist);
+    free(parent);
+    return path;
+}
+
+/*
+ * Function: graph_landmarks_create
+ * --------------------------------
+ * Precomputes ALT landmark distances. Landmarks are picked one at a time as
+ * the vertex farthest from all landmarks chosen so far, which spreads them
+ * toward the edges of the graph where their bounds are tightest; vertices
+ * not reached from any landmark yet are picked first, so every component
+ * gets one. Each landmark costs one full Dijkstra search, two for directed
+ * graphs. The result describes the graph at the time of the call.
+ *
+ * graph: pointer to the graph structure
+ * count: number of landmarks (clamped to the number of vertices)
+ *
+ * returns: pointer to the landmark table, or NULL if the graph is empty, count < 1 or allocation fails
+ */
+c_graph_landmarks_t* graph_landmarks_create(c_graph_t* graph, int count) {
+    if (count < 1) return NULL;
+    c_graph_csr_t* forward = graph_csr_get(graph, 0);
+    c_graph_csr_t* backward = graph_csr_get(graph, 1);
+    if (!forward || !backward) return NULL;
+
+    int n = forward->num_ids;
+    int vertices = 0;
+    int first = -1;
+    for (int v = 0; v < n; v++) {
+        if (!forward->present[v]) continue;
+        if (first == -1) first = v;
+        vertices++;
+    }
+    if (count > vertices) count = vertices;
+
+    c_graph_landmarks_t* landmarks = (c_graph_landmarks_t*)malloc(sizeof(c_graph_landmarks_t));
+    c_graph_heap_t* heap = graph_heap_create(n);
+    double* dist = (double*)malloc(n * sizeof(double));
+    double* nearest = (double*)malloc(n * sizeof(double)); // Distance to the closest chosen landmark
+    if (landmarks) {
+        landmarks->count = count;
+        landmarks->num_ids = n;
+        landmarks->from = (double*)malloc((size_t)n * count * sizeof(double));
+        landmarks->to = graph->directed ? (double*)malloc((size_t)n * count * sizeof(double)) : landmarks->from;
+    }
+    if (!landmarks || !heap || !dist || !nearest || !landmarks->from || !landmarks->to) {
+        graph_landmarks_destroy(landmarks);
+        graph_heap_destroy(heap);
+        free(dist);
+        free(nearest);
+        return NULL;
+    }
+
+    // Start from the vertex farthest from an arbitrary one
+    graph_csr_dijkstra(forward, heap, first, dist, NULL);
+    int landmark = first;
+    for (int v = 0; v < n; v++) {
+        if (forward->present[v] && dist[v] != DBL_MAX && dist[v] > dist[landmark]) landmark = v;
+        nearest[v] = DBL_MAX;
+    }
+
+    for (int i = 0; i < count; i++) {
+        graph_csr_dijkstra(forward, heap, landmark, dist, NULL);
+        for (int v = 0; v < n; v++) {
+            landmarks->from[(size_t)v * count + i] = dist[v];
+            if (dist[v] < nearest[v]) nearest[v] = dist[v];
+        }
+        nearest[landmark] = -1; // Never pick a landmark twice
+
+        if (graph->directed) {
+            graph_csr_dijkstra(backward, heap, landmark, dist, NULL);
+            for (int v = 0; v < n; v++) {
+                landmarks->to[(size_t)v * count + i] = dist[v];
+            }
+        }
+
+        landmark = -1;
+        for (int v = 0; v < n; v++) {
+            if (forward->present[v] && (landmark == -1 || nearest[v] > nearest[landmark])) landmark = v;
+        }
+    }
+
+    graph_heap_destroy(heap);
+    free(dist);
+    free(nearest);
+    return landmarks;
+}
+
+/*
+ * Function: graph_landmarks_destroy
+ * ---------------------------------
+ * Frees a landmark table.
+ *
+ * landmarks: pointer to the landmark table
+ *
+ * returns: void
+ */
+void graph_landmarks_destroy(c_graph_landmarks_t* landmarks) {
+    if (!landmarks) return;
+    if (landmarks->to != landmarks->from) free(landmarks->to);
+    free(landmarks->from);
+    free(landmarks);
+}
+
+/*
+ * Function: graph_landmark_heuristic
+ * ----------------------------------
+ * ALT lower bound for graph_astar. By the triangle inequality, for every
+ * landmark L both d(L, t) - d(L, v) and d(v, L) - d(t, L) are at most
+ * d(v, t); the largest of them is used. The bound is consistent, so A*
+ * never reopens a vertex. Reachability is used too: if L reaches v but not
+ * t, or t reaches L but v does not, v cannot reach t.
+ *
+ * vertex_id: ID of the vertex to estimate from
+ * end_id: ID of the destination vertex
+ * landmarks: landmark table from graph_landmarks_create
+ *
+ * returns: lower bound on the distance, or DBL_MAX if vertex_id cannot reach end_id
+ */
+double graph_landmark_heuristic(int vertex_id, int end_id, void* landmarks) {
+    c_graph_landmarks_t* table = (c_graph_landmarks_t*)landmarks;
+    if (vertex_id >= table->num_ids || end_id >= table->num_ids) return 0;
+
+    int count = table->count;
+    const double* from_v = table->from + (size_t)vertex_id * count;
+    const double* from_t = table->from + (size_t)end_id * count;
+    const double* to_v = table->to + (size_t)vertex_id * count;
+    const double* to_t = table->to + (size_t)end_id * count;
+
+    double best = 0;
+    for (int i = 0; i < count; i++) {
+        if (from_v[i] != DBL_MAX) {
+            if (from_t[i] == DBL_MAX) return DBL_MAX;
+            if (from_t[i] - from_v[i] > best) best = from_t[i] - from_v[i];
+        }
+        if (to_t[i] != DBL_MAX) {
+            if (to_v[i] == DBL_MAX) return DBL_MAX;
+            if (to_v[i] - to_t[i] > best) best = to_v[i] - to_t[i];
+        }
+    }
+    return best;
+}
@@ -0,0 +1,239 @@
+#include "avl_tree_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* 
+ * Function: avl_create_node
+ * -------------------------
+ * Allocates and initializes a new AVL node with a given value.
+ *
+ * value: The integer value to store in the node.
+ *
+ * returns: Pointer to the newly created node, or NULL on allocation failure.
+ */
+AvlNode *avl_create_node(int value){
+    AvlNode *node = malloc(sizeof(AvlNode));
+    if (node == NULL) return NULL;
+
+    node->value = value;
+    node->height = 1;      /* A leaf has height 1 */
+    node->left = NULL;
+    node->right = NULL;
+
+    return node;
+}
+
+/* 
+ * Function: destroy_avl_tree
+ * --------------------------
+ * Frees all nodes in the tree. Recursion depth is bounded by the tree
+ * height, which is at most about 1.44 log2(n).
+ *
+ * root: Pointer to the root node of the tree.
+ */
+void destroy_avl_tree(AvlNode *root){
+    if (root == NULL) return;
+
+    destroy_avl_tree(root->right);
+    destroy_avl_tree(root->left);
+
+    free(root);
+}
+
+/* 
+ * Function: avl_height
+ * --------------------
+ * Returns the height of a subtree.
+ *
+ * root: Pointer to the root of the subtree.
+ *
+ * returns: Height of the subtree, 0 for an empty tree.
+ */
+int avl_height(AvlNode *root){
+    return (root == NULL) ? 0 : root->height;
+}
+
+/* Recomputes a node's height from its children */
+static void update_height(AvlNode *node){
+    int left = avl_height(node->left);
+    int right = avl_height(node->right);
+    node->height = 1 + ((left > right) ? left : right);
+}
+
+/* Left height minus right height */
+static int balance_factor(AvlNode *node){
+    return avl_height(node->left) - avl_height(node->right);
+}
+
+/* 
+ * Function: rotate_right
+ * ----------------------
+ * Lifts the left child of node into its place.
+ *
+ * returns: New root of the subtree.
+ */
+static AvlNode *rotate_right(AvlNode *node){
+    AvlNode *pivot = node->left;
+    node->left = pivot->right;
+    pivot->right = node;
+    update_height(node);
+    update_height(pivot);
+    return pivot;
+}
+
+/* 
+ * Function: rotate_left
+ * ---------------------
+ * Lifts the right child of node into its place.
+ *
+ * returns: New root of the subtree.
+ */
+static AvlNode *rotate_left(AvlNode *node){
+    AvlNode *pivot = node->right;
+    node->right = pivot->left;
+    pivot->left = node;
+    update_height(node);
+    update_height(pivot);
+    return pivot;
+}
+
+/* 
+ * Function: avl_rebalance
+ * -----------------------
+ * Restores the AVL invariant (|balance| <= 1) at node after one of its
+ * subtrees changed height by one, using a single or double rotation.
+ *
+ * returns: New root of the subtree.
+ */
+AvlNode *avl_rebalance(AvlNode *node){
+    update_height(node);
+    int balance = balance_factor(node);
+
+    if (balance > 1){
+        if (balance_factor(node->left) < 0) node->left = rotate_left(node->left);
+        return rotate_right(node);
+    }
+    if (balance < -1){
+        if (balance_factor(node->right) > 0) node->right = rotate_right(node->right);
+        return rotate_left(node);
+    }
+    return node;
+}
+
+/* Recursive insert; stores the new node in *inserted and returns the new subtree root */
+static AvlNode *insert_rec(AvlNode *root, int value, AvlNode **inserted){
+    if (root == NULL){
+        *inserted = avl_create_node(value);
+        return *inserted;
+    }
+
+    /* Duplicates go right, as in binary_insert */
+    if (value < root->value)
+        root->left = insert_rec(root->left, value, inserted);
+    else
+        root->right = insert_rec(root->right, value, inserted);
+
+    if (*inserted == NULL) return root; /* Allocation failed, tree unchanged */
+    return avl_rebalance(root);
+}
+
+/* 
+ * Function: avl_insert
+ * --------------------
+ * Inserts a value and rebalances the path back to the root. Unlike
+ * binary_insert the root can change, so it is passed by reference.
+ *
+ * root: Pointer to the root pointer of the tree (may point to NULL).
+ * value: Value to insert.
+ *
+ * returns: Pointer to the newly inserted node, or NULL on failure.
+ */
+AvlNode *avl_insert(AvlNode **root, int value){
+    if (root == NULL) return NULL;
+
+    AvlNode *inserted = NULL;
+    *root = insert_rec(*root, value, &inserted);
+    return inserted;
+}
+
+/* 
+ * Function: avl_search
+ * --------------------
+ * Iteratively searches for a target value in the tree.
+ *
+ * root: Pointer to the root node.
+ * target: Value to search for.
+ *
+ * returns: Pointer to the node containing the target, or NULL if not found.
+ */
+AvlNode *avl_search(AvlNode *root, int target){
+    AvlNode *current = root;
+
+    while (current != NULL){
+        if (current->value == target) return current;
+        if (target > current->value)
+            current = current->right;
+        else
+            current = current->left;
+    }
+
+    return NULL;
+}
+
+/* Detaches the minimum of a non-empty subtree into *min and returns the rebalanced rest */
+AvlNode *avl_remove_min(AvlNode *root, AvlNode **min){
+    if (root->left == NULL){
+        *min = root;
+        return root->right;
+    }
+    root->left = avl_remove_min(root->left, min);
+    return avl_rebalance(root);
+}
+
+/* Recursive delete; sets *deleted to 1 if a node was removed and returns the new subtree root */
+static AvlNode *delete_rec(AvlNode *root, int target, int *deleted){
+    if (root == NULL) return NULL;
+
+    if (target < root->value){
+        root->left = delete_rec(root->left, target, deleted);
+    }
+    else if (target > root->value){
+        root->right = delete_rec(root->right, target, deleted);
+    }
+    else{
+        *deleted = 1;
+        AvlNode *left = root->left;
+        AvlNode *right = root->right;
+        free(root);
+
+        if (left == NULL) return right;
+        if (right == NULL) return left;
+
+        /* Two children: the in-order successor takes the removed node's place */
+        AvlNode *successor;
+        right = avl_remove_min(right, &successor);
+        successor->left = left;
+        successor->right = right;
+        return avl_rebalance(successor);
+    }
+
+    return (*deleted) ? avl_rebalance(root) : root;
+}
+
+/* 
+ * Function: avl_delete
+ * --------------------
+ * Deletes one node with the specified value and rebalances the tree.
+ *
+ * root: Pointer to the root pointer of the tree.
+ * target: Value to delete.
+ *
+ * returns: 1 if deletion was successful, 0 if node not found.
+ */
+int avl_delete(AvlNode **root, int target){
+    if (root == NULL) return 0;
+
+    int deleted = 0;
+    *root = delete_rec(*root, target, &deleted);
+    return deleted;
+}
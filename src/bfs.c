@@ -1,4 +1,5 @@
 #include "c_graph_internal.h"
+#include "c_bit_vector.h"
 #include <stdlib.h>
 #include <stdbool.h>
 
@@ -142,21 +143,20 @@ int* graph_bfs(c_graph_t* graph, int start_id, int end_id, int* path_len) {
          return NULL; // Graph is empty
     }
 
-    bool* visited = (bool*)calloc(max_id + 1, sizeof(bool));
+    BitVector* visited = create_bit_vector(max_id + 1); // One bit per vertex
     int* parent = (int*)malloc((max_id + 1) * sizeof(int));
-    for (int i = 0; i <= max_id; ++i) {
-        parent[i] = -1; // Initialize parent array
-    }
-
     if (!visited || !parent) {
-        free(visited);
+        destroy_bit_vector(visited);
         free(parent);
         *path_len = 0;
         return NULL; // Memory allocation failed
     }
+    for (int i = 0; i <= max_id; ++i) {
+        parent[i] = -1; // Initialize parent array
+    }
 
     queue_t* q = queue_create(); // Create BFS queue
-    visited[start_id] = true;
+    bit_vector_set(visited, start_id);
     queue_enqueue(q, start_id);
 
     bool found = false;
@@ -178,8 +178,7 @@ int* graph_bfs(c_graph_t* graph, int start_id, int end_id, int* path_len) {
             c_graph_edge_t* edge = u_vertex->edges;
             while (edge) {
                 int v = edge->dest_id;
-                if (!visited[v]) {
-                    visited[v] = true;
+                if (bit_vector_test_and_set(visited, v) == 0) {
                     parent[v] = u; // Track path
                     queue_enqueue(q, v);
                 }
@@ -189,7 +188,7 @@ int* graph_bfs(c_graph_t* graph, int start_id, int end_id, int* path_len) {
     }
 
     queue_destroy(q);
-    free(visited);
+    destroy_bit_vector(visited);
 
     if (!found) {
         free(parent);
@@ -0,0 +1,158 @@
+#include "c_graph_internal.h"
+#include "c_graph.h"
+#include <stdlib.h>
+#include <float.h>
+
+/*
+ * One direction of the search: distances and parents are indexed by vertex
+ * id, and parent links point back toward the side's own origin.
+ */
+typedef struct search_side_t {
+    c_graph_csr_t* csr;
+    c_graph_heap_t* heap;
+    double* dist;
+    int* parent;
+} search_side_t;
+
+/*
+ * Function: side_init
+ * -------------------
+ * Allocates the arrays of one search direction and queues its origin.
+ *
+ * returns: 0 if successful, -1 if allocation fails
+ */
+static int side_init(search_side_t* side, c_graph_csr_t* csr, int origin) {
+    int n = csr->num_ids;
+    side->csr = csr;
+    side->heap = graph_heap_create(n);
+    side->dist = (double*)malloc(n * sizeof(double));
+    side->parent = (int*)malloc(n * sizeof(int));
+    if (!side->heap || !side->dist || !side->parent) return -1;
+
+    for (int i = 0; i < n; i++) {
+        side->dist[i] = DBL_MAX;
+        side->parent[i] = -1;
+    }
+    side->dist[origin] = 0;
+    graph_heap_push(side->heap, origin, 0);
+    return 0;
+}
+
+static void side_free(search_side_t* side) {
+    graph_heap_destroy(side->heap);
+    free(side->dist);
+    free(side->parent);
+}
+
+/*
+ * Function: side_step
+ * -------------------
+ * Settles the closest queued vertex of one direction and relaxes its edges.
+ * Every time a vertex gets a shorter distance and the other direction has
+ * already reached it, the path through it is a candidate for the best path.
+ *
+ * side: direction to advance
+ * other: opposite direction
+ * best: length of the best path found so far, updated in place
+ * meet: vertex the best path passes through, updated in place
+ */
+static void side_step(search_side_t* side, const search_side_t* other, double* best, int* meet) {
+    int u = graph_heap_pop(side->heap);
+    graph_settled_count++;
+
+    c_graph_csr_t* csr = side->csr;
+    for (int i = csr->offsets[u]; i < csr->offsets[u + 1]; i++) {
+        int v = csr->targets[i];
+        double candidate = side->dist[u] + csr->weights[i];
+        if (candidate >= side->dist[v]) continue;
+
+        side->dist[v] = candidate;
+        side->parent[v] = u;
+        graph_heap_push(side->heap, v, candidate);
+
+        if (other->dist[v] != DBL_MAX && candidate + other->dist[v] < *best) {
+            *best = candidate + other->dist[v];
+            *meet = v;
+        }
+    }
+}
+
+/*
+ * Function: graph_bidirectional_dijkstra
+ * --------------------------------------
+ * Finds the shortest path between start_id and end_id by growing one
+ * Dijkstra search forward from the start and one backward from the end on
+ * the reverse graph, always advancing the side whose next vertex is closer.
+ * The search stops once the two closest queued distances add up to at least
+ * the best path seen, so each side only explores a ball of about half the
+ * path length. Edge weights must be non-negative.
+ *
+ * graph: pointer to the graph structure
+ * start_id: ID of the starting vertex
+ * end_id: ID of the destination vertex
+ * path_len: pointer to an integer to store the length of the path
+ *
+ * returns: array of vertex IDs representing the shortest path
+ *          or NULL if no path exists or input is invalid
+ */
+int* graph_bidirectional_dijkstra(c_graph_t* graph, int start_id, int end_id, int* path_len) {
+    if (!path_len) return NULL;
+    *path_len = 0;
+    graph_settled_count = 0;
+
+    c_graph_csr_t* forward_csr = graph_csr_get(graph, 0);
+    c_graph_csr_t* backward_csr = graph_csr_get(graph, 1);
+    if (!forward_csr || !backward_csr) return NULL;
+    if (start_id < 0 || start_id >= forward_csr->num_ids || !forward_csr->present[start_id]) return NULL;
+    if (end_id < 0 || end_id >= forward_csr->num_ids || !forward_csr->present[end_id]) return NULL;
+
+    search_side_t forward = {0};
+    search_side_t backward = {0};
+    if (side_init(&forward, forward_csr, start_id) != 0 || side_init(&backward, backward_csr, end_id) != 0) {
+        side_free(&forward);
+        side_free(&backward);
+        return NULL;
+    }
+
+    double best = (start_id == end_id) ? 0 : DBL_MAX;
+    int meet = (start_id == end_id) ? start_id : -1;
+
+    // If either queue runs dry, every path it could still contribute has been seen
+    while (forward.heap->size > 0 && backward.heap->size > 0) {
+        double forward_min = graph_heap_min_key(forward.heap);
+        double backward_min = graph_heap_min_key(backward.heap);
+        if (forward_min + backward_min >= best) break;
+
+        if (forward_min <= backward_min) {
+            side_step(&forward, &backward, &best, &meet);
+        } else {
+            side_step(&backward, &forward, &best, &meet);
+        }
+    }
+
+    int* path = NULL;
+    if (meet != -1) {
+        // Forward half from the parents, then follow backward parents to the end
+        int first_len = 0;
+        int* first = graph_path_from_parents(forward.parent, meet, &first_len);
+        int second_len = 0;
+        for (int v = backward.parent[meet]; v != -1; v = backward.parent[v]) {
+            second_len++;
+        }
+
+        path = first ? (int*)realloc(first, (first_len + second_len) * sizeof(int)) : NULL;
+        if (path) {
+            int i = first_len;
+            for (int v = backward.parent[meet]; v != -1; v = backward.parent[v]) {
+                path[i++] = v;
+            }
+            *path_len = first_len + second_len;
+        } else {
+            free(first);
+        }
+    }
+
+    side_free(&forward);
+    side_free(&backward);
+    return path;
+}
@@ -1,4 +1,4 @@
-#include "binary_search_tree.h"
+#include "binary_search_tree_internal.h"
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -16,6 +16,7 @@ Node *create_node(int value){
     if (node == NULL) return NULL;
 
     node->value = value;   /* Store the value */
+    node->size = 1;        /* Subtree holds only this node */
     node->left = NULL;     /* Initialize left child as NULL */
     node->right = NULL;    /* Initialize right child as NULL */
 
@@ -25,18 +26,28 @@ Node *create_node(int value){
 /* 
  * Function: destroy_binary_search_tree
  * ------------------------------------
- * Recursively frees all nodes in the BST.
+ * Frees all nodes in the BST without recursion. A node with a left child is
+ * rotated right until the current root has none, then freed; this unrolls
+ * the tree into its right spine in O(n) time and O(1) extra space, so even a
+ * degenerate tree cannot overflow the stack.
  *
  * root: Pointer to the root node of the tree.
  */
 void destroy_binary_search_tree(Node *root){
-    if (root == NULL) return;
-
-    /* Recursively destroy right and left subtrees */
-    destroy_binary_search_tree(root->right);
-    destroy_binary_search_tree(root->left);
-
-    free(root); /* Free current node */
+    while (root != NULL){
+        if (root->left != NULL){
+            /* Rotate right: the left child becomes the root of this subtree */
+            Node *left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        }
+        else{
+            Node *next = root->right;
+            free(root); /* Free current node */
+            root = next;
+        }
+    }
 }
 
 /* 
@@ -55,29 +66,44 @@ Node *binary_insert(Node *root, int value){
         return new_node; /* Return new root */
     }
 
+    /* Create new node */
+    Node *newNode = create_node(value);
+    if (newNode == NULL) return NULL;
+
+    bst_attach_node(root, newNode);
+    return newNode;
+}
+
+/* 
+ * Function: bst_attach_node
+ * -------------------------
+ * Links an already initialized leaf node into a non-empty BST at the
+ * position its value belongs, counting it in the size of every ancestor.
+ * Duplicates go to the right.
+ *
+ * root: Pointer to the root node.
+ * node: Leaf node to attach.
+ */
+void bst_attach_node(Node *root, Node *node){
     Node *current = root;
     Node *parent = NULL;
+    int value = node->value;
 
     /* Traverse tree to find insertion point */
     while (current != NULL){
         parent = current;
+        parent->size++;
         if (value < current->value)
             current = current->left;
         else
             current = current->right; 
     }
 
-    /* Create new node */
-    Node *newNode = create_node(value);
-    if (newNode == NULL) return NULL;
-
     /* Attach new node to parent */
     if (value < parent->value)
-        parent->left = newNode;
+        parent->left = node;
     else
-        parent->right = newNode;
-
-    return newNode;
+        parent->right = node;
 }
 
 /* 
@@ -107,7 +133,9 @@ Node *binary_search(Node *root, int target){
 /* 
  * Function: binary_search_recursive
  * ---------------------------------
- * Recursively searches for a target value in the BST.
+ * Recursively searches for a target value in the BST. Both calls are tail
+ * calls, which optimizing compilers turn into a loop; use binary_search for
+ * constant stack depth on degenerate trees in unoptimized builds.
  *
  * root: Pointer to the root node.
  * target: Value to search for.
@@ -125,6 +153,63 @@ Node *binary_search_recursive(Node *root, int target){
         return binary_search_recursive(root->left, target);
 }
 
+/* 
+ * Function: bst_unlink
+ * --------------------
+ * Removes a value from the BST without freeing anything. For a node with two
+ * children the in-order successor's value is moved into it and the successor
+ * is unlinked instead. Iterative: the parent link is tracked as a pointer to
+ * the child pointer, so the depth of the tree does not matter. The search
+ * runs first so subtree sizes are only adjusted when the value is present.
+ *
+ * root: Pointer to the root pointer of the tree.
+ * target: Value to remove.
+ *
+ * returns: The node that left the tree (for the caller to release), or NULL if not found.
+ */
+Node *bst_unlink(Node **root, int target){
+    if (binary_search(*root, target) == NULL) return NULL;
+
+    Node **link = root;
+
+    /* Follow child links, keeping the address of the link to rewrite */
+    while ((*link)->value != target){
+        (*link)->size--; /* Every ancestor loses one node */
+        if (target < (*link)->value)
+            link = &(*link)->left;
+        else
+            link = &(*link)->right;
+    }
+
+    Node *temp_node = *link;
+
+    /* Case 1 and 2: No children or only right child */
+    if (temp_node->left == NULL) {
+        *link = temp_node->right;
+        return temp_node;
+    }
+    /* Case 3: Only left child */
+    if (temp_node->right == NULL) {
+        *link = temp_node->left;
+        return temp_node;
+    }
+    /* Case 4: Two children */
+    Node **min_link = &temp_node->right;
+
+    /* Find the smallest node in the right subtree */
+    temp_node->size--;
+    while ((*min_link)->left){
+        (*min_link)->size--;
+        min_link = &(*min_link)->left;
+    }
+
+    /* Replace value and splice out the successor node */
+    Node *min_node_right_child = *min_link;
+    temp_node->value = min_node_right_child->value;
+    *min_link = min_node_right_child->right;
+    return min_node_right_child;
+}
+
 /* 
  * Function: delete_node
  * ---------------------
@@ -136,45 +221,9 @@ Node *binary_search_recursive(Node *root, int target){
  * returns: 1 if deletion was successful, 0 if node not found.
  */
 int delete_node(Node **root, int target){
-    if (*root == NULL) return 0;
-
-    if (target < (*root)->value){
-        return delete_node(&(*root)->left, target);
-    }
-    else if (target > (*root)->value){
-        return delete_node(&(*root)->right, target);
-    }
-    else{
-        Node *temp_node = *root;
+    Node *removed = bst_unlink(root, target);
+    if (removed == NULL) return 0;
 
-        /* Case 1: No children */
-        if ((*root)->left == NULL && (*root)->right == NULL) {
-            free(*root);
-            *root = NULL;
-        }
-        /* Case 2: Only right child */
-        else if ((*root)->left == NULL) {
-            *root = (*root)->right;
-            free(temp_node);
-        }
-        /* Case 3: Only left child */
-        else if ((*root)->right == NULL) {
-            *root = (*root)->left;
-            free(temp_node);
-        }
-        /* Case 4: Two children */
-        else {
-            Node *min_node_right_child = (*root)->right;
-
-            /* Find the smallest node in the right subtree */
-            while (min_node_right_child->left){
-                min_node_right_child = min_node_right_child->left;
-            }
-
-            /* Replace value and delete the successor node */
-            (*root)->value = min_node_right_child->value;
-            delete_node(&(*root)->right, min_node_right_child->value);
-        }
-        return 1;
-    }
+    free(removed);
+    return 1;
 }
@@ -0,0 +1,194 @@
+#include "binary_search_tree_internal.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * Function: is_sorted
+ * -------------------
+ * Checks that values are in non-decreasing order.
+ */
+static int is_sorted(const int *values, int n){
+    for (int i = 1; i < n; i++){
+        if (values[i - 1] > values[i]) return 0;
+    }
+    return 1;
+}
+
+/*
+ * Function: build_balanced
+ * ------------------------
+ * Links nodes[lo, hi) into a perfectly balanced subtree whose in-order
+ * sequence is values[lo, hi). Node i holds values[i], so no node is ever
+ * moved. Recursion depth is log2(n).
+ *
+ * returns: Root of the subtree, or NULL if the range is empty.
+ */
+static Node *build_balanced(Node *nodes, const int *values, int lo, int hi){
+    if (lo >= hi) return NULL;
+
+    int mid = lo + (hi - lo) / 2;
+    Node *node = &nodes[mid];
+    node->value = values[mid];
+    node->size = hi - lo;
+    node->left = build_balanced(nodes, values, lo, mid);
+    node->right = build_balanced(nodes, values, mid + 1, hi);
+    return node;
+}
+
+/*
+ * Function: build_slab
+ * --------------------
+ * Allocates one slab sized for exactly n nodes and builds a balanced tree in it.
+ *
+ * returns: The slab (its first node is not necessarily the root), or NULL on allocation failure.
+ */
+static NodeSlab *build_slab(const int *values, int n, Node **root){
+    NodeSlab *slab = malloc(sizeof(NodeSlab) + sizeof(Node) * (size_t)n);
+    if (slab == NULL) return NULL;
+
+    slab->next = NULL;
+    slab->capacity = n;
+    *root = build_balanced(slab->nodes, values, 0, n);
+    return slab;
+}
+
+/*
+ * Function: bst_build_sorted
+ * --------------------------
+ * Builds a perfectly balanced tree from sorted values in O(n) with a single
+ * node allocation. The tree behaves like any other BSTree afterwards: later
+ * inserts draw from new slabs and deletes go to the free list.
+ *
+ * values: Values in non-decreasing order (duplicates allowed).
+ * n: Number of values.
+ *
+ * returns: Pointer to the new tree, or NULL if the input is invalid or unsorted, or on allocation failure.
+ */
+BSTree *bst_build_sorted(const int *values, int n){
+    if (n < 0 || (n > 0 && values == NULL) || !is_sorted(values, n)) return NULL;
+
+    BSTree *tree = create_bst_tree();
+    if (tree == NULL || n == 0) return tree;
+
+    tree->slabs = build_slab(values, n, &tree->root);
+    if (tree->slabs == NULL){
+        destroy_bst_tree(tree);
+        return NULL;
+    }
+    tree->slab_used = n; /* Slab is full */
+    tree->size = n;
+    return tree;
+}
+
+/*
+ * Function: bst_build_from_vector
+ * -------------------------------
+ * Builds a perfectly balanced tree from a sorted Vector. See bst_build_sorted.
+ *
+ * vector: Pointer to a Vector with elements in non-decreasing order.
+ *
+ * returns: Pointer to the new tree, or NULL if the vector is NULL or unsorted, or on allocation failure.
+ */
+BSTree *bst_build_from_vector(Vector *vector){
+    if (vector == NULL) return NULL;
+    return bst_build_sorted(vector->collection, vector->size);
+}
+
+/*
+ * Function: bst_flatten
+ * ---------------------
+ * Writes the values of a tree to out in sorted order using a Morris
+ * traversal: threads are added to and removed from the tree on the fly, so it
+ * needs neither recursion nor a stack, and the tree is unchanged afterwards.
+ *
+ * returns: Number of values written.
+ */
+int bst_flatten(Node *root, int *out){
+    int count = 0;
+    Node *current = root;
+
+    while (current != NULL){
+        if (current->left == NULL){
+            out[count++] = current->value;
+            current = current->right;
+            continue;
+        }
+
+        /* In-order predecessor of current */
+        Node *predecessor = current->left;
+        while (predecessor->right != NULL && predecessor->right != current){
+            predecessor = predecessor->right;
+        }
+
+        if (predecessor->right == NULL){
+            predecessor->right = current; /* Thread back to current */
+            current = current->left;
+        }
+        else{
+            predecessor->right = NULL;    /* Left subtree done: remove the thread */
+            out[count++] = current->value;
+            current = current->right;
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Function: bst_merge_sorted
+ * --------------------------
+ * Adds a sorted batch to a tree in O(size + n): the tree is flattened, merged
+ * with the batch, and rebuilt perfectly balanced in a single new slab that
+ * replaces all existing slabs. Node pointers into the tree are invalidated.
+ * On failure the tree is left unchanged.
+ *
+ * tree: Pointer to the tree.
+ * values: Values in non-decreasing order (duplicates allowed).
+ * n: Number of values.
+ *
+ * returns: 1 if successful, -1 if the input is invalid or unsorted, or on allocation failure.
+ */
+int bst_merge_sorted(BSTree *tree, const int *values, int n){
+    if (tree == NULL || n < 0 || (n > 0 && values == NULL) || !is_sorted(values, n)) return -1;
+    if (tree->size > INT_MAX - n) return -1;
+    if (n == 0) return 1;
+
+    int existing = (int)tree->size;
+    int total = existing + n;
+    int *merged = malloc(sizeof(int) * (size_t)total);
+    if (merged == NULL) return -1;
+
+    /* Flatten into the tail, then merge forward into the head */
+    int *old_values = merged + n;
+    bst_flatten(tree->root, old_values);
+
+    int i = 0, j = 0, k = 0;
+    while (i < existing && j < n){
+        if (old_values[i] <= values[j])
+            merged[k++] = old_values[i++];
+        else
+            merged[k++] = values[j++];
+    }
+    while (j < n) merged[k++] = values[j++];
+    /* Any remaining old values are already in place */
+
+    Node *root;
+    NodeSlab *slab = build_slab(merged, total, &root);
+    free(merged);
+    if (slab == NULL) return -1;
+
+    NodeSlab *old = tree->slabs;
+    while (old != NULL){
+        NodeSlab *next = old->next;
+        free(old);
+        old = next;
+    }
+
+    tree->slabs = slab;
+    tree->slab_used = total;
+    tree->free_list = NULL;
+    tree->root = root;
+    tree->size = total;
+    return 1;
+}
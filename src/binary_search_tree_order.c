@@ -0,0 +1,136 @@
+#include "binary_search_tree.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Size of a possibly empty subtree */
+static inline int subtree_size(Node *node){
+    return (node == NULL) ? 0 : node->size;
+}
+
+/* 
+ * Function: bst_select
+ * --------------------
+ * Finds the k-th smallest value (0-based) using subtree sizes, in O(height).
+ *
+ * root: Pointer to the root node.
+ * k: Zero-based rank of the value to find.
+ *
+ * returns: Pointer to the node holding the k-th smallest value, or NULL if k is out of range.
+ */
+Node *bst_select(Node *root, int k){
+    if (k < 0 || k >= subtree_size(root)) return NULL;
+
+    Node *current = root;
+    while (current != NULL){
+        int left_size = subtree_size(current->left);
+        if (k < left_size){
+            current = current->left;
+        }
+        else if (k == left_size){
+            return current;
+        }
+        else{
+            k -= left_size + 1; /* Skip the left subtree and this node */
+            current = current->right;
+        }
+    }
+
+    return NULL;
+}
+
+/* Counts values strictly below value (inclusive == 0) or at most value (inclusive == 1) */
+static int count_below(Node *root, int value, int inclusive){
+    int count = 0;
+    Node *current = root;
+
+    while (current != NULL){
+        if (current->value < value || (inclusive && current->value == value)){
+            count += subtree_size(current->left) + 1;
+            current = current->right;
+        }
+        else{
+            current = current->left;
+        }
+    }
+
+    return count;
+}
+
+/* 
+ * Function: bst_rank
+ * ------------------
+ * Counts the values strictly smaller than value, in O(height). This is also
+ * the 0-based position value has, or would have, in sorted order.
+ *
+ * root: Pointer to the root node.
+ * value: Value to rank.
+ *
+ * returns: Number of values less than value.
+ */
+int bst_rank(Node *root, int value){
+    return count_below(root, value, 0);
+}
+
+/* 
+ * Function: bst_count_range
+ * -------------------------
+ * Counts the values in [low, high] with two rank queries, in O(height).
+ *
+ * root: Pointer to the root node.
+ * low: Inclusive lower bound.
+ * high: Inclusive upper bound.
+ *
+ * returns: Number of values in the range, 0 if low > high.
+ */
+int bst_count_range(Node *root, int low, int high){
+    if (low > high) return 0;
+    return count_below(root, high, 1) - count_below(root, low, 0);
+}
+
+/* 
+ * Function: bst_iterator_seek
+ * ---------------------------
+ * Positions an iterator at the first value >= value.
+ *
+ * iterator: Iterator to position.
+ * root: Pointer to the root node of the tree to iterate.
+ * value: Lower bound of the scan.
+ */
+void bst_iterator_seek(BSTIterator *iterator, Node *root, int value){
+    if (iterator == NULL) return;
+
+    iterator->root = root;
+    iterator->current = NULL;
+    iterator->index = bst_rank(root, value);
+}
+
+/* 
+ * Function: bst_iterator_next
+ * ---------------------------
+ * Returns the next value in sorted order and advances the iterator. The
+ * successor is the leftmost node of the right subtree when there is one;
+ * otherwise it is found from the root by rank, so no parent pointers or
+ * stack are needed and duplicates are visited exactly once each.
+ *
+ * iterator: Iterator positioned by bst_iterator_seek.
+ * value: Receives the value (may be NULL).
+ *
+ * returns: 1 if a value was returned, 0 when the iteration is finished.
+ */
+int bst_iterator_next(BSTIterator *iterator, int *value){
+    if (iterator == NULL || iterator->index >= subtree_size(iterator->root)) return 0;
+
+    Node *current = iterator->current;
+    if (current != NULL && current->right != NULL){
+        current = current->right;
+        while (current->left != NULL) current = current->left;
+    }
+    else{
+        current = bst_select(iterator->root, iterator->index);
+    }
+
+    iterator->current = current;
+    iterator->index++;
+    if (value != NULL) *value = current->value;
+    return 1;
+}
@@ -0,0 +1,165 @@
+#include "binary_search_tree_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * Function: pool_allocate
+ * -----------------------
+ * Takes a node from the free list, or the next unused node of the current
+ * slab, allocating a new slab of BST_SLAB_NODES nodes when it is exhausted.
+ *
+ * tree: Pointer to the tree owning the pool.
+ *
+ * returns: Pointer to an uninitialized node, or NULL on allocation failure.
+ */
+static Node *pool_allocate(BSTree *tree){
+    if (tree->free_list != NULL){
+        Node *node = tree->free_list;
+        tree->free_list = node->right;
+        return node;
+    }
+
+    if (tree->slabs == NULL || tree->slab_used == tree->slabs->capacity){
+        NodeSlab *slab = malloc(sizeof(NodeSlab) + sizeof(Node) * BST_SLAB_NODES);
+        if (slab == NULL) return NULL;
+        slab->capacity = BST_SLAB_NODES;
+        slab->next = tree->slabs;
+        tree->slabs = slab;
+        tree->slab_used = 0;
+    }
+
+    return &tree->slabs->nodes[tree->slab_used++];
+}
+
+/*
+ * Function: pool_release
+ * ----------------------
+ * Returns a node to the tree's free list for reuse by later inserts.
+ *
+ * tree: Pointer to the tree owning the pool.
+ * node: Node to release.
+ */
+static void pool_release(BSTree *tree, Node *node){
+    node->left = NULL;
+    node->right = tree->free_list;
+    tree->free_list = node;
+}
+
+/*
+ * Function: create_bst_tree
+ * -------------------------
+ * Allocates an empty tree handle. Nodes are carved out of slabs owned by the
+ * tree instead of being malloc'd one at a time.
+ *
+ * returns: Pointer to the new tree, or NULL on allocation failure.
+ */
+BSTree *create_bst_tree(void){
+    BSTree *tree = malloc(sizeof(BSTree));
+    if (tree == NULL) return NULL;
+
+    tree->root = NULL;
+    tree->slabs = NULL;
+    tree->slab_used = 0;
+    tree->free_list = NULL;
+    tree->size = 0;
+    return tree;
+}
+
+/*
+ * Function: destroy_bst_tree
+ * --------------------------
+ * Frees the tree by releasing whole slabs; individual nodes are never visited.
+ *
+ * tree: Pointer to the tree to destroy.
+ */
+void destroy_bst_tree(BSTree *tree){
+    if (tree == NULL) return;
+
+    NodeSlab *slab = tree->slabs;
+    while (slab != NULL){
+        NodeSlab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    free(tree);
+}
+
+/*
+ * Function: bst_insert
+ * --------------------
+ * Inserts a value into the tree using a pooled node.
+ *
+ * tree: Pointer to the tree.
+ * value: Value to insert.
+ *
+ * returns: Pointer to the newly inserted node, or NULL on failure.
+ */
+Node *bst_insert(BSTree *tree, int value){
+    if (tree == NULL) return NULL;
+
+    Node *node = pool_allocate(tree);
+    if (node == NULL) return NULL;
+
+    node->value = value;
+    node->size = 1;
+    node->left = NULL;
+    node->right = NULL;
+
+    if (tree->root == NULL)
+        tree->root = node;
+    else
+        bst_attach_node(tree->root, node);
+
+    tree->size++;
+    return node;
+}
+
+/*
+ * Function: bst_search
+ * --------------------
+ * Searches for a target value in the tree.
+ *
+ * tree: Pointer to the tree.
+ * target: Value to search for.
+ *
+ * returns: Pointer to the node containing the target, or NULL if not found.
+ */
+Node *bst_search(BSTree *tree, int target){
+    if (tree == NULL) return NULL;
+    return binary_search(tree->root, target);
+}
+
+/*
+ * Function: bst_delete
+ * --------------------
+ * Deletes a value from the tree and puts its node on the free list.
+ *
+ * tree: Pointer to the tree.
+ * target: Value to delete.
+ *
+ * returns: 1 if deletion was successful, 0 if node not found.
+ */
+int bst_delete(BSTree *tree, int target){
+    if (tree == NULL) return 0;
+
+    Node *removed = bst_unlink(&tree->root, target);
+    if (removed == NULL) return 0;
+
+    pool_release(tree, removed);
+    tree->size--;
+    return 1;
+}
+
+/*
+ * Function: bst_size
+ * ------------------
+ * Returns the number of values in the tree.
+ *
+ * tree: Pointer to the tree.
+ *
+ * returns: Number of values, or -1 if tree is NULL.
+ */
+long long bst_size(BSTree *tree){
+    if (tree == NULL) return -1;
+    return tree->size;
+}
@@ -0,0 +1,609 @@
+#include "bplus_tree_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define BPLUS_LEAF_MIN (BPLUS_LEAF_KEYS / 2)
+#define BPLUS_INTERNAL_MIN (BPLUS_INTERNAL_KEYS / 2)
+
+#define LINES(bytes) (((bytes) + BPLUS_NODE_ALIGNMENT - 1) / BPLUS_NODE_ALIGNMENT * BPLUS_NODE_ALIGNMENT)
+#define AS_LEAF(node) ((BPlusLeaf *)(node))
+#define AS_INTERNAL(node) ((BPlusInternal *)(node))
+
+/*
+ * Function: count_less
+ * --------------------
+ * Counts the keys strictly below key in a sorted array, i.e. the lower bound.
+ * With SSE2 four keys are compared per instruction and the scan stops at the
+ * first block that is not entirely below key. Arrays are sized in multiples of
+ * 4, so whole-block loads never leave the node.
+ *
+ * keys: sorted key array of a node
+ * count: number of keys in use
+ * key: key to rank
+ *
+ * returns: index of the first key >= key
+ */
+static inline int count_less(const int *keys, int count, int key){
+    int less = 0;
+#ifdef __SSE2__
+    __m128i target = _mm_set1_epi32(key);
+    for (int i = 0; i < count; i += 4){
+        __m128i block = _mm_loadu_si128((const __m128i *)(keys + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(block, target)));
+        if (count - i < 4) mask &= (1 << (count - i)) - 1;
+        less += __builtin_popcount(mask);
+        if (mask != 0xF) break;
+    }
+#else
+    while (less < count && keys[less] < key) less++;
+#endif
+    return less;
+}
+
+/*
+ * Function: count_less_equal
+ * --------------------------
+ * Counts the keys at or below key in a sorted array, i.e. the upper bound.
+ * Used to pick the child of an internal node, whose separators are the
+ * smallest keys of their right subtrees.
+ *
+ * returns: index of the first key > key
+ */
+static inline int count_less_equal(const int *keys, int count, int key){
+    int less_equal = 0;
+#ifdef __SSE2__
+    __m128i target = _mm_set1_epi32(key);
+    for (int i = 0; i < count; i += 4){
+        __m128i block = _mm_loadu_si128((const __m128i *)(keys + i));
+        int mask = ~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(block, target))) & 0xF;
+        if (count - i < 4) mask &= (1 << (count - i)) - 1;
+        less_equal += __builtin_popcount(mask);
+        if (mask != 0xF) break;
+    }
+#else
+    while (less_equal < count && keys[less_equal] <= key) less_equal++;
+#endif
+    return less_equal;
+}
+
+static BPlusAllocator node_allocator = aligned_alloc;
+
+void bplus_set_allocator(BPlusAllocator allocator){
+    node_allocator = allocator ? allocator : aligned_alloc;
+}
+
+/* Allocates a zeroed, cache-line-aligned node rounded up to whole lines */
+static BPlusNode *allocate_node(size_t size, int is_leaf){
+    size = LINES(size);
+    BPlusNode *node = node_allocator(BPLUS_NODE_ALIGNMENT, size);
+    if (node == NULL) return NULL;
+    memset(node, 0, size);
+    node->is_leaf = is_leaf;
+    return node;
+}
+
+static BPlusLeaf *create_leaf(void){
+    return AS_LEAF(allocate_node(sizeof(BPlusLeaf), 1));
+}
+
+static BPlusInternal *create_internal(void){
+    return AS_INTERNAL(allocate_node(sizeof(BPlusInternal), 0));
+}
+
+/*
+ * Function: create_bplus_tree
+ * ---------------------------
+ * Allocates an empty B+ tree ordered map from int keys to int values.
+ *
+ * returns: pointer to the created BPlusTree, or NULL if allocation fails
+ */
+BPlusTree *create_bplus_tree(void){
+    BPlusTree *tree = malloc(sizeof(BPlusTree));
+    if (tree == NULL) return NULL;
+
+    BPlusLeaf *root = create_leaf();
+    if (root == NULL){
+        free(tree);
+        return NULL;
+    }
+
+    tree->root = &root->header;
+    tree->size = 0;
+    tree->height = 1;
+    return tree;
+}
+
+/* Frees a subtree; recursion depth is the tree height */
+static void destroy_node(BPlusNode *node){
+    if (!node->is_leaf){
+        BPlusInternal *internal = AS_INTERNAL(node);
+        for (int i = 0; i <= node->count; i++) destroy_node(internal->children[i]);
+    }
+    free(node);
+}
+
+/*
+ * Function: destroy_bplus_tree
+ * ----------------------------
+ * Frees the tree and all of its nodes.
+ *
+ * tree: pointer to the BPlusTree to destroy
+ *
+ * returns: void
+ */
+void destroy_bplus_tree(BPlusTree *tree){
+    if (tree == NULL) return;
+    destroy_node(tree->root);
+    free(tree);
+}
+
+/*
+ * Function: find_leaf
+ * -------------------
+ * Descends to the leaf that holds or would hold key, optionally recording the
+ * internal nodes and child indices on the way for insert and delete.
+ *
+ * returns: the leaf for key
+ */
+static BPlusLeaf *find_leaf(BPlusTree *tree, int key, BPlusInternal **path, int *path_index){
+    BPlusNode *node = tree->root;
+    int depth = 0;
+    while (!node->is_leaf){
+        BPlusInternal *internal = AS_INTERNAL(node);
+        int child = count_less_equal(internal->keys, node->count, key);
+        if (path != NULL){
+            path[depth] = internal;
+            path_index[depth] = child;
+        }
+        depth++;
+        node = internal->children[child];
+    }
+    return AS_LEAF(node);
+}
+
+/*
+ * Function: insert_into_parent
+ * ----------------------------
+ * Adds the separator and new right sibling produced by a split to the parent
+ * at the given depth, splitting parents as needed and growing a new root when
+ * the split reaches the top. New internal nodes are taken from spares, which
+ * the caller filled beforehand, so this step cannot fail halfway.
+ *
+ * returns: void
+ */
+static void insert_into_parent(BPlusTree *tree, BPlusInternal **path, int *path_index, int depth,
+                               BPlusNode *left, int separator, BPlusNode *right, BPlusInternal **spares){
+    if (depth < 0){
+        BPlusInternal *root = *spares;
+        root->header.count = 1;
+        root->keys[0] = separator;
+        root->children[0] = left;
+        root->children[1] = right;
+        tree->root = &root->header;
+        tree->height++;
+        return;
+    }
+
+    BPlusInternal *parent = path[depth];
+    int position = path_index[depth]; /* left is children[position] */
+    int count = parent->header.count;
+
+    if (count < BPLUS_INTERNAL_KEYS){
+        memmove(parent->keys + position + 1, parent->keys + position, sizeof(int) * (count - position));
+        memmove(parent->children + position + 2, parent->children + position + 1,
+                sizeof(BPlusNode *) * (count - position));
+        parent->keys[position] = separator;
+        parent->children[position + 1] = right;
+        parent->header.count++;
+        return;
+    }
+
+    /* Full: merge into temporary arrays, keep the lower half, push the middle key up */
+    int keys[BPLUS_INTERNAL_KEYS + 1];
+    BPlusNode *children[BPLUS_INTERNAL_KEYS + 2];
+    memcpy(keys, parent->keys, sizeof(int) * position);
+    keys[position] = separator;
+    memcpy(keys + position + 1, parent->keys + position, sizeof(int) * (count - position));
+    memcpy(children, parent->children, sizeof(BPlusNode *) * (position + 1));
+    children[position + 1] = right;
+    memcpy(children + position + 2, parent->children + position + 1, sizeof(BPlusNode *) * (count - position));
+
+    BPlusInternal *sibling = *spares;
+
+    int left_count = (BPLUS_INTERNAL_KEYS + 1) / 2;
+    int right_count = BPLUS_INTERNAL_KEYS - left_count;
+    memcpy(parent->keys, keys, sizeof(int) * left_count);
+    memcpy(parent->children, children, sizeof(BPlusNode *) * (left_count + 1));
+    parent->header.count = left_count;
+    memcpy(sibling->keys, keys + left_count + 1, sizeof(int) * right_count);
+    memcpy(sibling->children, children + left_count + 1, sizeof(BPlusNode *) * (right_count + 1));
+    sibling->header.count = right_count;
+
+    insert_into_parent(tree, path, path_index, depth - 1, &parent->header, keys[left_count],
+                       &sibling->header, spares + 1);
+}
+
+/*
+ * Function: bplus_insert
+ * ----------------------
+ * Inserts a key with its value, or updates the value if the key is present.
+ * Full leaves split in half and the split propagates upwards. Every node a
+ * split needs is allocated before the tree is touched, so a failed insert
+ * leaves the tree unchanged.
+ *
+ * tree: pointer to the BPlusTree
+ * key: key to insert
+ * value: value to associate with key
+ *
+ * returns: 1 if the key was inserted, 0 if an existing value was updated,
+ *          -1 if tree is NULL or allocation fails
+ */
+int bplus_insert(BPlusTree *tree, int key, int value){
+    if (tree == NULL) return -1;
+
+    BPlusInternal *path[BPLUS_MAX_HEIGHT];
+    int path_index[BPLUS_MAX_HEIGHT];
+    BPlusLeaf *leaf = find_leaf(tree, key, path, path_index);
+
+    int position = count_less(leaf->keys, leaf->header.count, key);
+    if (position < leaf->header.count && leaf->keys[position] == key){
+        leaf->values[position] = value;
+        return 0;
+    }
+
+    BPlusLeaf *target = leaf;
+    BPlusLeaf *sibling = NULL;
+    BPlusInternal *spares[BPLUS_MAX_HEIGHT];
+    if (leaf->header.count == BPLUS_LEAF_KEYS){
+        /* One internal node per full ancestor, plus a new root if they are all full */
+        int needed = 0;
+        int depth = tree->height - 2;
+        while (depth - needed >= 0 && path[depth - needed]->header.count == BPLUS_INTERNAL_KEYS) needed++;
+        if (depth - needed < 0) needed++;
+
+        sibling = create_leaf();
+        int allocated = 0;
+        while (sibling != NULL && allocated < needed && (spares[allocated] = create_internal()) != NULL){
+            allocated++;
+        }
+        if (sibling == NULL || allocated < needed){
+            free(sibling);
+            while (allocated > 0) free(spares[--allocated]);
+            return -1;
+        }
+
+        int left_count = BPLUS_LEAF_KEYS / 2;
+        int right_count = BPLUS_LEAF_KEYS - left_count;
+        memcpy(sibling->keys, leaf->keys + left_count, sizeof(int) * right_count);
+        memcpy(sibling->values, leaf->values + left_count, sizeof(int) * right_count);
+        sibling->header.count = right_count;
+        leaf->header.count = left_count;
+        sibling->next = leaf->next;
+        leaf->next = sibling;
+
+        if (position > left_count){
+            target = sibling;
+            position -= left_count;
+        }
+    }
+
+    int count = target->header.count;
+    memmove(target->keys + position + 1, target->keys + position, sizeof(int) * (count - position));
+    memmove(target->values + position + 1, target->values + position, sizeof(int) * (count - position));
+    target->keys[position] = key;
+    target->values[position] = value;
+    target->header.count++;
+    tree->size++;
+
+    if (sibling != NULL){
+        insert_into_parent(tree, path, path_index, tree->height - 2, &leaf->header, sibling->keys[0],
+                           &sibling->header, spares);
+    }
+    return 1;
+}
+
+/*
+ * Function: bplus_search
+ * ----------------------
+ * Looks up a key. Each level costs one aligned node and a SIMD scan.
+ *
+ * tree: pointer to the BPlusTree
+ * key: key to search for
+ * value: receives the associated value if found (may be NULL)
+ *
+ * returns: 1 if the key is present, 0 otherwise
+ */
+int bplus_search(BPlusTree *tree, int key, int *value){
+    if (tree == NULL) return 0;
+
+    BPlusLeaf *leaf = find_leaf(tree, key, NULL, NULL);
+    int position = count_less(leaf->keys, leaf->header.count, key);
+    if (position < leaf->header.count && leaf->keys[position] == key){
+        if (value != NULL) *value = leaf->values[position];
+        return 1;
+    }
+    return 0;
+}
+
+/* Removes keys[position] and children[position + 1] from an internal node */
+static void remove_from_internal(BPlusInternal *node, int position){
+    int count = node->header.count;
+    memmove(node->keys + position, node->keys + position + 1, sizeof(int) * (count - position - 1));
+    memmove(node->children + position + 1, node->children + position + 2,
+            sizeof(BPlusNode *) * (count - position - 1));
+    node->header.count--;
+}
+
+/*
+ * Function: rebalance_leaf
+ * ------------------------
+ * Fixes an underfull leaf by borrowing a key from a sibling under the same
+ * parent, or by merging with it when both are at the minimum.
+ *
+ * returns: 1 if the parent lost a key (and may be underfull itself), 0 otherwise
+ */
+static int rebalance_leaf(BPlusInternal *parent, int index){
+    BPlusLeaf *leaf = AS_LEAF(parent->children[index]);
+    BPlusLeaf *left = (index > 0) ? AS_LEAF(parent->children[index - 1]) : NULL;
+    BPlusLeaf *right = (index < parent->header.count) ? AS_LEAF(parent->children[index + 1]) : NULL;
+
+    if (left != NULL && left->header.count > BPLUS_LEAF_MIN){
+        int count = leaf->header.count;
+        memmove(leaf->keys + 1, leaf->keys, sizeof(int) * count);
+        memmove(leaf->values + 1, leaf->values, sizeof(int) * count);
+        left->header.count--;
+        leaf->keys[0] = left->keys[left->header.count];
+        leaf->values[0] = left->values[left->header.count];
+        leaf->header.count++;
+        parent->keys[index - 1] = leaf->keys[0];
+        return 0;
+    }
+    if (right != NULL && right->header.count > BPLUS_LEAF_MIN){
+        leaf->keys[leaf->header.count] = right->keys[0];
+        leaf->values[leaf->header.count] = right->values[0];
+        leaf->header.count++;
+        right->header.count--;
+        memmove(right->keys, right->keys + 1, sizeof(int) * right->header.count);
+        memmove(right->values, right->values + 1, sizeof(int) * right->header.count);
+        parent->keys[index] = right->keys[0];
+        return 0;
+    }
+
+    /* Merge the right one of the pair into the left one */
+    if (right == NULL){
+        right = leaf;
+        leaf = left;
+        index--;
+    }
+    memcpy(leaf->keys + leaf->header.count, right->keys, sizeof(int) * right->header.count);
+    memcpy(leaf->values + leaf->header.count, right->values, sizeof(int) * right->header.count);
+    leaf->header.count += right->header.count;
+    leaf->next = right->next;
+    free(right);
+    remove_from_internal(parent, index);
+    return 1;
+}
+
+/*
+ * Function: rebalance_internal
+ * ----------------------------
+ * Fixes an underfull internal node by rotating a key through the parent from
+ * a sibling, or by merging with the sibling and the separator between them.
+ *
+ * returns: 1 if the parent lost a key (and may be underfull itself), 0 otherwise
+ */
+static int rebalance_internal(BPlusInternal *parent, int index){
+    BPlusInternal *node = AS_INTERNAL(parent->children[index]);
+    BPlusInternal *left = (index > 0) ? AS_INTERNAL(parent->children[index - 1]) : NULL;
+    BPlusInternal *right = (index < parent->header.count) ? AS_INTERNAL(parent->children[index + 1]) : NULL;
+
+    if (left != NULL && left->header.count > BPLUS_INTERNAL_MIN){
+        int count = node->header.count;
+        memmove(node->keys + 1, node->keys, sizeof(int) * count);
+        memmove(node->children + 1, node->children, sizeof(BPlusNode *) * (count + 1));
+        node->keys[0] = parent->keys[index - 1];
+        node->children[0] = left->children[left->header.count];
+        node->header.count++;
+        parent->keys[index - 1] = left->keys[left->header.count - 1];
+        left->header.count--;
+        return 0;
+    }
+    if (right != NULL && right->header.count > BPLUS_INTERNAL_MIN){
+        int count = node->header.count;
+        node->keys[count] = parent->keys[index];
+        node->children[count + 1] = right->children[0];
+        node->header.count++;
+        parent->keys[index] = right->keys[0];
+        int right_count = right->header.count;
+        memmove(right->keys, right->keys + 1, sizeof(int) * (right_count - 1));
+        memmove(right->children, right->children + 1, sizeof(BPlusNode *) * right_count);
+        right->header.count--;
+        return 0;
+    }
+
+    if (right == NULL){
+        right = node;
+        node = left;
+        index--;
+    }
+    int count = node->header.count;
+    node->keys[count] = parent->keys[index];
+    memcpy(node->keys + count + 1, right->keys, sizeof(int) * right->header.count);
+    memcpy(node->children + count + 1, right->children, sizeof(BPlusNode *) * (right->header.count + 1));
+    node->header.count += right->header.count + 1;
+    free(right);
+    remove_from_internal(parent, index);
+    return 1;
+}
+
+/*
+ * Function: bplus_delete
+ * ----------------------
+ * Removes a key. Underfull nodes borrow from or merge with a sibling, and the
+ * root is collapsed when it is left with a single child.
+ *
+ * tree: pointer to the BPlusTree
+ * key: key to delete
+ *
+ * returns: 1 if deletion was successful, 0 if key not found
+ */
+int bplus_delete(BPlusTree *tree, int key){
+    if (tree == NULL) return 0;
+
+    BPlusInternal *path[BPLUS_MAX_HEIGHT];
+    int path_index[BPLUS_MAX_HEIGHT];
+    BPlusLeaf *leaf = find_leaf(tree, key, path, path_index);
+
+    int position = count_less(leaf->keys, leaf->header.count, key);
+    if (position >= leaf->header.count || leaf->keys[position] != key) return 0;
+
+    int count = leaf->header.count;
+    memmove(leaf->keys + position, leaf->keys + position + 1, sizeof(int) * (count - position - 1));
+    memmove(leaf->values + position, leaf->values + position + 1, sizeof(int) * (count - position - 1));
+    leaf->header.count--;
+    tree->size--;
+
+    int depth = tree->height - 2;
+    if (depth < 0 || leaf->header.count >= BPLUS_LEAF_MIN) return 1;
+
+    int shrunk = rebalance_leaf(path[depth], path_index[depth]);
+    while (shrunk && --depth >= 0 && path[depth + 1]->header.count < BPLUS_INTERNAL_MIN){
+        shrunk = rebalance_internal(path[depth], path_index[depth]);
+    }
+
+    BPlusNode *root = tree->root;
+    if (!root->is_leaf && root->count == 0){
+        tree->root = AS_INTERNAL(root)->children[0];
+        tree->height--;
+        free(root);
+    }
+    return 1;
+}
+
+/*
+ * Function: bplus_size
+ * --------------------
+ * Returns the number of keys in the tree.
+ *
+ * tree: pointer to the BPlusTree
+ *
+ * returns: number of keys, or -1 if tree is NULL
+ */
+long long bplus_size(BPlusTree *tree){
+    if (tree == NULL) return -1;
+    return tree->size;
+}
+
+/* Sums the allocation sizes of a subtree */
+static long long node_memory(BPlusNode *node){
+    if (node->is_leaf) return LINES(sizeof(BPlusLeaf));
+
+    long long bytes = LINES(sizeof(BPlusInternal));
+    BPlusInternal *internal = AS_INTERNAL(node);
+    for (int i = 0; i <= node->count; i++) bytes += node_memory(internal->children[i]);
+    return bytes;
+}
+
+/*
+ * Function: bplus_memory_usage
+ * ----------------------------
+ * Computes the bytes allocated for the tree and its nodes.
+ *
+ * tree: pointer to the BPlusTree
+ *
+ * returns: memory usage in bytes, or -1 if tree is NULL
+ */
+long long bplus_memory_usage(BPlusTree *tree){
+    if (tree == NULL) return -1;
+    return sizeof(BPlusTree) + node_memory(tree->root);
+}
+
+/*
+ * Function: bplus_seek
+ * --------------------
+ * Positions an iterator at the first key >= key. Iteration then walks the
+ * linked leaves without touching internal nodes or allocating.
+ *
+ * tree: pointer to the BPlusTree
+ * key: lower bound of the scan
+ * iterator: iterator to position
+ *
+ * returns: void
+ */
+void bplus_seek(BPlusTree *tree, int key, BPlusIterator *iterator){
+    if (iterator == NULL) return;
+    if (tree == NULL){
+        iterator->leaf = NULL;
+        iterator->index = 0;
+        return;
+    }
+
+    BPlusLeaf *leaf = find_leaf(tree, key, NULL, NULL);
+    iterator->leaf = leaf;
+    iterator->index = count_less(leaf->keys, leaf->header.count, key);
+}
+
+/*
+ * Function: bplus_next
+ * --------------------
+ * Returns the entry under the iterator and advances it.
+ *
+ * iterator: iterator positioned by bplus_seek
+ * key: receives the key (may be NULL)
+ * value: receives the value (may be NULL)
+ *
+ * returns: 1 if an entry was returned, 0 at the end of the tree
+ */
+int bplus_next(BPlusIterator *iterator, int *key, int *value){
+    if (iterator == NULL) return 0;
+
+    while (iterator->leaf != NULL && iterator->index >= iterator->leaf->header.count){
+        iterator->leaf = iterator->leaf->next;
+        iterator->index = 0;
+    }
+    if (iterator->leaf == NULL) return 0;
+
+    if (key != NULL) *key = iterator->leaf->keys[iterator->index];
+    if (value != NULL) *value = iterator->leaf->values[iterator->index];
+    iterator->index++;
+    return 1;
+}
+
+/*
+ * Function: bplus_range_count
+ * ---------------------------
+ * Counts the keys in [low, high] by scanning the linked leaves, counting
+ * whole leaves at a time.
+ *
+ * tree: pointer to the BPlusTree
+ * low: inclusive lower bound
+ * high: inclusive upper bound
+ *
+ * returns: number of keys in the range, 0 if the range is empty or tree is NULL
+ */
+long long bplus_range_count(BPlusTree *tree, int low, int high){
+    if (tree == NULL || low > high) return 0;
+
+    BPlusIterator iterator;
+    bplus_seek(tree, low, &iterator);
+
+    long long count = 0;
+    BPlusLeaf *leaf = iterator.leaf;
+    int start = iterator.index;
+    while (leaf != NULL){
+        int n = leaf->header.count;
+        if (n > 0 && leaf->keys[n - 1] > high){
+            count += count_less_equal(leaf->keys, n, high) - start;
+            break;
+        }
+        count += n - start;
+        leaf = leaf->next;
+        start = 0;
+    }
+    return count;
+}
@@ -0,0 +1,327 @@
+#include "c_bit_vector.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WORDS_PER_BLOCK 8          /* 512-bit rank blocks: one cache line of words */
+#define SELECT_SAMPLE_RATE 512     /* One select sample per this many set bits */
+
+/*
+ * Function: create_bit_vector
+ * ---------------------------
+ * Allocates a bit vector of the given size with every bit cleared.
+ *
+ * size: number of bits
+ *
+ * returns: pointer to the created BitVector, or NULL if allocation fails or size is invalid
+ */
+BitVector *create_bit_vector(long long size){
+    if (size <= 0) return NULL;
+
+    BitVector *bits = malloc(sizeof(BitVector));
+    if (bits == NULL) return NULL;
+
+    bits->size = size;
+    bits->word_count = (size + 63) / 64;
+    bits->words = calloc(bits->word_count, sizeof(unsigned long long));
+    if (bits->words == NULL){
+        free(bits);
+        return NULL;
+    }
+
+    bits->rank_blocks = NULL;
+    bits->select_samples = NULL;
+    bits->ones = 0;
+    bits->index_valid = 0;
+    return bits;
+}
+
+/*
+ * Function: destroy_bit_vector
+ * ----------------------------
+ * Frees the bit vector and its rank/select index.
+ *
+ * bits: pointer to the BitVector to destroy
+ *
+ * returns: void
+ */
+void destroy_bit_vector(BitVector *bits){
+    if (bits == NULL) return;
+    free(bits->words);
+    free(bits->rank_blocks);
+    free(bits->select_samples);
+    free(bits);
+}
+
+/*
+ * Function: bit_vector_set
+ * ------------------------
+ * Sets a bit. Out-of-range indices are ignored.
+ *
+ * bits: pointer to the BitVector
+ * index: bit to set
+ *
+ * returns: void
+ */
+void bit_vector_set(BitVector *bits, long long index){
+    if (bits == NULL || index < 0 || index >= bits->size) return;
+    bits->words[index >> 6] |= 1ULL << (index & 63);
+    bits->index_valid = 0;
+}
+
+/*
+ * Function: bit_vector_clear
+ * --------------------------
+ * Clears a bit. Out-of-range indices are ignored.
+ *
+ * bits: pointer to the BitVector
+ * index: bit to clear
+ *
+ * returns: void
+ */
+void bit_vector_clear(BitVector *bits, long long index){
+    if (bits == NULL || index < 0 || index >= bits->size) return;
+    bits->words[index >> 6] &= ~(1ULL << (index & 63));
+    bits->index_valid = 0;
+}
+
+/*
+ * Function: bit_vector_get
+ * ------------------------
+ * Reads a bit.
+ *
+ * bits: pointer to the BitVector
+ * index: bit to read
+ *
+ * returns: 1 if set, 0 if clear, -1 if bits is NULL or index is out of range
+ */
+int bit_vector_get(BitVector *bits, long long index){
+    if (bits == NULL || index < 0 || index >= bits->size) return -1;
+    return (int)((bits->words[index >> 6] >> (index & 63)) & 1);
+}
+
+/*
+ * Function: bit_vector_test_and_set
+ * ---------------------------------
+ * Sets a bit and reports whether it was already set, e.g. to mark a vertex
+ * as visited and learn whether it had been seen in one step.
+ *
+ * bits: pointer to the BitVector
+ * index: bit to set
+ *
+ * returns: previous value of the bit (0 or 1), or -1 if index is out of range
+ */
+int bit_vector_test_and_set(BitVector *bits, long long index){
+    if (bits == NULL || index < 0 || index >= bits->size) return -1;
+
+    unsigned long long mask = 1ULL << (index & 63);
+    unsigned long long *word = &bits->words[index >> 6];
+    int previous = (*word & mask) != 0;
+    *word |= mask;
+    bits->index_valid = 0;
+    return previous;
+}
+
+/*
+ * Function: bit_vector_reset
+ * --------------------------
+ * Clears every bit.
+ *
+ * bits: pointer to the BitVector
+ *
+ * returns: void
+ */
+void bit_vector_reset(BitVector *bits){
+    if (bits == NULL) return;
+    memset(bits->words, 0, sizeof(unsigned long long) * bits->word_count);
+    bits->index_valid = 0;
+}
+
+/*
+ * Function: bit_vector_and
+ * ------------------------
+ * Computes dst &= src one 64-bit word at a time.
+ *
+ * dst: pointer to the BitVector receiving the result
+ * src: pointer to a BitVector of the same size
+ *
+ * returns: 1 if successful, -1 if an argument is NULL or the sizes differ
+ */
+int bit_vector_and(BitVector *dst, BitVector *src){
+    if (dst == NULL || src == NULL || dst->size != src->size) return -1;
+    for (long long i = 0; i < dst->word_count; i++) dst->words[i] &= src->words[i];
+    dst->index_valid = 0;
+    return 1;
+}
+
+/*
+ * Function: bit_vector_or
+ * -----------------------
+ * Computes dst |= src one 64-bit word at a time.
+ *
+ * dst: pointer to the BitVector receiving the result
+ * src: pointer to a BitVector of the same size
+ *
+ * returns: 1 if successful, -1 if an argument is NULL or the sizes differ
+ */
+int bit_vector_or(BitVector *dst, BitVector *src){
+    if (dst == NULL || src == NULL || dst->size != src->size) return -1;
+    for (long long i = 0; i < dst->word_count; i++) dst->words[i] |= src->words[i];
+    dst->index_valid = 0;
+    return 1;
+}
+
+/*
+ * Function: bit_vector_andnot
+ * ---------------------------
+ * Computes dst &= ~src one 64-bit word at a time (set difference).
+ *
+ * dst: pointer to the BitVector receiving the result
+ * src: pointer to a BitVector of the same size
+ *
+ * returns: 1 if successful, -1 if an argument is NULL or the sizes differ
+ */
+int bit_vector_andnot(BitVector *dst, BitVector *src){
+    if (dst == NULL || src == NULL || dst->size != src->size) return -1;
+    for (long long i = 0; i < dst->word_count; i++) dst->words[i] &= ~src->words[i];
+    dst->index_valid = 0;
+    return 1;
+}
+
+/*
+ * Function: bit_vector_count
+ * --------------------------
+ * Counts the set bits with one popcount per word.
+ *
+ * bits: pointer to the BitVector
+ *
+ * returns: number of set bits, or -1 if bits is NULL
+ */
+long long bit_vector_count(BitVector *bits){
+    if (bits == NULL) return -1;
+    long long count = 0;
+    for (long long i = 0; i < bits->word_count; i++) count += __builtin_popcountll(bits->words[i]);
+    return count;
+}
+
+/*
+ * Function: bit_vector_build_index
+ * --------------------------------
+ * Builds the rank/select acceleration structures: the number of set bits
+ * before every 512-bit block, and the block holding every 512th set bit.
+ * rank and select call this automatically after any modification.
+ *
+ * bits: pointer to the BitVector
+ *
+ * returns: 1 if successful, -1 if bits is NULL or allocation fails
+ */
+int bit_vector_build_index(BitVector *bits){
+    if (bits == NULL) return -1;
+    if (bits->index_valid) return 1;
+
+    long long block_count = (bits->word_count + WORDS_PER_BLOCK - 1) / WORDS_PER_BLOCK;
+    unsigned long long *rank_blocks = malloc(sizeof(unsigned long long) * (block_count + 1));
+    if (rank_blocks == NULL) return -1;
+
+    long long ones = 0;
+    for (long long block = 0; block < block_count; block++){
+        rank_blocks[block] = ones;
+        long long end = (block + 1) * WORDS_PER_BLOCK;
+        if (end > bits->word_count) end = bits->word_count;
+        for (long long w = block * WORDS_PER_BLOCK; w < end; w++) ones += __builtin_popcountll(bits->words[w]);
+    }
+    rank_blocks[block_count] = ones;
+
+    long long sample_count = (ones + SELECT_SAMPLE_RATE - 1) / SELECT_SAMPLE_RATE;
+    long long *select_samples = malloc(sizeof(long long) * (sample_count + 1));
+    if (select_samples == NULL){
+        free(rank_blocks);
+        return -1;
+    }
+
+    /* Sample j records the block containing the (j * SELECT_SAMPLE_RATE)-th set bit */
+    long long sample = 0;
+    for (long long block = 0; block < block_count && sample < sample_count; block++){
+        while (sample < sample_count && (unsigned long long)(sample * SELECT_SAMPLE_RATE) < rank_blocks[block + 1]){
+            select_samples[sample++] = block;
+        }
+    }
+    select_samples[sample_count] = (block_count > 0) ? block_count - 1 : 0;
+
+    free(bits->rank_blocks);
+    free(bits->select_samples);
+    bits->rank_blocks = rank_blocks;
+    bits->select_samples = select_samples;
+    bits->ones = ones;
+    bits->index_valid = 1;
+    return 1;
+}
+
+/*
+ * Function: bit_vector_rank
+ * -------------------------
+ * Counts the set bits strictly before index in O(1): one block lookup plus at
+ * most eight popcounts.
+ *
+ * bits: pointer to the BitVector
+ * index: position to rank, clamped to [0, size]
+ *
+ * returns: number of set bits in [0, index), or -1 if bits is NULL or the index cannot be built
+ */
+long long bit_vector_rank(BitVector *bits, long long index){
+    if (bit_vector_build_index(bits) == -1) return -1;
+    if (index <= 0) return 0;
+    if (index >= bits->size) return bits->ones;
+
+    long long word = index >> 6;
+    long long block = word / WORDS_PER_BLOCK;
+    long long rank = (long long)bits->rank_blocks[block];
+    for (long long w = block * WORDS_PER_BLOCK; w < word; w++) rank += __builtin_popcountll(bits->words[w]);
+
+    int offset = index & 63;
+    if (offset) rank += __builtin_popcountll(bits->words[word] & ((1ULL << offset) - 1));
+    return rank;
+}
+
+/* Position of the k-th (0-based) set bit within a word */
+static int select_in_word(unsigned long long word, int k){
+    for (int i = 0; i < k; i++) word &= word - 1;
+    return __builtin_ctzll(word);
+}
+
+/*
+ * Function: bit_vector_select
+ * ---------------------------
+ * Finds the position of the k-th set bit (0-based). The select samples narrow
+ * the search to a few blocks, which are then binary searched by rank.
+ *
+ * bits: pointer to the BitVector
+ * k: zero-based rank of the set bit to find
+ *
+ * returns: index of the k-th set bit, or -1 if fewer than k + 1 bits are set
+ */
+long long bit_vector_select(BitVector *bits, long long k){
+    if (bit_vector_build_index(bits) == -1) return -1;
+    if (k < 0 || k >= bits->ones) return -1;
+
+    long long sample = k / SELECT_SAMPLE_RATE;
+    long long lo = bits->select_samples[sample];
+    long long hi = bits->select_samples[sample + 1];
+
+    /* Last block whose preceding count is <= k */
+    while (lo < hi){
+        long long mid = lo + (hi - lo + 1) / 2;
+        if (bits->rank_blocks[mid] <= (unsigned long long)k)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    long long remaining = k - (long long)bits->rank_blocks[lo];
+    for (long long w = lo * WORDS_PER_BLOCK; w < bits->word_count; w++){
+        int count = __builtin_popcountll(bits->words[w]);
+        if (remaining < count) return w * 64 + select_in_word(bits->words[w], (int)remaining);
+        remaining -= count;
+    }
+    return -1;
+}
@@ -0,0 +1,206 @@
+#include "c_concurrent_vector.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define FIRST_SEGMENT_SIZE (1LL << CONCURRENT_VECTOR_FIRST_SEGMENT_BITS)
+
+/*
+ * Segment layout: (FIRST_SEGMENT_SIZE << k) ints followed by one ready bit per
+ * element. A bit is set once its element has been written, which lets any
+ * producer advance the published size past it.
+ */
+static inline atomic_ullong *ready_bits(int *segment, int k){
+    return (atomic_ullong *)(segment + (FIRST_SEGMENT_SIZE << k));
+}
+
+/*
+ * Function: locate
+ * ----------------
+ * Maps a global index to its segment and offset. Segment k starts at
+ * FIRST_SEGMENT_SIZE * (2^k - 1), so the segment is the position of the
+ * highest set bit of (index + FIRST_SEGMENT_SIZE).
+ */
+static inline void locate(long long index, int *segment, long long *offset){
+    unsigned long long position = (unsigned long long)index + FIRST_SEGMENT_SIZE;
+    int high_bit = 63 - __builtin_clzll(position);
+    *segment = high_bit - CONCURRENT_VECTOR_FIRST_SEGMENT_BITS;
+    *offset = (long long)(position - (1ULL << high_bit));
+}
+
+/*
+ * Function: ensure_segment
+ * ------------------------
+ * Returns the segment, allocating it if no producer has yet. Racing producers
+ * each allocate, one wins the compare-and-swap, and the others free their copy.
+ *
+ * returns: pointer to the segment, or NULL if allocation fails
+ */
+static int *ensure_segment(ConcurrentVector *vector, int segment){
+    int *current = atomic_load_explicit(&vector->segments[segment], memory_order_acquire);
+    if (current != NULL) return current;
+
+    long long elements = FIRST_SEGMENT_SIZE << segment;
+    int *fresh = calloc(1, sizeof(int) * elements + elements / 8); /* Zeroed ready bits */
+    if (fresh == NULL) return NULL;
+
+    int *expected = NULL;
+    if (atomic_compare_exchange_strong_explicit(&vector->segments[segment], &expected, fresh, memory_order_acq_rel,
+                                                memory_order_acquire)){
+        return fresh;
+    }
+    free(fresh);
+    return expected;
+}
+
+/*
+ * Function: create_concurrent_vector
+ * ----------------------------------
+ * Allocates an empty segmented vector. Segments are allocated on demand.
+ *
+ * returns: pointer to the created ConcurrentVector, or NULL if allocation fails
+ */
+ConcurrentVector *create_concurrent_vector(void){
+    ConcurrentVector *vector = malloc(sizeof(ConcurrentVector));
+    if (vector == NULL) return NULL;
+
+    for (int i = 0; i < CONCURRENT_VECTOR_MAX_SEGMENTS; i++) atomic_init(&vector->segments[i], NULL);
+    atomic_init(&vector->reserved, 0);
+    atomic_init(&vector->size, 0);
+    atomic_init(&vector->failed, 0);
+    return vector;
+}
+
+/*
+ * Function: destroy_concurrent_vector
+ * -----------------------------------
+ * Frees the vector and all of its segments. No other thread may be using it.
+ *
+ * vector: pointer to the ConcurrentVector to destroy
+ *
+ * returns: void
+ */
+void destroy_concurrent_vector(ConcurrentVector *vector){
+    if (vector == NULL) return;
+    for (int i = 0; i < CONCURRENT_VECTOR_MAX_SEGMENTS; i++) {
+        free(atomic_load_explicit(&vector->segments[i], memory_order_relaxed));
+    }
+    free(vector);
+}
+
+/*
+ * Function: concurrent_current_size
+ * ---------------------------------
+ * Returns the number of published elements. Every index below this value can
+ * be read from any thread.
+ *
+ * vector: pointer to the ConcurrentVector
+ *
+ * returns: size of the vector, or -1 if vector is NULL
+ */
+long long concurrent_current_size(ConcurrentVector *vector){
+    if (vector == NULL) return -1;
+    return atomic_load_explicit(&vector->size, memory_order_acquire);
+}
+
+/*
+ * Function: is_ready
+ * ------------------
+ * Checks whether the element at index has been written by its producer.
+ */
+static int is_ready(ConcurrentVector *vector, long long index){
+    int segment;
+    long long offset;
+    locate(index, &segment, &offset);
+    if (segment >= CONCURRENT_VECTOR_MAX_SEGMENTS) return 0;
+
+    int *storage = atomic_load(&vector->segments[segment]);
+    if (storage == NULL) return 0;
+    return (atomic_load(&ready_bits(storage, segment)[offset / 64]) >> (offset % 64)) & 1;
+}
+
+/*
+ * Function: concurrent_add_at_end
+ * -------------------------------
+ * Appends a value. Safe to call from many producer threads at once: each
+ * producer reserves a slot with fetch-add, writes it, marks it ready, and then
+ * advances the published size over every consecutive ready slot. No producer
+ * waits for another, and readers never see a gap. Elements never move, so
+ * pointers returned by concurrent_vector_at stay valid.
+ *
+ * vector: pointer to the ConcurrentVector
+ * value: integer value to add
+ *
+ * Once a segment allocation fails, size can never pass the failed slot, so
+ * later slots are never published. An append that finds the vector failed
+ * and its slot unpublished returns -1. One that finishes before a producer
+ * with an earlier slot fails may still return an index that never becomes
+ * readable, so after a failure only indices below concurrent_current_size
+ * hold stored values.
+ *
+ * returns: index of the appended value, or -1 if vector is NULL, a segment
+ *          could not be allocated, or the value can no longer be published
+ */
+long long concurrent_add_at_end(ConcurrentVector *vector, int value){
+    if (vector == NULL || atomic_load_explicit(&vector->failed, memory_order_relaxed)) return -1;
+
+    long long index = atomic_fetch_add_explicit(&vector->reserved, 1, memory_order_relaxed);
+    int segment;
+    long long offset;
+    locate(index, &segment, &offset);
+
+    int *storage = (segment < CONCURRENT_VECTOR_MAX_SEGMENTS) ? ensure_segment(vector, segment) : NULL;
+    if (storage == NULL){
+        atomic_store(&vector->failed, 1);
+        return -1;
+    }
+    storage[offset] = value;
+    atomic_fetch_or(&ready_bits(storage, segment)[offset / 64], 1ULL << (offset % 64));
+
+    /*
+     * Publish: move size over consecutive ready slots. Sequentially consistent
+     * operations guarantee that either this producer sees the slot before it
+     * published, or that slot's producer sees this one ready, so no slot is stranded.
+     */
+    long long size = atomic_load(&vector->size);
+    while (is_ready(vector, size)){
+        if (atomic_compare_exchange_weak(&vector->size, &size, size + 1)) size++;
+    }
+    if (atomic_load(&vector->failed) && atomic_load(&vector->size) <= index) return -1;
+    return index;
+}
+
+/*
+ * Function: concurrent_vector_at
+ * ------------------------------
+ * Returns a stable pointer to a published element. Wait-free.
+ *
+ * vector: pointer to the ConcurrentVector
+ * index: position to access
+ *
+ * returns: pointer to the element, or NULL if index is not published yet
+ */
+const int *concurrent_vector_at(ConcurrentVector *vector, long long index){
+    if (vector == NULL || index < 0) return NULL;
+    if (index >= atomic_load_explicit(&vector->size, memory_order_acquire)) return NULL;
+
+    int segment;
+    long long offset;
+    locate(index, &segment, &offset);
+    return atomic_load_explicit(&vector->segments[segment], memory_order_relaxed) + offset;
+}
+
+/*
+ * Function: concurrent_get_value_at_index
+ * ---------------------------------------
+ * Returns the value at a specific index. Wait-free and safe to call from any
+ * thread while producers append.
+ *
+ * vector: pointer to the ConcurrentVector
+ * index: position to access
+ *
+ * returns: value at the index, or -1 if invalid index or not yet published
+ */
+int concurrent_get_value_at_index(ConcurrentVector *vector, long long index){
+    const int *element = concurrent_vector_at(vector, index);
+    return (element != NULL) ? *element : -1;
+}
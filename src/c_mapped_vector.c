@@ -0,0 +1,317 @@
+#define _GNU_SOURCE
+#include "c_mapped_vector.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define MAPPED_VECTOR_MAGIC 0x31504d4345564343ULL /* "CCVECMP1" */
+
+/* Bytes needed in the backing file for a given element capacity */
+static unsigned long long mapped_length(long long capacity){
+    return sizeof(MappedVectorHeader) + (unsigned long long)capacity * sizeof(int);
+}
+
+/* Re-derives the header and element pointers after the mapping moved */
+static void mapped_bind(MappedVector *vector, void *map, unsigned long long length){
+    vector->map = map;
+    vector->map_length = length;
+    vector->header = map;
+    vector->collection = (int *)((char *)map + sizeof(MappedVectorHeader));
+}
+
+/*
+ * Function: mapped_remap
+ * ----------------------
+ * Grows the backing file with ftruncate and extends the mapping with mremap.
+ * The kernel may move the mapping but never copies the file contents.
+ *
+ * vector: pointer to the MappedVector
+ * new_capacity: capacity to grow to, in elements
+ *
+ * returns: 1 if successful, -1 if the file or mapping cannot be grown
+ */
+static int mapped_remap(MappedVector *vector, long long new_capacity){
+    unsigned long long new_length = mapped_length(new_capacity);
+    if (ftruncate(vector->fd, (off_t)new_length) == -1) return -1;
+
+    void *map = mremap(vector->map, vector->map_length, new_length, MREMAP_MAYMOVE);
+    if (map == MAP_FAILED) return -1;
+
+    mapped_bind(vector, map, new_length);
+    vector->header->capacity = new_capacity;
+    return 1;
+}
+
+/*
+ * Function: open_mapped_vector
+ * ----------------------------
+ * Opens the vector stored in a file, creating the file if it does not exist.
+ * Existing files are mapped without reading them; the kernel pages elements in
+ * lazily on first access, so reopening is near-instant regardless of size.
+ *
+ * path: path of the backing file
+ * capacity: initial capacity for a new file; for an existing file, the
+ *           capacity is grown to at least this value
+ *
+ * returns: pointer to the opened MappedVector, or NULL if the file cannot be
+ *          opened, is not a mapped vector, or capacity is invalid
+ */
+MappedVector *open_mapped_vector(const char *path, long long capacity){
+    if (path == NULL || capacity <= 0) return NULL;
+
+    MappedVector *vector = malloc(sizeof(MappedVector));
+    if (vector == NULL) return NULL;
+
+    vector->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (vector->fd == -1){
+        free(vector);
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(vector->fd, &st) == -1) goto fail;
+
+    int is_new = (st.st_size == 0);
+    unsigned long long length;
+    if (is_new){
+        length = mapped_length(capacity);
+        if (ftruncate(vector->fd, (off_t)length) == -1) goto fail;
+    }
+    else{
+        if ((unsigned long long)st.st_size < sizeof(MappedVectorHeader)) goto fail;
+        length = (unsigned long long)st.st_size;
+    }
+
+    void *map = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, vector->fd, 0);
+    if (map == MAP_FAILED) goto fail;
+    mapped_bind(vector, map, length);
+
+    if (is_new){
+        memset(vector->header, 0, sizeof(MappedVectorHeader));
+        vector->header->magic = MAPPED_VECTOR_MAGIC;
+        vector->header->size = 0;
+        vector->header->capacity = capacity;
+        return vector;
+    }
+
+    /* Validate an existing file before trusting its header */
+    MappedVectorHeader *header = vector->header;
+    if (header->magic != MAPPED_VECTOR_MAGIC || header->size < 0 || header->size > header->capacity ||
+        mapped_length(header->capacity) > length){
+        munmap(map, length);
+        goto fail;
+    }
+
+    if (capacity > header->capacity && mapped_remap(vector, capacity) == -1){
+        munmap(vector->map, vector->map_length);
+        goto fail;
+    }
+    return vector;
+
+fail:
+    close(vector->fd);
+    free(vector);
+    return NULL;
+}
+
+/*
+ * Function: close_mapped_vector
+ * -----------------------------
+ * Unmaps the vector and closes its file. Dirty pages are written back by the
+ * kernel; call mapped_vector_sync first if they must reach disk immediately.
+ *
+ * vector: pointer to the MappedVector to close
+ *
+ * returns: void
+ */
+void close_mapped_vector(MappedVector *vector){
+    if (vector == NULL) return;
+    munmap(vector->map, vector->map_length);
+    close(vector->fd);
+    free(vector);
+}
+
+/*
+ * Function: mapped_vector_sync
+ * ----------------------------
+ * Flushes the mapped elements and header to the backing file.
+ *
+ * vector: pointer to the MappedVector
+ *
+ * returns: 1 if successful, -1 if vector is NULL or msync fails
+ */
+int mapped_vector_sync(MappedVector *vector){
+    if (vector == NULL) return -1;
+    return (msync(vector->map, vector->map_length, MS_SYNC) == 0) ? 1 : -1;
+}
+
+/*
+ * Function: mapped_current_size
+ * -----------------------------
+ * Returns the current number of elements in the mapped vector.
+ *
+ * vector: pointer to the MappedVector
+ *
+ * returns: size of the vector, or -1 if vector is NULL
+ */
+long long mapped_current_size(MappedVector *vector){
+    if (vector == NULL) return -1;
+    return vector->header->size;
+}
+
+/*
+ * Function: mapped_current_capacity
+ * ---------------------------------
+ * Returns the number of elements the backing file can hold without growing.
+ *
+ * vector: pointer to the MappedVector
+ *
+ * returns: capacity of the vector, or -1 if vector is NULL
+ */
+long long mapped_current_capacity(MappedVector *vector){
+    if (vector == NULL) return -1;
+    return vector->header->capacity;
+}
+
+/*
+ * Function: mapped_add_at_end
+ * ---------------------------
+ * Adds a value to the end of the mapped vector, growing the file if necessary.
+ *
+ * vector: pointer to the MappedVector
+ * value: integer value to add
+ *
+ * returns: 1 if successful, -1 if error occurs
+ */
+int mapped_add_at_end(MappedVector *vector, int value){
+    if (vector == NULL) return -1;
+
+    if (vector->header->size == vector->header->capacity){
+        if (mapped_resize_auto(vector) == -1) return -1;
+    }
+
+    vector->collection[vector->header->size] = value;
+    vector->header->size++;
+    return 1;
+}
+
+/*
+ * Function: mapped_remove_at_end
+ * ------------------------------
+ * Removes and returns the last element in the mapped vector.
+ * The file keeps its size so later appends do not need to grow it again.
+ *
+ * vector: pointer to the MappedVector
+ *
+ * returns: value of removed element, or -1 if vector is NULL or empty
+ */
+int mapped_remove_at_end(MappedVector *vector){
+    if (vector == NULL || vector->header->size == 0) return -1;
+
+    vector->header->size--;
+    return vector->collection[vector->header->size];
+}
+
+/*
+ * Function: mapped_resize_auto
+ * ----------------------------
+ * Doubles the capacity of the mapped vector by growing the file and the mapping.
+ *
+ * vector: pointer to the MappedVector
+ *
+ * returns: 1 if successful, -1 if the file or mapping cannot be grown
+ */
+int mapped_resize_auto(MappedVector *vector){
+    if (vector == NULL) return -1;
+    return mapped_remap(vector, vector->header->capacity * 2);
+}
+
+/*
+ * Function: mapped_get_value_at_index
+ * -----------------------------------
+ * Returns the value at a specific index in the mapped vector.
+ *
+ * vector: pointer to the MappedVector
+ * index: position to access
+ *
+ * returns: value at the index, or -1 if invalid index or empty vector
+ */
+int mapped_get_value_at_index(MappedVector *vector, long long index){
+    if (vector == NULL || vector->header->size == 0) return -1;
+
+    if (index < 0 || index >= vector->header->size) return -1;
+
+    return vector->collection[index];
+}
+
+/*
+ * Function: mapped_set_at_index
+ * -----------------------------
+ * Inserts or updates a value at a specific index, with the same semantics as
+ * set_at_index: elements at or after index shift right, and gaps beyond the
+ * current size are filled with 0.
+ *
+ * vector: pointer to the MappedVector
+ * index: position to insert/update
+ * value: integer value to set
+ *
+ * returns: pointer to the updated vector, or NULL if the file cannot be grown
+ */
+MappedVector *mapped_set_at_index(MappedVector *vector, long long index, int value){
+    if (vector == NULL || index < 0) return NULL;
+
+    MappedVectorHeader *header = vector->header;
+    long long needed = (index >= header->size) ? index + 1 : header->size + 1;
+    if (needed > header->capacity){
+        long long new_capacity = header->capacity;
+        while (new_capacity < needed) new_capacity *= 2;
+        if (mapped_remap(vector, new_capacity) == -1) return NULL;
+        header = vector->header;
+    }
+
+    if (index < header->size){
+        memmove(vector->collection + index + 1, vector->collection + index,
+                sizeof(int) * (header->size - index));
+        vector->collection[index] = value;
+        header->size++;
+    }
+    else{
+        // Fill any gaps with 0 if index is beyond current size
+        memset(vector->collection + header->size, 0, sizeof(int) * (index - header->size));
+        vector->collection[index] = value;
+        header->size = index + 1;
+    }
+
+    return vector;
+}
+
+/*
+ * Function: mapped_vector_view
+ * ----------------------------
+ * Fills a Vector that borrows the mapped elements so the read-only Vector
+ * accessors (get_value_at_index, current_size, ...) and kernels work on them
+ * directly. The view is invalidated by any operation that grows the mapping,
+ * and must never be passed to destroy_vector or to functions that resize it.
+ *
+ * vector: pointer to the MappedVector
+ * view: Vector to fill
+ *
+ * returns: 1 if successful, -1 if an argument is NULL or the vector has more
+ *          elements than a Vector can index
+ */
+int mapped_vector_view(MappedVector *vector, Vector *view){
+    if (vector == NULL || view == NULL) return -1;
+    if (vector->header->size > INT_MAX) return -1;
+
+    long long capacity = vector->header->capacity;
+    memset(view, 0, sizeof(Vector));
+    view->collection = vector->collection;
+    view->size = (int)vector->header->size;
+    view->capacity = (capacity > INT_MAX) ? view->size : (int)capacity;
+    return 1;
+}
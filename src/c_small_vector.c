@@ -0,0 +1,262 @@
+#include "c_small_vector.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Function: init_small_vector
+ * ---------------------------
+ * Initializes a small vector in caller-provided storage (e.g. on the stack).
+ * No memory is allocated until more than SMALL_VECTOR_INLINE_CAPACITY elements are added.
+ *
+ * vector: pointer to the SmallVector to initialize
+ *
+ * returns: void
+ */
+void init_small_vector(SmallVector *vector){
+    if (vector == NULL) return;
+    vector->heap = NULL;
+    vector->capacity = SMALL_VECTOR_INLINE_CAPACITY;
+    vector->size = 0;
+}
+
+/*
+ * Function: free_small_vector
+ * ---------------------------
+ * Releases the heap storage of a small vector initialized with init_small_vector
+ * and resets it to its empty inline state. The SmallVector itself is not freed.
+ *
+ * vector: pointer to the SmallVector
+ *
+ * returns: void
+ */
+void free_small_vector(SmallVector *vector){
+    if (vector == NULL) return;
+    free(vector->heap);
+    init_small_vector(vector);
+}
+
+/*
+ * Function: create_small_vector
+ * -----------------------------
+ * Allocates a small vector able to hold at least capacity elements.
+ * Capacities up to SMALL_VECTOR_INLINE_CAPACITY need a single allocation.
+ *
+ * capacity: initial capacity of the vector
+ *
+ * returns: pointer to the created SmallVector, or NULL if allocation fails or capacity is invalid
+ */
+SmallVector *create_small_vector(int capacity){
+    if (capacity <= 0) return NULL;
+
+    SmallVector *vector = malloc(sizeof(SmallVector));
+    if (vector == NULL) return NULL;
+    init_small_vector(vector);
+
+    if (capacity > SMALL_VECTOR_INLINE_CAPACITY){
+        vector->heap = malloc(sizeof(int) * capacity);
+        if (vector->heap == NULL){
+            free(vector);
+            return NULL;
+        }
+        vector->capacity = capacity;
+    }
+    return vector;
+}
+
+/*
+ * Function: destroy_small_vector
+ * ------------------------------
+ * Frees a small vector created with create_small_vector, including any heap spill.
+ *
+ * vector: pointer to the SmallVector to destroy
+ *
+ * returns: void
+ */
+void destroy_small_vector(SmallVector *vector){
+    if (vector == NULL) return;
+    free(vector->heap);
+    free(vector);
+}
+
+/*
+ * Function: small_vector_data
+ * ---------------------------
+ * Returns the storage currently holding the elements (inline or heap).
+ * The pointer is invalidated when the vector grows past its capacity.
+ *
+ * vector: pointer to the SmallVector
+ *
+ * returns: pointer to the first element, or NULL if vector is NULL
+ */
+int *small_vector_data(SmallVector *vector){
+    if (vector == NULL) return NULL;
+    return (vector->heap != NULL) ? vector->heap : vector->inline_storage;
+}
+
+/*
+ * Function: small_current_size
+ * ----------------------------
+ * Returns the current number of elements in the small vector.
+ *
+ * vector: pointer to the SmallVector
+ *
+ * returns: size of the vector, or -1 if vector is NULL
+ */
+int small_current_size(SmallVector *vector){
+    if (vector == NULL) return -1;
+    return vector->size;
+}
+
+/*
+ * Function: small_current_capacity
+ * --------------------------------
+ * Returns the total capacity of the small vector (inline or heap).
+ *
+ * vector: pointer to the SmallVector
+ *
+ * returns: capacity of the vector, or -1 if vector is NULL
+ */
+int small_current_capacity(SmallVector *vector){
+    if (vector == NULL) return -1;
+    return vector->capacity;
+}
+
+/*
+ * Function: small_isFull
+ * ----------------------
+ * Checks whether the small vector has reached its capacity.
+ *
+ * vector: pointer to the SmallVector
+ *
+ * returns: 1 if full, 0 otherwise
+ */
+int small_isFull(SmallVector *vector){
+    return (vector->size == vector->capacity) ? 1 : 0;
+}
+
+/*
+ * Function: small_add_at_end
+ * --------------------------
+ * Adds a value to the end of the small vector, spilling to the heap if necessary.
+ *
+ * vector: pointer to the SmallVector
+ * value: integer value to add
+ *
+ * returns: 1 if successful, -1 if error occurs
+ */
+int small_add_at_end(SmallVector *vector, int value){
+    if (vector == NULL) return -1;
+
+    if (small_isFull(vector)){
+        if (small_resize_auto(vector) == -1) return -1;
+    }
+
+    small_vector_data(vector)[vector->size] = value;
+    vector->size++;
+    return 1;
+}
+
+/*
+ * Function: small_remove_at_end
+ * -----------------------------
+ * Removes and returns the last element in the small vector.
+ *
+ * vector: pointer to the SmallVector
+ *
+ * returns: value of removed element, or -1 if vector is NULL or empty
+ */
+int small_remove_at_end(SmallVector *vector){
+    if (vector == NULL || vector->size == 0) return -1;
+
+    vector->size--;
+    return small_vector_data(vector)[vector->size];
+}
+
+/*
+ * Function: small_resize_auto
+ * ---------------------------
+ * Doubles the capacity of the small vector. The first resize moves the inline
+ * elements to the heap; later ones reallocate the heap buffer.
+ *
+ * vector: pointer to the SmallVector
+ *
+ * returns: 1 if successful, -1 if memory allocation fails
+ */
+int small_resize_auto(SmallVector *vector){
+    if (vector == NULL) return -1;
+
+    int new_capacity = vector->capacity * 2;
+    int *new_heap;
+
+    if (vector->heap == NULL){
+        new_heap = malloc(sizeof(int) * new_capacity);
+        if (new_heap == NULL) return -1;
+        memcpy(new_heap, vector->inline_storage, sizeof(int) * vector->size);
+    }
+    else{
+        new_heap = realloc(vector->heap, sizeof(int) * new_capacity);
+        if (new_heap == NULL) return -1;
+    }
+
+    vector->heap = new_heap;
+    vector->capacity = new_capacity;
+    return 1;
+}
+
+/*
+ * Function: small_get_value_at_index
+ * ----------------------------------
+ * Returns the value at a specific index in the small vector.
+ *
+ * vector: pointer to the SmallVector
+ * index: position to access
+ *
+ * returns: value at the index, or -1 if invalid index or empty vector
+ */
+int small_get_value_at_index(SmallVector *vector, int index){
+    if (vector == NULL || vector->size == 0) return -1;
+
+    if (index < 0 || index >= vector->size) return -1;
+
+    return small_vector_data(vector)[index];
+}
+
+/*
+ * Function: small_set_at_index
+ * ----------------------------
+ * Inserts or updates a value at a specific index, with the same semantics as
+ * set_at_index: elements at or after index shift right, and gaps beyond the
+ * current size are filled with 0.
+ *
+ * vector: pointer to the SmallVector
+ * index: position to insert/update
+ * value: integer value to set
+ *
+ * returns: pointer to the updated vector, or NULL if allocation fails
+ */
+SmallVector *small_set_at_index(SmallVector *vector, int index, int value){
+    if (vector == NULL || index < 0) return NULL;
+
+    // Make room for the target index and for the shifted element
+    while (index >= vector->capacity || vector->size >= vector->capacity) {
+        if (small_resize_auto(vector) == -1) return NULL;
+    }
+
+    int *data = small_vector_data(vector);
+    if (index < vector->size) {
+        memmove(data + index + 1, data + index, sizeof(int) * (vector->size - index));
+        data[index] = value;
+        vector->size++;
+    }
+    else {
+        // Fill any gaps with 0 if index is beyond current size
+        for (int i = vector->size; i < index; i++) {
+            data[i] = 0;
+        }
+        data[index] = value;
+        vector->size = index + 1;
+    }
+
+    return vector;
+}
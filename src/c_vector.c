@@ -1,6 +1,122 @@
+#define _GNU_SOURCE
 #include "c_vector.h"
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#define VECTOR_HAS_MREMAP 1
+#endif
+
+#ifdef VECTOR_HAS_MREMAP
+/*
+ * Function: map_bytes
+ * -------------------
+ * Rounds a buffer size up to whole pages, capped so the capacity still fits in an int.
+ *
+ * bytes: requested buffer size in bytes
+ *
+ * returns: page-aligned buffer size in bytes
+ */
+static long long map_bytes(long long bytes){
+    long long page = sysconf(_SC_PAGESIZE);
+    long long max_bytes = (long long)INT_MAX * sizeof(int) / page * page;
+    bytes = (bytes + page - 1) / page * page;
+    return (bytes > max_bytes) ? max_bytes : bytes;
+}
+
+/*
+ * Function: advise_huge_pages
+ * ---------------------------
+ * Asks the kernel to back a mapped buffer with transparent huge pages if the
+ * vector opted in. The advice is best effort; failures are ignored.
+ */
+static void advise_huge_pages(Vector *vector){
+#ifdef MADV_HUGEPAGE
+    if ((vector->flags & VECTOR_FLAG_MAPPED) && (vector->flags & VECTOR_FLAG_HUGE_PAGES)){
+        madvise(vector->collection, (size_t)vector->capacity * sizeof(int), MADV_HUGEPAGE);
+    }
+#else
+    (void)vector;
+#endif
+}
+#endif
+
+/*
+ * Function: vector_reallocate
+ * ---------------------------
+ * Moves the vector's elements into a buffer of at least new_capacity elements.
+ * Buffers below VECTOR_MMAP_THRESHOLD use realloc. Larger ones use page-aligned
+ * anonymous mappings grown in place by mremap, so the elements are copied at
+ * most once (when the buffer first crosses the threshold).
+ *
+ * vector: pointer to the Vector
+ * new_capacity: minimum capacity after the call
+ *
+ * returns: 1 if successful, -1 if memory allocation fails
+ */
+static int vector_reallocate(Vector *vector, long long new_capacity){
+    if (new_capacity > INT_MAX) new_capacity = INT_MAX;
+    if (new_capacity <= vector->capacity) return -1;
+
+#ifdef VECTOR_HAS_MREMAP
+    long long bytes = new_capacity * (long long)sizeof(int);
+    if (bytes >= VECTOR_MMAP_THRESHOLD || (vector->flags & VECTOR_FLAG_MAPPED)){
+        bytes = map_bytes(bytes);
+        if (bytes / (long long)sizeof(int) <= vector->capacity) return -1;
+
+        int *new_collection;
+        if (vector->flags & VECTOR_FLAG_MAPPED){
+            new_collection = mremap(vector->collection, (size_t)vector->capacity * sizeof(int), (size_t)bytes,
+                                    MREMAP_MAYMOVE);
+            if (new_collection == MAP_FAILED) return -1;
+        }
+        else{
+            new_collection = mmap(NULL, (size_t)bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (new_collection == MAP_FAILED) return -1;
+            if (vector->size > 0) memcpy(new_collection, vector->collection, sizeof(int) * vector->size);
+            free(vector->collection);
+            vector->flags |= VECTOR_FLAG_MAPPED;
+        }
+
+        vector->collection = new_collection;
+        vector->capacity = (int)(bytes / (long long)sizeof(int));
+        advise_huge_pages(vector);
+        return 1;
+    }
+#endif
+
+    int *new_collection = realloc(vector->collection, sizeof(int) * new_capacity);
+    if (new_collection == NULL) return -1;
+
+    vector->collection = new_collection;
+    vector->capacity = (int)new_capacity;
+    return 1;
+}
+
+/*
+ * Function: size_class_capacity
+ * -----------------------------
+ * Rounds a capacity up so its byte size lands on a malloc-style size class
+ * (four classes per power of two), so no allocator slack is wasted.
+ *
+ * capacity: minimum capacity
+ *
+ * returns: rounded capacity
+ */
+static long long size_class_capacity(long long capacity){
+    long long bytes = capacity * (long long)sizeof(int);
+    if (bytes <= 16) return 16 / sizeof(int);
+
+    long long power = 1;
+    while (power * 2 <= bytes) power *= 2;
+    long long step = power / 4;
+    bytes = (bytes + step - 1) / step * step;
+    return bytes / (long long)sizeof(int);
+}
 
 /*
  * Function: create_vector
@@ -17,14 +133,17 @@ Vector *create_vector(int capacity){
     Vector *vector = malloc(sizeof(Vector));
     if (vector == NULL) return NULL;
 
-    vector->collection = malloc(sizeof(int) * capacity);
-    if (vector->collection == NULL){
+    vector->collection = NULL;
+    vector->capacity = 0;
+    vector->size = 0;                        // Initialize size to 0
+    vector->growth = VECTOR_GROWTH_DOUBLE;   // Keep the classic doubling by default
+    vector->flags = 0;
+
+    // Large initial capacities start out mapped so later growth never copies
+    if (vector_reallocate(vector, capacity) == -1){
         free(vector);
         return NULL;
     }
-
-    vector->capacity = capacity;  // Set initial capacity
-    vector->size = 0;             // Initialize size to 0
     return vector;
 }
 
@@ -39,7 +158,14 @@ Vector *create_vector(int capacity){
  */
 void destroy_vector(Vector *vector){
     if (vector == NULL) return;
+#ifdef VECTOR_HAS_MREMAP
+    if (vector->flags & VECTOR_FLAG_MAPPED)
+        munmap(vector->collection, (size_t)vector->capacity * sizeof(int));
+    else
+        free(vector->collection);
+#else
     free(vector->collection);
+#endif
     free(vector);
 }
 
@@ -126,7 +252,8 @@ int remove_at_end(Vector *vector){
 /*
  * Function: resize_auto
  * ---------------------
- * Doubles the capacity of the vector when it becomes full.
+ * Grows the capacity of the vector according to its growth policy
+ * (doubling unless changed with vector_set_growth).
  *
  * vector: pointer to a pointer to the Vector
  *
@@ -134,15 +261,22 @@ int remove_at_end(Vector *vector){
  */
 int resize_auto(Vector **vector){
     if (vector == NULL || *vector == NULL) return -1;
-    
-    int new_capacity = (*vector)->capacity * 2;
-    int *new_collection = realloc((*vector)->collection, sizeof(int) * new_capacity);
-    
-    if (new_collection == NULL) return -1;
-    
-    (*vector)->collection = new_collection;
-    (*vector)->capacity = new_capacity;
-    return 1;
+
+    long long capacity = (*vector)->capacity;
+    long long new_capacity;
+    switch ((*vector)->growth){
+    case VECTOR_GROWTH_ONE_AND_HALF:
+        new_capacity = capacity + capacity / 2 + 1;
+        break;
+    case VECTOR_GROWTH_SIZE_CLASS:
+        new_capacity = size_class_capacity(capacity + capacity / 2 + 1);
+        break;
+    default:
+        new_capacity = capacity * 2;
+        break;
+    }
+
+    return vector_reallocate(*vector, new_capacity);
 }
 
 /*
@@ -203,3 +337,48 @@ Vector *set_at_index(Vector *vector, int index, int value){
 
     return vector;
 }
+
+/*
+ * Function: vector_set_growth
+ * ---------------------------
+ * Selects the growth policy used by resize_auto for this vector.
+ *
+ * vector: pointer to the Vector
+ * growth: one of the VectorGrowth policies
+ *
+ * returns: 1 if successful, -1 if vector is NULL or growth is unknown
+ */
+int vector_set_growth(Vector *vector, VectorGrowth growth){
+    if (vector == NULL) return -1;
+    if (growth != VECTOR_GROWTH_DOUBLE && growth != VECTOR_GROWTH_ONE_AND_HALF && growth != VECTOR_GROWTH_SIZE_CLASS)
+        return -1;
+
+    vector->growth = growth;
+    return 1;
+}
+
+/*
+ * Function: vector_use_huge_pages
+ * -------------------------------
+ * Opts the vector in or out of transparent huge pages (MADV_HUGEPAGE) for
+ * buffers above VECTOR_MMAP_THRESHOLD. Applies immediately if the buffer is
+ * already mapped. Has no effect on platforms without madvise support.
+ *
+ * vector: pointer to the Vector
+ * enable: nonzero to request huge pages
+ *
+ * returns: 1 if successful, -1 if vector is NULL
+ */
+int vector_use_huge_pages(Vector *vector, int enable){
+    if (vector == NULL) return -1;
+
+    if (enable)
+        vector->flags |= VECTOR_FLAG_HUGE_PAGES;
+    else
+        vector->flags &= ~VECTOR_FLAG_HUGE_PAGES;
+
+#ifdef VECTOR_HAS_MREMAP
+    advise_huge_pages(vector);
+#endif
+    return 1;
+}
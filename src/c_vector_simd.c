@@ -0,0 +1,415 @@
+#include "c_vector_simd.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define VECTOR_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+/* Instruction set levels selected at runtime */
+enum simd_level {
+    SIMD_SCALAR,
+    SIMD_SSE42,
+    SIMD_AVX2
+};
+
+/*
+ * Function: simd_level
+ * --------------------
+ * Detects the widest instruction set supported by the running CPU.
+ * Builds for other architectures always use the scalar kernels.
+ *
+ * returns: the simd_level to dispatch to
+ */
+static enum simd_level simd_level(void){
+#ifdef VECTOR_SIMD_X86
+    if (__builtin_cpu_supports("avx2")) return SIMD_AVX2;
+    if (__builtin_cpu_supports("sse4.2")) return SIMD_SSE42;
+#endif
+    return SIMD_SCALAR;
+}
+
+/* ---------------- Scalar kernels ---------------- */
+
+static long long sum_scalar(const int *data, int n){
+    long long sum = 0;
+    for (int i = 0; i < n; i++) sum += data[i];
+    return sum;
+}
+
+static void min_max_scalar(const int *data, int n, int *min, int *max){
+    int lo = data[0];
+    int hi = data[0];
+    for (int i = 1; i < n; i++){
+        if (data[i] < lo) lo = data[i];
+        if (data[i] > hi) hi = data[i];
+    }
+    *min = lo;
+    *max = hi;
+}
+
+static int find_scalar(const int *data, int n, int value){
+    for (int i = 0; i < n; i++){
+        if (data[i] == value) return i;
+    }
+    return -1;
+}
+
+static int count_eq_scalar(const int *data, int n, int value){
+    int count = 0;
+    for (int i = 0; i < n; i++) count += (data[i] == value);
+    return count;
+}
+
+static int filter_scalar(const int *data, int n, int low, int high, int *out){
+    int count = 0;
+    for (int i = 0; i < n; i++){
+        out[count] = data[i];
+        count += (data[i] >= low && data[i] <= high); /* Branchless compaction */
+    }
+    return count;
+}
+
+#ifdef VECTOR_SIMD_X86
+
+/* ---------------- SSE4.2 kernels (4 lanes) ---------------- */
+
+__attribute__((target("sse4.2")))
+static long long sum_sse42(const int *data, int n){
+    __m128i acc_lo = _mm_setzero_si128();
+    __m128i acc_hi = _mm_setzero_si128();
+    int i = 0;
+
+    /* Widen to 64-bit lanes so tens of millions of ints cannot overflow */
+    for (; i + 4 <= n; i += 4){
+        __m128i v = _mm_loadu_si128((const __m128i *)(data + i));
+        acc_lo = _mm_add_epi64(acc_lo, _mm_cvtepi32_epi64(v));
+        acc_hi = _mm_add_epi64(acc_hi, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+    }
+
+    long long lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, _mm_add_epi64(acc_lo, acc_hi));
+    return lanes[0] + lanes[1] + sum_scalar(data + i, n - i);
+}
+
+__attribute__((target("sse4.2")))
+static void min_max_sse42(const int *data, int n, int *min, int *max){
+    if (n < 4){
+        min_max_scalar(data, n, min, max);
+        return;
+    }
+
+    __m128i lo = _mm_loadu_si128((const __m128i *)data);
+    __m128i hi = lo;
+    int i = 4;
+    for (; i + 4 <= n; i += 4){
+        __m128i v = _mm_loadu_si128((const __m128i *)(data + i));
+        lo = _mm_min_epi32(lo, v);
+        hi = _mm_max_epi32(hi, v);
+    }
+
+    int lanes_lo[4], lanes_hi[4];
+    _mm_storeu_si128((__m128i *)lanes_lo, lo);
+    _mm_storeu_si128((__m128i *)lanes_hi, hi);
+    *min = lanes_lo[0];
+    *max = lanes_hi[0];
+    for (int k = 1; k < 4; k++){
+        if (lanes_lo[k] < *min) *min = lanes_lo[k];
+        if (lanes_hi[k] > *max) *max = lanes_hi[k];
+    }
+    for (; i < n; i++){
+        if (data[i] < *min) *min = data[i];
+        if (data[i] > *max) *max = data[i];
+    }
+}
+
+__attribute__((target("sse4.2")))
+static int find_sse42(const int *data, int n, int value){
+    __m128i needle = _mm_set1_epi32(value);
+    int i = 0;
+    for (; i + 4 <= n; i += 4){
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i)), needle);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    int tail = find_scalar(data + i, n - i, value);
+    return (tail == -1) ? -1 : i + tail;
+}
+
+__attribute__((target("sse4.2")))
+static int count_eq_sse42(const int *data, int n, int value){
+    __m128i needle = _mm_set1_epi32(value);
+    __m128i acc = _mm_setzero_si128();
+    int i = 0;
+
+    /* Matching lanes are -1, so subtracting the mask counts them */
+    for (; i + 4 <= n; i += 4){
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i)), needle);
+        acc = _mm_sub_epi32(acc, eq);
+    }
+
+    int lanes[4];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + count_eq_scalar(data + i, n - i, value);
+}
+
+__attribute__((target("sse4.2")))
+static int filter_sse42(const int *data, int n, int low, int high, int *out){
+    __m128i vlow = _mm_set1_epi32(low);
+    __m128i vhigh = _mm_set1_epi32(high);
+    int count = 0;
+    int i = 0;
+    for (; i + 4 <= n; i += 4){
+        __m128i v = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i outside = _mm_or_si128(_mm_cmpgt_epi32(vlow, v), _mm_cmpgt_epi32(v, vhigh));
+        int mask = ~_mm_movemask_ps(_mm_castsi128_ps(outside)) & 0xF;
+        while (mask){
+            out[count++] = data[i + __builtin_ctz(mask)];
+            mask &= mask - 1;
+        }
+    }
+    return count + filter_scalar(data + i, n - i, low, high, out + count);
+}
+
+/* ---------------- AVX2 kernels (8 lanes) ---------------- */
+
+__attribute__((target("avx2")))
+static long long sum_avx2(const int *data, int n){
+    __m256i acc_lo = _mm256_setzero_si256();
+    __m256i acc_hi = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= n; i += 8){
+        __m256i v = _mm256_loadu_si256((const __m256i *)(data + i));
+        acc_lo = _mm256_add_epi64(acc_lo, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc_hi = _mm256_add_epi64(acc_hi, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi64(acc_lo, acc_hi));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_scalar(data + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static void min_max_avx2(const int *data, int n, int *min, int *max){
+    if (n < 8){
+        min_max_scalar(data, n, min, max);
+        return;
+    }
+
+    __m256i lo = _mm256_loadu_si256((const __m256i *)data);
+    __m256i hi = lo;
+    int i = 8;
+    for (; i + 8 <= n; i += 8){
+        __m256i v = _mm256_loadu_si256((const __m256i *)(data + i));
+        lo = _mm256_min_epi32(lo, v);
+        hi = _mm256_max_epi32(hi, v);
+    }
+
+    int lanes_lo[8], lanes_hi[8];
+    _mm256_storeu_si256((__m256i *)lanes_lo, lo);
+    _mm256_storeu_si256((__m256i *)lanes_hi, hi);
+    *min = lanes_lo[0];
+    *max = lanes_hi[0];
+    for (int k = 1; k < 8; k++){
+        if (lanes_lo[k] < *min) *min = lanes_lo[k];
+        if (lanes_hi[k] > *max) *max = lanes_hi[k];
+    }
+    for (; i < n; i++){
+        if (data[i] < *min) *min = data[i];
+        if (data[i] > *max) *max = data[i];
+    }
+}
+
+__attribute__((target("avx2")))
+static int find_avx2(const int *data, int n, int value){
+    __m256i needle = _mm256_set1_epi32(value);
+    int i = 0;
+    for (; i + 8 <= n; i += 8){
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i)), needle);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    int tail = find_scalar(data + i, n - i, value);
+    return (tail == -1) ? -1 : i + tail;
+}
+
+__attribute__((target("avx2")))
+static int count_eq_avx2(const int *data, int n, int value){
+    __m256i needle = _mm256_set1_epi32(value);
+    __m256i acc = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= n; i += 8){
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i)), needle);
+        acc = _mm256_sub_epi32(acc, eq);
+    }
+
+    int lanes[8];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    int count = 0;
+    for (int k = 0; k < 8; k++) count += lanes[k];
+    return count + count_eq_scalar(data + i, n - i, value);
+}
+
+__attribute__((target("avx2")))
+static int filter_avx2(const int *data, int n, int low, int high, int *out){
+    __m256i vlow = _mm256_set1_epi32(low);
+    __m256i vhigh = _mm256_set1_epi32(high);
+    int count = 0;
+    int i = 0;
+    for (; i + 8 <= n; i += 8){
+        __m256i v = _mm256_loadu_si256((const __m256i *)(data + i));
+        __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi32(vlow, v), _mm256_cmpgt_epi32(v, vhigh));
+        int mask = ~_mm256_movemask_ps(_mm256_castsi256_ps(outside)) & 0xFF;
+        while (mask){
+            out[count++] = data[i + __builtin_ctz(mask)];
+            mask &= mask - 1;
+        }
+    }
+    return count + filter_scalar(data + i, n - i, low, high, out + count);
+}
+
+#endif /* VECTOR_SIMD_X86 */
+
+/*
+ * Function: vector_sum
+ * --------------------
+ * Sums every element of the vector using the widest available SIMD kernel.
+ *
+ * vector: pointer to the Vector
+ *
+ * returns: sum of the elements as a 64-bit value, or 0 if vector is NULL or empty
+ */
+long long vector_sum(Vector *vector){
+    if (vector == NULL || vector->size <= 0) return 0;
+
+#ifdef VECTOR_SIMD_X86
+    switch (simd_level()){
+    case SIMD_AVX2: return sum_avx2(vector->collection, vector->size);
+    case SIMD_SSE42: return sum_sse42(vector->collection, vector->size);
+    default: break;
+    }
+#endif
+    return sum_scalar(vector->collection, vector->size);
+}
+
+/*
+ * Function: vector_min_max
+ * ------------------------
+ * Finds the smallest and largest element of the vector in a single pass.
+ *
+ * vector: pointer to the Vector
+ * min: output for the smallest element
+ * max: output for the largest element
+ *
+ * returns: 1 if successful, -1 if vector is NULL or empty or an output is NULL
+ */
+int vector_min_max(Vector *vector, int *min, int *max){
+    if (vector == NULL || vector->size <= 0 || min == NULL || max == NULL) return -1;
+
+#ifdef VECTOR_SIMD_X86
+    switch (simd_level()){
+    case SIMD_AVX2: min_max_avx2(vector->collection, vector->size, min, max); return 1;
+    case SIMD_SSE42: min_max_sse42(vector->collection, vector->size, min, max); return 1;
+    default: break;
+    }
+#endif
+    min_max_scalar(vector->collection, vector->size, min, max);
+    return 1;
+}
+
+/*
+ * Function: vector_find
+ * ---------------------
+ * Searches the vector for the first occurrence of a value.
+ *
+ * vector: pointer to the Vector
+ * value: value to search for
+ *
+ * returns: index of the first match, or -1 if not found or vector is NULL
+ */
+int vector_find(Vector *vector, int value){
+    if (vector == NULL || vector->size <= 0) return -1;
+
+#ifdef VECTOR_SIMD_X86
+    switch (simd_level()){
+    case SIMD_AVX2: return find_avx2(vector->collection, vector->size, value);
+    case SIMD_SSE42: return find_sse42(vector->collection, vector->size, value);
+    default: break;
+    }
+#endif
+    return find_scalar(vector->collection, vector->size, value);
+}
+
+/*
+ * Function: vector_count_eq
+ * -------------------------
+ * Counts how many elements of the vector are equal to a value.
+ *
+ * vector: pointer to the Vector
+ * value: value to count
+ *
+ * returns: number of matches, or -1 if vector is NULL
+ */
+int vector_count_eq(Vector *vector, int value){
+    if (vector == NULL) return -1;
+    if (vector->size <= 0) return 0;
+
+#ifdef VECTOR_SIMD_X86
+    switch (simd_level()){
+    case SIMD_AVX2: return count_eq_avx2(vector->collection, vector->size, value);
+    case SIMD_SSE42: return count_eq_sse42(vector->collection, vector->size, value);
+    default: break;
+    }
+#endif
+    return count_eq_scalar(vector->collection, vector->size, value);
+}
+
+/*
+ * Function: vector_filter
+ * -----------------------
+ * Copies every element within [low, high] into a new vector, preserving order.
+ *
+ * vector: pointer to the source Vector
+ * low: smallest value to keep (inclusive)
+ * high: largest value to keep (inclusive)
+ *
+ * returns: pointer to a new Vector holding the matches (the caller must destroy it),
+ *          or NULL if vector is NULL or allocation fails
+ */
+Vector *vector_filter(Vector *vector, int low, int high){
+    if (vector == NULL) return NULL;
+
+    /* Allocate for the worst case so the kernels can write without bounds checks */
+    Vector *result = create_vector(vector->size > 0 ? vector->size : 1);
+    if (result == NULL || vector->size <= 0) return result;
+
+    const int *data = vector->collection;
+    int n = vector->size;
+    int *out = result->collection;
+
+#ifdef VECTOR_SIMD_X86
+    switch (simd_level()){
+    case SIMD_AVX2: result->size = filter_avx2(data, n, low, high, out); return result;
+    case SIMD_SSE42: result->size = filter_sse42(data, n, low, high, out); return result;
+    default: break;
+    }
+#endif
+    result->size = filter_scalar(data, n, low, high, out);
+    return result;
+}
+
+/*
+ * Function: vector_simd_backend
+ * -----------------------------
+ * Reports which kernel family the dispatcher selects on this CPU.
+ *
+ * returns: "avx2", "sse4.2" or "scalar"
+ */
+const char *vector_simd_backend(void){
+    switch (simd_level()){
+    case SIMD_AVX2: return "avx2";
+    case SIMD_SSE42: return "sse4.2";
+    default: return "scalar";
+    }
+}
@@ -0,0 +1,541 @@
+#include "c_vector_sort.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define INSERTION_SORT_THRESHOLD 16
+#define RADIX_BITS 8
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+#define RADIX_PASSES 4
+#define PARALLEL_SORT_MIN_CHUNK 4096
+
+/* Maps a signed int to an unsigned key with the same ordering */
+static inline unsigned int radix_key(int value){
+    return (unsigned int)value ^ 0x80000000u;
+}
+
+/*
+ * Function: radix_histograms
+ * --------------------------
+ * Counts the occurrences of every byte value for all four key digits in one pass
+ * and converts the counts into starting offsets.
+ *
+ * data: array of ints
+ * n: number of elements
+ * offsets: RADIX_PASSES x RADIX_BUCKETS table to fill
+ * skip: per-pass flag set to 1 when every key shares the same digit
+ */
+static void radix_histograms(const int *data, int n, int offsets[RADIX_PASSES][RADIX_BUCKETS], int skip[RADIX_PASSES]){
+    memset(offsets, 0, sizeof(int) * RADIX_PASSES * RADIX_BUCKETS);
+    for (int i = 0; i < n; i++){
+        unsigned int key = radix_key(data[i]);
+        for (int pass = 0; pass < RADIX_PASSES; pass++){
+            offsets[pass][(key >> (pass * RADIX_BITS)) & (RADIX_BUCKETS - 1)]++;
+        }
+    }
+
+    for (int pass = 0; pass < RADIX_PASSES; pass++){
+        unsigned int first_digit = (radix_key(data[0]) >> (pass * RADIX_BITS)) & (RADIX_BUCKETS - 1);
+        skip[pass] = (offsets[pass][first_digit] == n);
+
+        int total = 0;
+        for (int bucket = 0; bucket < RADIX_BUCKETS; bucket++){
+            int count = offsets[pass][bucket];
+            offsets[pass][bucket] = total;
+            total += count;
+        }
+    }
+}
+
+/*
+ * Function: radix_sort_ints
+ * -------------------------
+ * Sorts an int array in ascending order with an LSD radix sort (four 8-bit digits).
+ * Digits shared by every key are skipped.
+ *
+ * data: array to sort in place
+ * n: number of elements
+ *
+ * returns: 1 if successful, -1 if data is NULL or the scratch buffer cannot be allocated
+ */
+int radix_sort_ints(int *data, int n){
+    if (data == NULL || n < 0) return -1;
+    if (n < 2) return 1;
+
+    int *buffer = malloc(sizeof(int) * n);
+    if (buffer == NULL) return -1;
+
+    int offsets[RADIX_PASSES][RADIX_BUCKETS];
+    int skip[RADIX_PASSES];
+    radix_histograms(data, n, offsets, skip);
+
+    int *src = data;
+    int *dst = buffer;
+    for (int pass = 0; pass < RADIX_PASSES; pass++){
+        if (skip[pass]) continue;
+
+        int shift = pass * RADIX_BITS;
+        int *offset = offsets[pass];
+        for (int i = 0; i < n; i++){
+            dst[offset[(radix_key(src[i]) >> shift) & (RADIX_BUCKETS - 1)]++] = src[i];
+        }
+
+        int *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != data) memcpy(data, src, sizeof(int) * n);
+    free(buffer);
+    return 1;
+}
+
+/* Default ordering used when no comparator is supplied */
+static int compare_ascending(int a, int b){
+    return (a > b) - (a < b);
+}
+
+static void insertion_sort(int *data, int n, int_compare_fn compare){
+    for (int i = 1; i < n; i++){
+        int value = data[i];
+        int j = i - 1;
+        while (j >= 0 && compare(value, data[j]) < 0){
+            data[j + 1] = data[j];
+            j--;
+        }
+        data[j + 1] = value;
+    }
+}
+
+static void sift_down(int *data, int root, int n, int_compare_fn compare){
+    int value = data[root];
+    for (;;){
+        int child = 2 * root + 1;
+        if (child >= n) break;
+        if (child + 1 < n && compare(data[child], data[child + 1]) < 0) child++;
+        if (compare(value, data[child]) >= 0) break;
+        data[root] = data[child];
+        root = child;
+    }
+    data[root] = value;
+}
+
+static void heap_sort(int *data, int n, int_compare_fn compare){
+    for (int i = n / 2 - 1; i >= 0; i--) sift_down(data, i, n, compare);
+    for (int end = n - 1; end > 0; end--){
+        int top = data[0];
+        data[0] = data[end];
+        data[end] = top;
+        sift_down(data, 0, end, compare);
+    }
+}
+
+static inline void swap_ints(int *a, int *b){
+    int tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+/*
+ * Function: partition_branchless
+ * ------------------------------
+ * Lomuto partition around data[n - 1] in which the comparison result only
+ * advances the store index, so the loop body has no data-dependent branch.
+ * With less_or_equal set, elements equal to the pivot also move left.
+ *
+ * returns: final index of the pivot
+ */
+static int partition_branchless(int *data, int n, int_compare_fn compare, int less_or_equal){
+    int pivot = data[n - 1];
+    int store = 0;
+    for (int i = 0; i < n - 1; i++){
+        int value = data[i];
+        int goes_left = less_or_equal ? (compare(pivot, value) >= 0) : (compare(value, pivot) < 0);
+        data[i] = data[store];
+        data[store] = value;
+        store += goes_left;
+    }
+    swap_ints(&data[store], &data[n - 1]);
+    return store;
+}
+
+/* Moves the median of the first, middle and last element to the end as pivot */
+static void median_of_three(int *data, int n, int_compare_fn compare){
+    int mid = n / 2;
+    if (compare(data[mid], data[0]) < 0) swap_ints(&data[mid], &data[0]);
+    if (compare(data[n - 1], data[0]) < 0) swap_ints(&data[n - 1], &data[0]);
+    if (compare(data[mid], data[n - 1]) < 0) swap_ints(&data[mid], &data[n - 1]);
+}
+
+/*
+ * Function: introsort_loop
+ * ------------------------
+ * Quicksort that recurses into the smaller side and loops on the larger one,
+ * falling back to heapsort once depth_limit is exhausted.
+ *
+ * data: array segment to sort
+ * n: number of elements in the segment
+ * has_lower_bound: 1 if data[-1] is a previous pivot that is <= every element
+ */
+static void introsort_loop(int *data, int n, int depth_limit, int_compare_fn compare, int has_lower_bound){
+    while (n > INSERTION_SORT_THRESHOLD){
+        if (depth_limit-- == 0){
+            heap_sort(data, n, compare);
+            return;
+        }
+
+        median_of_three(data, n, compare);
+
+        /* The pivot equals the lower bound: everything <= pivot is equal and already in place */
+        if (has_lower_bound && compare(data[-1], data[n - 1]) >= 0){
+            int p = partition_branchless(data, n, compare, 1);
+            data += p + 1;
+            n -= p + 1;
+            continue;
+        }
+
+        int p = partition_branchless(data, n, compare, 0);
+        int left = p;
+        int right = n - p - 1;
+        if (left < right){
+            introsort_loop(data, left, depth_limit, compare, has_lower_bound);
+            data += p + 1;
+            n = right;
+            has_lower_bound = 1;
+        }
+        else{
+            introsort_loop(data + p + 1, right, depth_limit, compare, 1);
+            n = left;
+        }
+    }
+    insertion_sort(data, n, compare);
+}
+
+/*
+ * Function: introsort_ints
+ * ------------------------
+ * Sorts an int array with introsort: branchless-partition quicksort with a
+ * heapsort fallback for adversarial inputs and insertion sort for small ranges.
+ *
+ * data: array to sort in place
+ * n: number of elements
+ * compare: ordering callback, or NULL for ascending order
+ */
+void introsort_ints(int *data, int n, int_compare_fn compare){
+    if (data == NULL || n < 2) return;
+    if (compare == NULL) compare = compare_ascending;
+
+    int depth_limit = 0;
+    for (int m = n; m > 1; m >>= 1) depth_limit += 2;
+
+    introsort_loop(data, n, depth_limit, compare, 0);
+}
+
+/* ---------------- Parallel merge sort ---------------- */
+
+typedef struct sort_task {
+    int *data;
+    int n;
+} SortTask;
+
+typedef struct merge_task {
+    const int *a;
+    int na;
+    const int *b;
+    int nb;
+    int *out;
+} MergeTask;
+
+static void *sort_task_run(void *arg){
+    SortTask *task = arg;
+    introsort_ints(task->data, task->n, NULL);
+    return NULL;
+}
+
+static void *merge_task_run(void *arg){
+    MergeTask *task = arg;
+    int i = 0, j = 0, k = 0;
+    while (i < task->na && j < task->nb){
+        /* Take from b only when strictly smaller to keep the merge stable */
+        int take_b = task->b[j] < task->a[i];
+        task->out[k++] = take_b ? task->b[j] : task->a[i];
+        j += take_b;
+        i += !take_b;
+    }
+    while (i < task->na) task->out[k++] = task->a[i++];
+    while (j < task->nb) task->out[k++] = task->b[j++];
+    return NULL;
+}
+
+/*
+ * Function: run_tasks
+ * -------------------
+ * Runs every task on its own thread (the last one on the calling thread) and
+ * waits for all of them. Tasks whose thread cannot be started run inline.
+ */
+static void run_tasks(void *(*run)(void *), void *tasks, size_t task_size, int count){
+    pthread_t *threads = malloc(sizeof(pthread_t) * count);
+    int *started = calloc(count, sizeof(int));
+    char *base = tasks;
+
+    for (int t = 0; t < count - 1; t++){
+        if (threads && started && pthread_create(&threads[t], NULL, run, base + t * task_size) == 0){
+            started[t] = 1;
+        }
+        else{
+            run(base + t * task_size);
+        }
+    }
+    run(base + (count - 1) * task_size);
+
+    for (int t = 0; t < count - 1; t++){
+        if (started && started[t]) pthread_join(threads[t], NULL);
+    }
+    free(started);
+    free(threads);
+}
+
+/*
+ * Function: merge_path_split
+ * --------------------------
+ * Finds how many elements of a belong to the first diag outputs of a stable merge.
+ */
+static int merge_path_split(const int *a, int na, const int *b, int nb, int diag){
+    int lo = diag > nb ? diag - nb : 0;
+    int hi = diag < na ? diag : na;
+    while (lo < hi){
+        int mid = lo + (hi - lo) / 2;
+        if (a[mid] <= b[diag - mid - 1])
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/*
+ * Function: parallel_merge_sort_ints
+ * ----------------------------------
+ * Sorts an int array in ascending order on several threads: each thread sorts
+ * one chunk, then sorted runs are merged pairwise. When there are fewer pairs
+ * than threads, each merge is split along its merge path so all threads stay busy.
+ *
+ * data: array to sort in place
+ * n: number of elements
+ * threads: number of threads to use, or <= 0 for the number of online CPUs
+ *
+ * returns: 1 if successful, -1 if data is NULL or allocation fails
+ */
+int parallel_merge_sort_ints(int *data, int n, int threads){
+    if (data == NULL || n < 0) return -1;
+    if (threads <= 0){
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0) ? (int)cpus : 1;
+    }
+    if (threads > n / PARALLEL_SORT_MIN_CHUNK) threads = n / PARALLEL_SORT_MIN_CHUNK;
+    if (threads <= 1){
+        introsort_ints(data, n, NULL);
+        return 1;
+    }
+
+    int *buffer = malloc(sizeof(int) * n);
+    int *bounds = malloc(sizeof(int) * (threads + 1));
+    SortTask *sort_tasks = malloc(sizeof(SortTask) * threads);
+    MergeTask *merge_tasks = malloc(sizeof(MergeTask) * 2 * threads);
+    if (!buffer || !bounds || !sort_tasks || !merge_tasks){
+        free(buffer);
+        free(bounds);
+        free(sort_tasks);
+        free(merge_tasks);
+        return -1;
+    }
+
+    /* Phase 1: sort equal-sized chunks independently */
+    int runs = threads;
+    for (int t = 0; t <= runs; t++) bounds[t] = (int)((long long)n * t / runs);
+    for (int t = 0; t < runs; t++){
+        sort_tasks[t].data = data + bounds[t];
+        sort_tasks[t].n = bounds[t + 1] - bounds[t];
+    }
+    run_tasks(sort_task_run, sort_tasks, sizeof(SortTask), runs);
+
+    /* Phase 2: merge runs pairwise, ping-ponging between data and buffer */
+    int *src = data;
+    int *dst = buffer;
+    while (runs > 1){
+        int pairs = runs / 2;
+        int parts = threads / pairs;
+        if (parts < 1) parts = 1;
+
+        int task_count = 0;
+        for (int p = 0; p < pairs; p++){
+            const int *a = src + bounds[2 * p];
+            const int *b = src + bounds[2 * p + 1];
+            int na = bounds[2 * p + 1] - bounds[2 * p];
+            int nb = bounds[2 * p + 2] - bounds[2 * p + 1];
+            int total = na + nb;
+
+            for (int q = 0; q < parts; q++){
+                int d0 = (int)((long long)total * q / parts);
+                int d1 = (int)((long long)total * (q + 1) / parts);
+                int i0 = merge_path_split(a, na, b, nb, d0);
+                int i1 = merge_path_split(a, na, b, nb, d1);
+
+                MergeTask *task = &merge_tasks[task_count++];
+                task->a = a + i0;
+                task->na = i1 - i0;
+                task->b = b + (d0 - i0);
+                task->nb = (d1 - i1) - (d0 - i0);
+                task->out = dst + bounds[2 * p] + d0;
+            }
+        }
+        if (runs % 2 == 1){
+            /* Odd run out: carry it over unchanged */
+            MergeTask *task = &merge_tasks[task_count++];
+            task->a = src + bounds[runs - 1];
+            task->na = bounds[runs] - bounds[runs - 1];
+            task->b = NULL;
+            task->nb = 0;
+            task->out = dst + bounds[runs - 1];
+        }
+        run_tasks(merge_task_run, merge_tasks, sizeof(MergeTask), task_count);
+
+        int merged = 0;
+        for (int p = 0; p < pairs; p++) bounds[++merged] = bounds[2 * p + 2];
+        if (runs % 2 == 1) bounds[++merged] = bounds[runs];
+        runs = merged;
+
+        int *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != data) memcpy(data, src, sizeof(int) * n);
+    free(buffer);
+    free(bounds);
+    free(sort_tasks);
+    free(merge_tasks);
+    return 1;
+}
+
+/*
+ * Function: argsort_ints
+ * ----------------------
+ * Computes the permutation that sorts an array, without modifying the array.
+ * The permutation is stable: equal values keep their original relative order.
+ *
+ * data: array of values
+ * n: number of elements
+ *
+ * returns: array perm of n indices with data[perm[0]] <= data[perm[1]] <= ...
+ *          (the caller must free it), or NULL on invalid input or allocation failure
+ */
+int *argsort_ints(const int *data, int n){
+    if (data == NULL || n <= 0) return NULL;
+
+    int *perm = malloc(sizeof(int) * n);
+    int *perm_tmp = malloc(sizeof(int) * n);
+    int *keys = malloc(sizeof(int) * n);
+    int *keys_tmp = malloc(sizeof(int) * n);
+    if (!perm || !perm_tmp || !keys || !keys_tmp){
+        free(perm);
+        free(perm_tmp);
+        free(keys);
+        free(keys_tmp);
+        return NULL;
+    }
+
+    memcpy(keys, data, sizeof(int) * n);
+    for (int i = 0; i < n; i++) perm[i] = i;
+
+    int offsets[RADIX_PASSES][RADIX_BUCKETS];
+    int skip[RADIX_PASSES];
+    radix_histograms(keys, n, offsets, skip);
+
+    /* LSD radix sort is stable, so carrying the indices along yields a stable argsort */
+    for (int pass = 0; pass < RADIX_PASSES; pass++){
+        if (skip[pass]) continue;
+
+        int shift = pass * RADIX_BITS;
+        int *offset = offsets[pass];
+        for (int i = 0; i < n; i++){
+            int slot = offset[(radix_key(keys[i]) >> shift) & (RADIX_BUCKETS - 1)]++;
+            keys_tmp[slot] = keys[i];
+            perm_tmp[slot] = perm[i];
+        }
+
+        int *swap = keys;
+        keys = keys_tmp;
+        keys_tmp = swap;
+        swap = perm;
+        perm = perm_tmp;
+        perm_tmp = swap;
+    }
+
+    free(perm_tmp);
+    free(keys);
+    free(keys_tmp);
+    return perm;
+}
+
+/*
+ * Function: vector_radix_sort
+ * ---------------------------
+ * Sorts the vector's elements in ascending order with LSD radix sort.
+ *
+ * vector: pointer to the Vector
+ *
+ * returns: 1 if successful, -1 if vector is NULL or allocation fails
+ */
+int vector_radix_sort(Vector *vector){
+    if (vector == NULL) return -1;
+    return radix_sort_ints(vector->collection, vector->size);
+}
+
+/*
+ * Function: vector_introsort
+ * --------------------------
+ * Sorts the vector's elements in place using a caller-supplied ordering.
+ *
+ * vector: pointer to the Vector
+ * compare: ordering callback, or NULL for ascending order
+ *
+ * returns: 1 if successful, -1 if vector is NULL
+ */
+int vector_introsort(Vector *vector, int_compare_fn compare){
+    if (vector == NULL) return -1;
+    introsort_ints(vector->collection, vector->size, compare);
+    return 1;
+}
+
+/*
+ * Function: vector_parallel_merge_sort
+ * ------------------------------------
+ * Sorts the vector's elements in ascending order using several threads.
+ *
+ * vector: pointer to the Vector
+ * threads: number of threads to use, or <= 0 for the number of online CPUs
+ *
+ * returns: 1 if successful, -1 if vector is NULL or allocation fails
+ */
+int vector_parallel_merge_sort(Vector *vector, int threads){
+    if (vector == NULL) return -1;
+    return parallel_merge_sort_ints(vector->collection, vector->size, threads);
+}
+
+/*
+ * Function: vector_argsort
+ * ------------------------
+ * Computes the stable permutation that would sort the vector, leaving it unchanged.
+ *
+ * vector: pointer to the Vector
+ *
+ * returns: array of current_size(vector) indices (the caller must free it),
+ *          or NULL if vector is NULL, empty, or allocation fails
+ */
+int *vector_argsort(Vector *vector){
+    if (vector == NULL) return NULL;
+    return argsort_ints(vector->collection, vector->size);
+}
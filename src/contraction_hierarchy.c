@@ -0,0 +1,1051 @@
+#include "c_graph_internal.h"
+#include "c_graph.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+
+#define CH_WITNESS_SETTLE_LIMIT 500 // Witness searches give up (and keep the shortcut) after this many vertices
+#define CH_ESTIMATE_SETTLE_LIMIT 10 // Cheaper limit when only counting shortcuts for a priority
+#define CH_FILE_MAGIC "DSACH001"
+
+/* ---------------- Dynamic graph used during preprocessing ---------------- */
+
+typedef struct ch_edge_t {
+    int node;       // Other endpoint
+    int middle;     // Contracted vertex this shortcut bypasses, -1 for an original edge
+    double weight;
+} ch_edge_t;
+
+typedef struct ch_edge_list_t {
+    ch_edge_t* items;
+    int count;
+    int capacity;
+} ch_edge_list_t;
+
+enum ch_state {
+    CH_ACTIVE,
+    CH_IN_ROUND,    // Being contracted in the current round
+    CH_CONTRACTED
+};
+
+typedef struct ch_builder_t {
+    int n;
+    ch_edge_list_t* out;        // Edges by source; frozen once the source is contracted
+    ch_edge_list_t* in;         // Same edges by target
+    unsigned char* state;
+    int* priority;
+    int* contracted_neighbors;
+} ch_builder_t;
+
+typedef struct ch_shortcut_t {
+    int from;
+    int to;
+    int middle;
+    double weight;
+} ch_shortcut_t;
+
+/* Per-thread scratch for witness searches and shortcut output */
+typedef struct ch_worker_t {
+    c_graph_heap_t* heap;
+    double* dist;
+    unsigned char* target;      // Out-neighbors of the vertex being contracted
+    ch_shortcut_t* shortcuts;
+    int shortcut_count;
+    int shortcut_capacity;
+} ch_worker_t;
+
+/* ---------------- Final hierarchy ---------------- */
+
+/* Edges of the hierarchy in CSR form; node is the target for up_out and the source for up_in */
+typedef struct ch_csr_t {
+    int* offsets;
+    int* nodes;
+    int* middles;
+    double* weights;
+} ch_csr_t;
+
+/* Query scratch for both directions, reused through a pool so queries need no O(n) setup */
+typedef struct ch_query_workspace_t {
+    c_graph_heap_t* heap[2];
+    double* dist[2];
+    int* parent[2];
+    int* parent_edge[2];
+    struct ch_query_workspace_t* next;
+} ch_query_workspace_t;
+
+struct c_graph_ch_t {
+    int num_ids;
+    unsigned char* present;
+    int* rank;              // Contraction order, -1 for ids that are not vertices
+    ch_csr_t up_out;        // Edges u -> x with rank[x] > rank[u], stored at u
+    ch_csr_t up_in;         // Edges u -> x with rank[u] > rank[x], stored at x
+    int num_up_out;
+    int num_up_in;
+    ch_query_workspace_t* pool;
+    pthread_mutex_t pool_lock;
+};
+
+/*
+ * Function: edge_list_find
+ * ------------------------
+ * Finds the edge to or from node in a list.
+ *
+ * returns: pointer to the edge, or NULL if there is none
+ */
+static ch_edge_t* edge_list_find(ch_edge_list_t* list, int node) {
+    for (int i = 0; i < list->count; i++) {
+        if (list->items[i].node == node) return &list->items[i];
+    }
+    return NULL;
+}
+
+static int edge_list_append(ch_edge_list_t* list, int node, int middle, double weight) {
+    if (list->count == list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : 4;
+        ch_edge_t* items = (ch_edge_t*)realloc(list->items, capacity * sizeof(ch_edge_t));
+        if (!items) return -1;
+        list->items = items;
+        list->capacity = capacity;
+    }
+    list->items[list->count].node = node;
+    list->items[list->count].middle = middle;
+    list->items[list->count].weight = weight;
+    list->count++;
+    return 0;
+}
+
+/* Removes the edge to or from node; order within the list does not matter */
+static void edge_list_remove(ch_edge_list_t* list, int node) {
+    ch_edge_t* edge = edge_list_find(list, node);
+    if (edge) *edge = list->items[--list->count];
+}
+
+/*
+ * Function: builder_add_edge
+ * --------------------------
+ * Adds edge from -> to, or lowers the weight of the existing one, so there is
+ * at most one edge per ordered pair of vertices.
+ *
+ * returns: 0 if successful, -1 if allocation fails
+ */
+static int builder_add_edge(ch_builder_t* b, int from, int to, int middle, double weight) {
+    ch_edge_t* existing = edge_list_find(&b->out[from], to);
+    if (existing) {
+        if (weight < existing->weight) {
+            existing->weight = weight;
+            existing->middle = middle;
+            ch_edge_t* mirror = edge_list_find(&b->in[to], from);
+            mirror->weight = weight;
+            mirror->middle = middle;
+        }
+        return 0;
+    }
+    if (edge_list_append(&b->out[from], to, middle, weight) != 0) return -1;
+    if (edge_list_append(&b->in[to], from, middle, weight) != 0) {
+        b->out[from].count--;
+        return -1;
+    }
+    return 0;
+}
+
+static void builder_destroy(ch_builder_t* b) {
+    if (!b) return;
+    for (int v = 0; b->out && b->in && v < b->n; v++) {
+        free(b->out[v].items);
+        free(b->in[v].items);
+    }
+    free(b->out);
+    free(b->in);
+    free(b->state);
+    free(b->priority);
+    free(b->contracted_neighbors);
+    free(b);
+}
+
+/*
+ * Function: builder_create
+ * ------------------------
+ * Copies the graph's edges into growable per-vertex lists, dropping self loops
+ * and keeping the lightest of parallel edges.
+ *
+ * returns: pointer to the builder, or NULL if allocation fails
+ */
+static ch_builder_t* builder_create(const c_graph_csr_t* csr) {
+    ch_builder_t* b = (ch_builder_t*)calloc(1, sizeof(ch_builder_t));
+    if (!b) return NULL;
+    int n = csr->num_ids;
+    b->n = n;
+    b->out = (ch_edge_list_t*)calloc(n, sizeof(ch_edge_list_t));
+    b->in = (ch_edge_list_t*)calloc(n, sizeof(ch_edge_list_t));
+    b->state = (unsigned char*)malloc(n * sizeof(unsigned char));
+    b->priority = (int*)calloc(n, sizeof(int));
+    b->contracted_neighbors = (int*)calloc(n, sizeof(int));
+    if (!b->out || !b->in || !b->state || !b->priority || !b->contracted_neighbors) {
+        builder_destroy(b);
+        return NULL;
+    }
+
+    for (int u = 0; u < n; u++) {
+        b->state[u] = csr->present[u] ? CH_ACTIVE : CH_CONTRACTED;
+        for (int i = csr->offsets[u]; i < csr->offsets[u + 1]; i++) {
+            if (csr->targets[i] == u) continue;
+            if (builder_add_edge(b, u, csr->targets[i], -1, csr->weights[i]) != 0) {
+                builder_destroy(b);
+                return NULL;
+            }
+        }
+    }
+    return b;
+}
+
+/*
+ * Function: witness_search
+ * ------------------------
+ * Dijkstra from source over active vertices other than skip, stopping once
+ * all targets are settled, the next distance exceeds limit or the settle
+ * limit is hit. Distances of reached vertices are left in worker->dist until
+ * worker_reset.
+ */
+static void witness_search(const ch_builder_t* b, ch_worker_t* w, int source, int skip, double limit, int targets,
+                           int settle_limit) {
+    w->dist[source] = 0;
+    graph_heap_push(w->heap, source, 0);
+
+    int settled = 0;
+    while (targets > 0 && w->heap->size > 0 && graph_heap_min_key(w->heap) <= limit
+           && settled < settle_limit) {
+        int u = graph_heap_pop(w->heap);
+        settled++;
+        if (w->target[u]) targets--;
+        const ch_edge_list_t* out = &b->out[u];
+        for (int i = 0; i < out->count; i++) {
+            int v = out->items[i].node;
+            if (v == skip || b->state[v] != CH_ACTIVE) continue;
+            double candidate = w->dist[u] + out->items[i].weight;
+            if (candidate < w->dist[v]) {
+                w->dist[v] = candidate;
+                graph_heap_push(w->heap, v, candidate);
+            }
+        }
+    }
+}
+
+/* Clears the distances a witness search left behind */
+static void worker_reset(ch_worker_t* w) {
+    for (int i = 0; i < w->heap->touched_count; i++) {
+        w->dist[w->heap->touched[i]] = DBL_MAX;
+    }
+    graph_heap_reset(w->heap);
+}
+
+static int worker_emit(ch_worker_t* w, int from, int to, int middle, double weight) {
+    if (w->shortcut_count == w->shortcut_capacity) {
+        int capacity = w->shortcut_capacity ? w->shortcut_capacity * 2 : 64;
+        ch_shortcut_t* items = (ch_shortcut_t*)realloc(w->shortcuts, capacity * sizeof(ch_shortcut_t));
+        if (!items) return -1;
+        w->shortcuts = items;
+        w->shortcut_capacity = capacity;
+    }
+    ch_shortcut_t* s = &w->shortcuts[w->shortcut_count++];
+    s->from = from;
+    s->to = to;
+    s->middle = middle;
+    s->weight = weight;
+    return 0;
+}
+
+/*
+ * Function: contract_vertex
+ * -------------------------
+ * Finds the shortcuts needed to remove v: for every active in-neighbor u and
+ * out-neighbor x, u -> v -> x needs a shortcut unless a witness search from u
+ * that avoids v finds a path to x that is no longer. With emit set the
+ * shortcuts go to the worker's output, otherwise they are only counted.
+ *
+ * returns: number of shortcuts, or -1 if allocation fails
+ */
+static int contract_vertex(const ch_builder_t* b, ch_worker_t* w, int v, int emit) {
+    const ch_edge_list_t* in = &b->in[v];
+    const ch_edge_list_t* out = &b->out[v];
+    int shortcuts = 0;
+
+    for (int i = 0; i < in->count; i++) {
+        int u = in->items[i].node;
+        if (b->state[u] != CH_ACTIVE) continue;
+        double w1 = in->items[i].weight;
+
+        double limit = -1;
+        int targets = 0;
+        for (int j = 0; j < out->count; j++) {
+            int x = out->items[j].node;
+            if (x == u || b->state[x] != CH_ACTIVE) continue;
+            if (w1 + out->items[j].weight > limit) limit = w1 + out->items[j].weight;
+            w->target[x] = 1;
+            targets++;
+        }
+        if (limit >= 0) {
+            witness_search(b, w, u, v, limit, targets, emit ? CH_WITNESS_SETTLE_LIMIT : CH_ESTIMATE_SETTLE_LIMIT);
+        }
+        for (int j = 0; j < out->count; j++) {
+            w->target[out->items[j].node] = 0;
+        }
+        if (limit < 0) continue;
+
+        for (int j = 0; j < out->count; j++) {
+            int x = out->items[j].node;
+            if (x == u || b->state[x] != CH_ACTIVE) continue;
+            double through_v = w1 + out->items[j].weight;
+            if (w->dist[x] <= through_v) continue;
+
+            shortcuts++;
+            if (emit && worker_emit(w, u, x, v, through_v) != 0) {
+                worker_reset(w);
+                return -1;
+            }
+        }
+        worker_reset(w);
+    }
+    return shortcuts;
+}
+
+/*
+ * Function: compute_priority
+ * --------------------------
+ * Contraction order heuristic: shortcuts added minus edges removed (the edge
+ * difference), plus the number of already contracted neighbors so that
+ * contraction spreads evenly over the graph.
+ */
+static int compute_priority(const ch_builder_t* b, ch_worker_t* w, int v) {
+    int shortcuts = contract_vertex(b, w, v, 0);
+    return shortcuts - b->in[v].count - b->out[v].count + b->contracted_neighbors[v];
+}
+
+/* ---------------- Thread helpers ---------------- */
+
+typedef struct ch_task_t {
+    ch_builder_t* builder;
+    ch_worker_t* worker;
+    const int* items;
+    int begin;
+    int end;
+    int emit;       // 1: emit shortcuts for the items, 0: recompute their priorities
+    int failed;
+} ch_task_t;
+
+static void* ch_task_run(void* arg) {
+    ch_task_t* task = (ch_task_t*)arg;
+    for (int i = task->begin; i < task->end; i++) {
+        int v = task->items[i];
+        if (task->emit) {
+            if (contract_vertex(task->builder, task->worker, v, 1) < 0) task->failed = 1;
+        } else {
+            task->builder->priority[v] = compute_priority(task->builder, task->worker, v);
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Function: run_parallel
+ * ----------------------
+ * Splits items into one contiguous chunk per worker and processes the chunks
+ * on separate threads, the last one on the calling thread. A chunk whose
+ * thread cannot be started runs inline.
+ *
+ * returns: 0 if successful, -1 if a task failed to allocate
+ */
+static int run_parallel(ch_builder_t* b, ch_worker_t* workers, int threads, const int* items, int count, int emit) {
+    ch_task_t tasks[threads];
+    pthread_t handles[threads];
+    int started[threads];
+    if (count < 64 * threads) threads = 1; // Not worth a thread
+
+    for (int t = 0; t < threads; t++) {
+        tasks[t].builder = b;
+        tasks[t].worker = &workers[t];
+        tasks[t].items = items;
+        tasks[t].begin = (int)((long long)count * t / threads);
+        tasks[t].end = (int)((long long)count * (t + 1) / threads);
+        tasks[t].emit = emit;
+        tasks[t].failed = 0;
+        started[t] = 0;
+    }
+    for (int t = 0; t < threads - 1; t++) {
+        started[t] = pthread_create(&handles[t], NULL, ch_task_run, &tasks[t]) == 0;
+        if (!started[t]) ch_task_run(&tasks[t]);
+    }
+    ch_task_run(&tasks[threads - 1]);
+
+    int failed = 0;
+    for (int t = 0; t < threads; t++) {
+        if (t < threads - 1 && started[t]) pthread_join(handles[t], NULL);
+        failed |= tasks[t].failed;
+    }
+    return failed ? -1 : 0;
+}
+
+/* ---------------- Hierarchy construction ---------------- */
+
+/* Strict order on (priority, id) used to pick independent vertices */
+static int precedes(const ch_builder_t* b, int u, int v) {
+    return b->priority[u] < b->priority[v] || (b->priority[u] == b->priority[v] && u < v);
+}
+
+/*
+ * Function: is_local_minimum
+ * --------------------------
+ * Checks whether v comes before all of its active neighbors. Such vertices
+ * are pairwise non-adjacent, so a round can contract all of them at once.
+ */
+static int is_local_minimum(const ch_builder_t* b, int v) {
+    for (int i = 0; i < b->in[v].count; i++) {
+        int u = b->in[v].items[i].node;
+        if (b->state[u] == CH_ACTIVE && !precedes(b, v, u)) return 0;
+    }
+    for (int i = 0; i < b->out[v].count; i++) {
+        int u = b->out[v].items[i].node;
+        if (b->state[u] == CH_ACTIVE && !precedes(b, v, u)) return 0;
+    }
+    return 1;
+}
+
+static void ch_csr_free(ch_csr_t* csr) {
+    free(csr->offsets);
+    free(csr->nodes);
+    free(csr->middles);
+    free(csr->weights);
+}
+
+static int ch_csr_alloc(ch_csr_t* csr, int n, int m) {
+    csr->offsets = (int*)calloc(n + 1, sizeof(int));
+    csr->nodes = (int*)malloc((m + 1) * sizeof(int));
+    csr->middles = (int*)malloc((m + 1) * sizeof(int));
+    csr->weights = (double*)malloc((m + 1) * sizeof(double));
+    return (csr->offsets && csr->nodes && csr->middles && csr->weights) ? 0 : -1;
+}
+
+/*
+ * Function: build_search_graph
+ * ----------------------------
+ * Packs one side of the frozen edge lists into CSR form. A contracted
+ * vertex only kept edges to vertices contracted after it, so its out list
+ * holds its upward edges and its in list the downward edges ending at it.
+ *
+ * returns: 0 if successful, -1 if allocation fails
+ */
+static int build_search_graph(ch_csr_t* csr, int* num_edges, const ch_edge_list_t* lists, int n) {
+    int m = 0;
+    for (int v = 0; v < n; v++) m += lists[v].count;
+    if (ch_csr_alloc(csr, n, m) != 0) return -1;
+    *num_edges = m;
+
+    for (int v = 0; v < n; v++) {
+        int slot = csr->offsets[v];
+        for (int i = 0; i < lists[v].count; i++, slot++) {
+            csr->nodes[slot] = lists[v].items[i].node;
+            csr->middles[slot] = lists[v].items[i].middle;
+            csr->weights[slot] = lists[v].items[i].weight;
+        }
+        csr->offsets[v + 1] = slot;
+    }
+    return 0;
+}
+
+/* Allocates an empty hierarchy shell for num_ids vertex ids */
+static c_graph_ch_t* ch_alloc(int num_ids) {
+    c_graph_ch_t* ch = (c_graph_ch_t*)calloc(1, sizeof(c_graph_ch_t));
+    if (!ch) return NULL;
+    ch->num_ids = num_ids;
+    ch->present = (unsigned char*)calloc(num_ids, sizeof(unsigned char));
+    ch->rank = (int*)malloc(num_ids * sizeof(int));
+    pthread_mutex_init(&ch->pool_lock, NULL);
+    if (!ch->present || !ch->rank) {
+        graph_ch_destroy(ch);
+        return NULL;
+    }
+    return ch;
+}
+
+/*
+ * Function: graph_ch_build
+ * ------------------------
+ * Preprocesses a graph into a contraction hierarchy. Vertices are contracted
+ * in rounds: each round takes every active vertex whose priority is lower
+ * than that of all its active neighbors, finds the shortcuts for all of them
+ * in parallel (witness searches avoid the whole round, so the results do not
+ * depend on each other), applies the shortcuts, and recomputes the
+ * priorities of the affected neighbors in parallel.
+ *
+ * graph: pointer to the graph structure (edge weights must be non-negative)
+ * threads: number of threads to use, or <= 0 for the number of online CPUs
+ *
+ * returns: pointer to the hierarchy, or NULL if the graph is empty or allocation fails
+ */
+c_graph_ch_t* graph_ch_build(c_graph_t* graph, int threads) {
+    c_graph_csr_t* csr = graph_csr_get(graph, 0);
+    if (!csr) return NULL;
+    threads = graph_thread_count(threads);
+
+    int n = csr->num_ids;
+    c_graph_ch_t* ch = ch_alloc(n);
+    ch_builder_t* b = builder_create(csr);
+    ch_worker_t* workers = (ch_worker_t*)calloc(threads, sizeof(ch_worker_t));
+    int* active = (int*)malloc(n * sizeof(int));
+    int* selected = (int*)malloc(n * sizeof(int));
+    int* touched = (int*)malloc(n * sizeof(int));
+    unsigned char* marked = (unsigned char*)calloc(n, sizeof(unsigned char));
+    int ok = ch && b && workers && active && selected && touched && marked;
+    for (int t = 0; ok && t < threads; t++) {
+        workers[t].heap = graph_heap_create(n);
+        workers[t].dist = (double*)malloc(n * sizeof(double));
+        workers[t].target = (unsigned char*)calloc(n, sizeof(unsigned char));
+        ok = workers[t].heap && workers[t].dist && workers[t].target;
+        for (int i = 0; ok && i < n; i++) workers[t].dist[i] = DBL_MAX;
+    }
+
+    int active_count = 0;
+    if (ok) {
+        memcpy(ch->present, csr->present, n);
+        for (int v = 0; v < n; v++) {
+            ch->rank[v] = -1;
+            if (csr->present[v]) active[active_count++] = v;
+        }
+        ok = run_parallel(b, workers, threads, active, active_count, 0) == 0;
+    }
+
+    int next_rank = 0;
+    while (ok && active_count > 0) {
+        // Select the round; local minima are never adjacent to each other
+        int selected_count = 0;
+        for (int i = 0; i < active_count; i++) {
+            if (is_local_minimum(b, active[i])) selected[selected_count++] = active[i];
+        }
+        for (int i = 0; i < selected_count; i++) b->state[selected[i]] = CH_IN_ROUND;
+
+        for (int t = 0; t < threads; t++) workers[t].shortcut_count = 0;
+        if (run_parallel(b, workers, threads, selected, selected_count, 1) != 0) {
+            ok = 0;
+            break;
+        }
+
+        for (int t = 0; ok && t < threads; t++) {
+            for (int i = 0; i < workers[t].shortcut_count; i++) {
+                ch_shortcut_t* s = &workers[t].shortcuts[i];
+                if (builder_add_edge(b, s->from, s->to, s->middle, s->weight) != 0) ok = 0;
+            }
+        }
+
+        // Detach the round from its neighbors and collect those whose priority changed
+        int touched_count = 0;
+        for (int i = 0; i < selected_count; i++) {
+            int v = selected[i];
+            b->state[v] = CH_CONTRACTED;
+            ch->rank[v] = next_rank++;
+            for (int side = 0; side < 2; side++) {
+                const ch_edge_list_t* list = side ? &b->out[v] : &b->in[v];
+                for (int j = 0; j < list->count; j++) {
+                    int u = list->items[j].node;
+                    edge_list_remove(side ? &b->in[u] : &b->out[u], v);
+                    if (!side || !edge_list_find(&b->in[v], u)) b->contracted_neighbors[u]++;
+                    if (!marked[u]) {
+                        marked[u] = 1;
+                        touched[touched_count++] = u;
+                    }
+                }
+            }
+        }
+        for (int i = 0; i < touched_count; i++) marked[touched[i]] = 0;
+
+        int remaining = 0;
+        for (int i = 0; i < active_count; i++) {
+            if (b->state[active[i]] == CH_ACTIVE) active[remaining++] = active[i];
+        }
+        active_count = remaining;
+        if (ok && run_parallel(b, workers, threads, touched, touched_count, 0) != 0) ok = 0;
+    }
+
+    if (ok) {
+        ok = build_search_graph(&ch->up_out, &ch->num_up_out, b->out, n) == 0
+            && build_search_graph(&ch->up_in, &ch->num_up_in, b->in, n) == 0;
+    }
+
+    for (int t = 0; workers && t < threads; t++) {
+        graph_heap_destroy(workers[t].heap);
+        free(workers[t].dist);
+        free(workers[t].target);
+        free(workers[t].shortcuts);
+    }
+    free(workers);
+    free(active);
+    free(selected);
+    free(touched);
+    free(marked);
+    builder_destroy(b);
+
+    if (!ok) {
+        graph_ch_destroy(ch);
+        return NULL;
+    }
+    return ch;
+}
+
+static void workspace_free(ch_query_workspace_t* ws) {
+    if (!ws) return;
+    for (int side = 0; side < 2; side++) {
+        graph_heap_destroy(ws->heap[side]);
+        free(ws->dist[side]);
+        free(ws->parent[side]);
+        free(ws->parent_edge[side]);
+    }
+    free(ws);
+}
+
+/*
+ * Function: graph_ch_destroy
+ * --------------------------
+ * Frees a hierarchy and its pooled query workspaces.
+ *
+ * ch: pointer to the hierarchy
+ *
+ * returns: void
+ */
+void graph_ch_destroy(c_graph_ch_t* ch) {
+    if (!ch) return;
+    while (ch->pool) {
+        ch_query_workspace_t* next = ch->pool->next;
+        workspace_free(ch->pool);
+        ch->pool = next;
+    }
+    pthread_mutex_destroy(&ch->pool_lock);
+    ch_csr_free(&ch->up_out);
+    ch_csr_free(&ch->up_in);
+    free(ch->present);
+    free(ch->rank);
+    free(ch);
+}
+
+/* ---------------- Queries ---------------- */
+
+/*
+ * Function: workspace_acquire
+ * ---------------------------
+ * Takes a query workspace from the pool, or allocates one with all
+ * distances at DBL_MAX. Workspaces are cleaned up through their heaps'
+ * touched lists before going back, so reuse costs nothing per vertex.
+ *
+ * returns: pointer to the workspace, or NULL if allocation fails
+ */
+static ch_query_workspace_t* workspace_acquire(c_graph_ch_t* ch) {
+    pthread_mutex_lock(&ch->pool_lock);
+    ch_query_workspace_t* ws = ch->pool;
+    if (ws) ch->pool = ws->next;
+    pthread_mutex_unlock(&ch->pool_lock);
+    if (ws) return ws;
+
+    ws = (ch_query_workspace_t*)calloc(1, sizeof(ch_query_workspace_t));
+    if (!ws) return NULL;
+    int n = ch->num_ids;
+    for (int side = 0; side < 2; side++) {
+        ws->heap[side] = graph_heap_create(n);
+        ws->dist[side] = (double*)malloc(n * sizeof(double));
+        ws->parent[side] = (int*)malloc(n * sizeof(int));
+        ws->parent_edge[side] = (int*)malloc(n * sizeof(int));
+        if (!ws->heap[side] || !ws->dist[side] || !ws->parent[side] || !ws->parent_edge[side]) {
+            workspace_free(ws);
+            return NULL;
+        }
+        for (int i = 0; i < n; i++) ws->dist[side][i] = DBL_MAX;
+    }
+    return ws;
+}
+
+static void workspace_release(c_graph_ch_t* ch, ch_query_workspace_t* ws) {
+    for (int side = 0; side < 2; side++) {
+        c_graph_heap_t* heap = ws->heap[side];
+        for (int i = 0; i < heap->touched_count; i++) {
+            ws->dist[side][heap->touched[i]] = DBL_MAX;
+        }
+        graph_heap_reset(heap);
+    }
+    pthread_mutex_lock(&ch->pool_lock);
+    ws->next = ch->pool;
+    ch->pool = ws;
+    pthread_mutex_unlock(&ch->pool_lock);
+}
+
+/* Finds the edge at index node of csr that leads to other; -1 if there is none */
+static int find_edge(const ch_csr_t* csr, int node, int other) {
+    for (int i = csr->offsets[node]; i < csr->offsets[node + 1]; i++) {
+        if (csr->nodes[i] == other) return i;
+    }
+    return -1;
+}
+
+typedef struct ch_path_t {
+    int* ids;
+    int count;
+    int capacity;
+} ch_path_t;
+
+static int path_append(ch_path_t* path, int id) {
+    if (path->count == path->capacity) {
+        int capacity = path->capacity ? path->capacity * 2 : 16;
+        int* ids = (int*)realloc(path->ids, capacity * sizeof(int));
+        if (!ids) return -1;
+        path->ids = ids;
+        path->capacity = capacity;
+    }
+    path->ids[path->count++] = id;
+    return 0;
+}
+
+typedef struct ch_unpack_frame_t {
+    int from;
+    int to;
+    int middle;
+} ch_unpack_frame_t;
+
+/*
+ * Function: unpack_edge
+ * ---------------------
+ * Appends the original vertices of edge from -> to after from. A shortcut
+ * through middle stands for from -> middle -> to, and middle was contracted
+ * before both ends, so from -> middle is a downward edge stored at middle
+ * and middle -> to an upward edge stored at middle. Pending halves are kept
+ * on an explicit stack, so deep hierarchies cannot overflow the call stack.
+ *
+ * returns: 0 if successful, -1 if allocation fails or the hierarchy is inconsistent
+ */
+static int unpack_edge(const c_graph_ch_t* ch, int from, int to, int middle, ch_path_t* path) {
+    if (middle == -1) return path_append(path, to);
+
+    int capacity = 16;
+    int count = 0;
+    ch_unpack_frame_t* stack = (ch_unpack_frame_t*)malloc(capacity * sizeof(ch_unpack_frame_t));
+    if (!stack) return -1;
+    stack[count++] = (ch_unpack_frame_t){from, to, middle};
+
+    int failed = 0;
+    while (!failed && count > 0) {
+        ch_unpack_frame_t frame = stack[--count];
+        if (frame.middle == -1) {
+            failed = path_append(path, frame.to);
+            continue;
+        }
+
+        int first = find_edge(&ch->up_in, frame.middle, frame.from);
+        int second = find_edge(&ch->up_out, frame.middle, frame.to);
+        if (first < 0 || second < 0) {
+            failed = -1;
+            break;
+        }
+        if (count + 2 > capacity) {
+            capacity *= 2;
+            ch_unpack_frame_t* grown = (ch_unpack_frame_t*)realloc(stack, capacity * sizeof(ch_unpack_frame_t));
+            if (!grown) {
+                failed = -1;
+                break;
+            }
+            stack = grown;
+        }
+        // The second half goes in first so the first half is unpacked first
+        stack[count++] = (ch_unpack_frame_t){frame.middle, frame.to, ch->up_out.middles[second]};
+        stack[count++] = (ch_unpack_frame_t){frame.from, frame.middle, ch->up_in.middles[first]};
+    }
+    free(stack);
+    return failed ? -1 : 0;
+}
+
+/*
+ * Function: build_path
+ * --------------------
+ * Unpacks the forward half from start to meet and the backward half from
+ * meet to end into a path of original vertices.
+ *
+ * returns: array of vertex IDs, or NULL if allocation fails
+ */
+static int* build_path(const c_graph_ch_t* ch, const ch_query_workspace_t* ws, int start_id, int meet, int* path_len) {
+    // Forward parents run from meet back to start; collect them to walk forward
+    int hops = 0;
+    for (int v = meet; v != start_id; v = ws->parent[0][v]) hops++;
+    int* chain = (int*)malloc((hops + 1) * sizeof(int));
+    if (!chain) return NULL;
+    int i = hops;
+    for (int v = meet; ; v = ws->parent[0][v]) {
+        chain[i--] = v;
+        if (v == start_id) break;
+    }
+
+    ch_path_t path = {NULL, 0, 0};
+    int failed = path_append(&path, start_id);
+    for (int k = 1; !failed && k <= hops; k++) {
+        int edge = ws->parent_edge[0][chain[k]];
+        failed = unpack_edge(ch, chain[k - 1], chain[k], ch->up_out.middles[edge], &path);
+    }
+    free(chain);
+
+    for (int v = meet; !failed && ws->parent[1][v] != -1; v = ws->parent[1][v]) {
+        int next = ws->parent[1][v];
+        int edge = ws->parent_edge[1][v];
+        failed = unpack_edge(ch, v, next, ch->up_in.middles[edge], &path);
+    }
+
+    if (failed) {
+        free(path.ids);
+        return NULL;
+    }
+    *path_len = path.count;
+    return path.ids;
+}
+
+/*
+ * Function: graph_ch_query
+ * ------------------------
+ * Finds the shortest path between start_id and end_id in a hierarchy. A
+ * forward search from the start and a backward search from the end each
+ * only follow edges toward higher-ranked vertices; the shortest path goes up
+ * from both ends to its highest vertex, where the two searches meet. Both
+ * searches stay in the small upward cone of their origin. Shortcuts on the
+ * result are unpacked back into original edges. Safe to call from several
+ * threads at once.
+ *
+ * ch: pointer to the hierarchy
+ * start_id: ID of the starting vertex
+ * end_id: ID of the destination vertex
+ * path_len: pointer to an integer to store the length of the path
+ *
+ * returns: array of vertex IDs representing the shortest path
+ *          or NULL if no path exists or input is invalid
+ */
+int* graph_ch_query(c_graph_ch_t* ch, int start_id, int end_id, int* path_len) {
+    if (!path_len) return NULL;
+    *path_len = 0;
+    graph_settled_count = 0;
+    if (!ch) return NULL;
+    if (start_id < 0 || start_id >= ch->num_ids || !ch->present[start_id]) return NULL;
+    if (end_id < 0 || end_id >= ch->num_ids || !ch->present[end_id]) return NULL;
+
+    ch_query_workspace_t* ws = workspace_acquire(ch);
+    if (!ws) return NULL;
+
+    const ch_csr_t* graphs[2] = {&ch->up_out, &ch->up_in};
+    int origins[2] = {start_id, end_id};
+    for (int side = 0; side < 2; side++) {
+        ws->dist[side][origins[side]] = 0;
+        ws->parent[side][origins[side]] = -1;
+        graph_heap_push(ws->heap[side], origins[side], 0);
+    }
+
+    double best = DBL_MAX;
+    int meet = -1;
+    while (1) {
+        // A side is done once its closest queued vertex cannot improve on the best meeting
+        double forward_min = graph_heap_min_key(ws->heap[0]);
+        double backward_min = graph_heap_min_key(ws->heap[1]);
+        if (forward_min >= best && backward_min >= best) break;
+        int side = (forward_min <= backward_min) ? 0 : 1;
+
+        int u = graph_heap_pop(ws->heap[side]);
+        graph_settled_count++;
+        double* dist = ws->dist[side];
+        if (ws->dist[!side][u] != DBL_MAX && dist[u] + ws->dist[!side][u] < best) {
+            best = dist[u] + ws->dist[!side][u];
+            meet = u;
+        }
+
+        const ch_csr_t* csr = graphs[side];
+        for (int i = csr->offsets[u]; i < csr->offsets[u + 1]; i++) {
+            int v = csr->nodes[i];
+            double candidate = dist[u] + csr->weights[i];
+            if (candidate >= dist[v]) continue;
+            dist[v] = candidate;
+            ws->parent[side][v] = u;
+            ws->parent_edge[side][v] = i;
+            graph_heap_push(ws->heap[side], v, candidate);
+        }
+    }
+
+    int* path = (meet != -1) ? build_path(ch, ws, start_id, meet, path_len) : NULL;
+    workspace_release(ch, ws);
+    return path;
+}
+
+/* ---------------- Serialization ---------------- */
+
+static int write_block(FILE* file, const void* data, size_t size, size_t count) {
+    return (count == 0 || fwrite(data, size, count, file) == count) ? 0 : -1;
+}
+
+static int read_block(FILE* file, void* data, size_t size, size_t count) {
+    return (count == 0 || fread(data, size, count, file) == count) ? 0 : -1;
+}
+
+static int write_csr(FILE* file, const ch_csr_t* csr, int n, int m) {
+    if (write_block(file, &m, sizeof(int), 1) != 0) return -1;
+    if (write_block(file, csr->offsets, sizeof(int), n + 1) != 0) return -1;
+    if (write_block(file, csr->nodes, sizeof(int), m) != 0) return -1;
+    if (write_block(file, csr->middles, sizeof(int), m) != 0) return -1;
+    return write_block(file, csr->weights, sizeof(double), m);
+}
+
+/*
+ * Function: read_csr
+ * ------------------
+ * Reads one edge array and checks that offsets and vertex references are
+ * in range, so a damaged file cannot send a query out of bounds.
+ *
+ * returns: number of edges, or -1 on read error or invalid data
+ */
+static int read_csr(FILE* file, ch_csr_t* csr, int n) {
+    int m;
+    if (read_block(file, &m, sizeof(int), 1) != 0 || m < 0) return -1;
+    if (ch_csr_alloc(csr, n, m) != 0) return -1;
+    if (read_block(file, csr->offsets, sizeof(int), n + 1) != 0) return -1;
+    if (read_block(file, csr->nodes, sizeof(int), m) != 0) return -1;
+    if (read_block(file, csr->middles, sizeof(int), m) != 0) return -1;
+    if (read_block(file, csr->weights, sizeof(double), m) != 0) return -1;
+
+    if (csr->offsets[0] != 0 || csr->offsets[n] != m) return -1;
+    for (int v = 0; v < n; v++) {
+        if (csr->offsets[v + 1] < csr->offsets[v]) return -1;
+    }
+    for (int i = 0; i < m; i++) {
+        if (csr->nodes[i] < 0 || csr->nodes[i] >= n) return -1;
+        if (csr->middles[i] < -1 || csr->middles[i] >= n) return -1;
+    }
+    return m;
+}
+
+/*
+ * Function: validate_edges
+ * ------------------------
+ * Checks that every edge stored at a vertex leads to a higher-ranked vertex
+ * and that every shortcut's middle ranks below both of its ends, with the
+ * two halves it stands for present. Ranks then fall strictly on every
+ * unpacking step, which bounds it. inbound is nonzero for up_in, whose
+ * edges at v run from the stored vertex into v.
+ *
+ * returns: 0 if the edges are consistent, -1 otherwise
+ */
+static int validate_edges(const c_graph_ch_t* ch, const ch_csr_t* csr, int inbound) {
+    for (int v = 0; v < ch->num_ids; v++) {
+        for (int i = csr->offsets[v]; i < csr->offsets[v + 1]; i++) {
+            int node = csr->nodes[i];
+            if (!ch->present[v] || !ch->present[node]) return -1;
+            if (ch->rank[node] <= ch->rank[v]) return -1;
+
+            int middle = csr->middles[i];
+            if (middle == -1) continue;
+            if (!ch->present[middle]) return -1;
+            if (ch->rank[middle] >= ch->rank[v] || ch->rank[middle] >= ch->rank[node]) return -1;
+            int from = inbound ? node : v;
+            int to = inbound ? v : node;
+            if (find_edge(&ch->up_in, middle, from) < 0) return -1;
+            if (find_edge(&ch->up_out, middle, to) < 0) return -1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Function: validate_hierarchy
+ * ----------------------------
+ * Checks the invariants queries rely on: present vertices hold a
+ * permutation of the ranks 0..count-1, absent ones hold -1, and both edge
+ * arrays only point upward.
+ *
+ * returns: 0 if the hierarchy is consistent, -1 otherwise
+ */
+static int validate_hierarchy(const c_graph_ch_t* ch) {
+    int n = ch->num_ids;
+    int count = 0;
+    for (int v = 0; v < n; v++) {
+        if (ch->present[v] > 1) return -1;
+        count += ch->present[v];
+    }
+
+    unsigned char* seen = (unsigned char*)calloc((size_t)count + 1, sizeof(unsigned char));
+    if (!seen) return -1;
+    int failed = 0;
+    for (int v = 0; v < n && !failed; v++) {
+        int rank = ch->rank[v];
+        if (!ch->present[v]) {
+            failed = rank != -1;
+        } else if (rank < 0 || rank >= count || seen[rank]) {
+            failed = 1;
+        } else {
+            seen[rank] = 1;
+        }
+    }
+    free(seen);
+    if (failed) return -1;
+
+    if (validate_edges(ch, &ch->up_out, 0) != 0) return -1;
+    return validate_edges(ch, &ch->up_in, 1);
+}
+
+/*
+ * Function: graph_ch_save
+ * -----------------------
+ * Writes a hierarchy to a binary file in the machine's native byte order.
+ *
+ * ch: pointer to the hierarchy
+ * filename: path of the file to write
+ *
+ * returns: 0 if successful, -1 on failure
+ */
+int graph_ch_save(const c_graph_ch_t* ch, const char* filename) {
+    if (!ch || !filename) return -1;
+    FILE* file = fopen(filename, "wb");
+    if (!file) return -1;
+
+    int n = ch->num_ids;
+    int failed = write_block(file, CH_FILE_MAGIC, 1, 8) != 0
+        || write_block(file, &n, sizeof(int), 1) != 0
+        || write_block(file, ch->present, 1, n) != 0
+        || write_block(file, ch->rank, sizeof(int), n) != 0
+        || write_csr(file, &ch->up_out, n, ch->num_up_out) != 0
+        || write_csr(file, &ch->up_in, n, ch->num_up_in) != 0;
+
+    if (fclose(file) != 0) failed = 1;
+    return failed ? -1 : 0;
+}
+
+/*
+ * Function: graph_ch_load
+ * -----------------------
+ * Reads a hierarchy written by graph_ch_save. Files whose ranks or edges
+ * break the hierarchy's invariants are rejected.
+ *
+ * filename: path of the file to read
+ *
+ * returns: pointer to the hierarchy, or NULL if the file cannot be read or is invalid
+ */
+c_graph_ch_t* graph_ch_load(const char* filename) {
+    if (!filename) return NULL;
+    FILE* file = fopen(filename, "rb");
+    if (!file) return NULL;
+
+    char magic[8];
+    int n = 0;
+    c_graph_ch_t* ch = NULL;
+    if (read_block(file, magic, 1, 8) == 0 && memcmp(magic, CH_FILE_MAGIC, 8) == 0
+        && read_block(file, &n, sizeof(int), 1) == 0 && n > 0) {
+        ch = ch_alloc(n);
+    }
+
+    int failed = !ch
+        || read_block(file, ch->present, 1, n) != 0
+        || read_block(file, ch->rank, sizeof(int), n) != 0
+        || (ch->num_up_out = read_csr(file, &ch->up_out, n)) < 0
+        || (ch->num_up_in = read_csr(file, &ch->up_in, n)) < 0
+        || validate_hierarchy(ch) != 0;
+    fclose(file);
+
+    if (failed) {
+        graph_ch_destroy(ch);
+        return NULL;
+    }
+    return ch;
+}
@@ -0,0 +1,357 @@
+#define _GNU_SOURCE
+#include "c_graph_internal.h"
+#include "c_graph.h"
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#define DELTA_CHUNK 64 // Frontier vertices claimed per atomic increment
+#define DELTA_MAX_BUCKETS 4096 // Cap on the bucket ring; delta is widened to stay under it
+#define DELTA_MAX_BIN (SIZE_MAX / 2) // Bins saturate here instead of overflowing the cast
+
+/* Growable array of vertex ids */
+typedef struct delta_bin_t {
+    int* ids;
+    int count;
+    int capacity;
+} delta_bin_t;
+
+/* Bucket ring owned by one thread; bin floor(distance / delta) lives in slot bin % num_buckets */
+typedef struct delta_worker_t {
+    delta_bin_t* bins;
+    long long processed;
+    int failed;
+} delta_worker_t;
+
+/* State shared by all threads of one search */
+typedef struct delta_job_t {
+    const c_graph_csr_t* csr;
+    double delta;
+    size_t num_buckets;
+    _Atomic double* dist;
+    atomic_int* stamp;          // Last iteration a vertex was put on the frontier
+    int* frontier;
+    atomic_int frontier_size;
+    atomic_int next_index;
+    atomic_size_t next_bin;
+    atomic_int failed;
+    size_t current_bin;
+    int iteration;
+    int done;
+    pthread_barrier_t barrier;
+    pthread_mutex_t start_lock;
+    pthread_cond_t start_cond;
+    int started;                // Set once the barrier is sized to the threads that started
+    delta_worker_t* workers;
+} delta_job_t;
+
+typedef struct delta_thread_t {
+    delta_job_t* job;
+    delta_worker_t* worker;
+} delta_thread_t;
+
+/* Bin of a distance; the only place distances are mapped to bins, so membership tests agree exactly */
+static size_t bin_of(double distance, double delta) {
+    double bin = distance / delta;
+    return (bin < (double)DELTA_MAX_BIN) ? (size_t)bin : DELTA_MAX_BIN;
+}
+
+static int bin_push(const delta_job_t* job, delta_worker_t* worker, size_t bin, int id) {
+    delta_bin_t* b = &worker->bins[bin % job->num_buckets];
+    if (b->count == b->capacity) {
+        int capacity = b->capacity ? b->capacity * 2 : 16;
+        int* ids = (int*)realloc(b->ids, capacity * sizeof(int));
+        if (!ids) return -1;
+        b->ids = ids;
+        b->capacity = capacity;
+    }
+    b->ids[b->count++] = id;
+    return 0;
+}
+
+/*
+ * Function: relax_frontier
+ * ------------------------
+ * Claims chunks of the shared frontier and relaxes the edges of every vertex
+ * whose distance still falls in the current bin or later (entries for
+ * vertices that have since moved to an earlier, already processed bin are
+ * stale). Distances only decrease, through compare-and-swap, and every
+ * vertex whose distance drops goes into this thread's bin for its new
+ * distance, so it is processed again.
+ */
+static void relax_frontier(delta_job_t* job, delta_worker_t* worker) {
+    const c_graph_csr_t* csr = job->csr;
+    int size = atomic_load(&job->frontier_size);
+
+    int begin;
+    while ((begin = atomic_fetch_add(&job->next_index, DELTA_CHUNK)) < size) {
+        int end = (begin + DELTA_CHUNK < size) ? begin + DELTA_CHUNK : size;
+        for (int k = begin; k < end; k++) {
+            int u = job->frontier[k];
+            double du = atomic_load_explicit(&job->dist[u], memory_order_relaxed);
+            if (bin_of(du, job->delta) < job->current_bin) continue;
+            worker->processed++;
+
+            for (int i = csr->offsets[u]; i < csr->offsets[u + 1]; i++) {
+                int v = csr->targets[i];
+                double candidate = du + csr->weights[i];
+                double old = atomic_load_explicit(&job->dist[v], memory_order_relaxed);
+                while (candidate < old) {
+                    if (atomic_compare_exchange_weak_explicit(&job->dist[v], &old, candidate,
+                                                              memory_order_relaxed, memory_order_relaxed)) {
+                        if (bin_push(job, worker, bin_of(candidate, job->delta), v) != 0) worker->failed = 1;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Function: delta_thread_run
+ * --------------------------
+ * Main loop of every thread. Each iteration relaxes the frontier, agrees on
+ * the lowest non-empty bin across all threads, and moves that bin's live,
+ * not yet queued entries into the next frontier. A bin is taken again after
+ * it was processed as long as light edges keep refilling it, which is how
+ * vertices within delta of each other settle together. Every queued bin lies
+ * less than num_buckets past the current one, so the slots of the ring never
+ * hold two bins at once. One thread of each barrier does the bookkeeping
+ * between phases.
+ */
+static void* delta_thread_run(void* arg) {
+    delta_job_t* job = ((delta_thread_t*)arg)->job;
+    delta_worker_t* worker = ((delta_thread_t*)arg)->worker;
+
+    pthread_mutex_lock(&job->start_lock);
+    while (!job->started) pthread_cond_wait(&job->start_cond, &job->start_lock);
+    pthread_mutex_unlock(&job->start_lock);
+
+    while (1) {
+        relax_frontier(job, worker);
+        if (worker->failed) atomic_store(&job->failed, 1);
+        if (pthread_barrier_wait(&job->barrier) == PTHREAD_BARRIER_SERIAL_THREAD) {
+            atomic_store(&job->frontier_size, 0);
+            atomic_store(&job->next_index, 0);
+            atomic_store(&job->next_bin, SIZE_MAX);
+        }
+        pthread_barrier_wait(&job->barrier);
+
+        // Relaxations never lower a distance below the current bin, so earlier bins are empty
+        for (size_t offset = 0; offset < job->num_buckets; offset++) {
+            size_t bin = job->current_bin + offset;
+            if (worker->bins[bin % job->num_buckets].count == 0) continue;
+            size_t seen = atomic_load(&job->next_bin);
+            while (bin < seen && !atomic_compare_exchange_weak(&job->next_bin, &seen, bin)) {
+            }
+            break;
+        }
+        if (pthread_barrier_wait(&job->barrier) == PTHREAD_BARRIER_SERIAL_THREAD) {
+            job->current_bin = atomic_load(&job->next_bin);
+            job->done = job->current_bin == SIZE_MAX || atomic_load(&job->failed);
+            job->iteration++;
+        }
+        pthread_barrier_wait(&job->barrier);
+        if (job->done) break;
+
+        // Drop stale and duplicate entries, then append the rest to the frontier in one block
+        {
+            delta_bin_t* b = &worker->bins[job->current_bin % job->num_buckets];
+            int kept = 0;
+            for (int i = 0; i < b->count; i++) {
+                int v = b->ids[i];
+                double dv = atomic_load_explicit(&job->dist[v], memory_order_relaxed);
+                if (bin_of(dv, job->delta) != job->current_bin) continue;
+                if (atomic_exchange_explicit(&job->stamp[v], job->iteration, memory_order_relaxed) == job->iteration) continue;
+                b->ids[kept++] = v;
+            }
+            if (kept > 0) {
+                int offset = atomic_fetch_add(&job->frontier_size, kept);
+                memcpy(job->frontier + offset, b->ids, kept * sizeof(int));
+            }
+            b->count = 0;
+        }
+        pthread_barrier_wait(&job->barrier);
+    }
+    return NULL;
+}
+
+/*
+ * Function: default_delta
+ * -----------------------
+ * Bucket width used when the caller does not pick one: the average edge
+ * weight, so a typical edge crosses about one bin.
+ */
+static double default_delta(const c_graph_csr_t* csr) {
+    double sum = 0;
+    for (int i = 0; i < csr->num_edges; i++) sum += csr->weights[i];
+    return (csr->num_edges > 0 && sum > 0) ? sum / csr->num_edges : 1;
+}
+
+/*
+ * Function: bucket_count
+ * ----------------------
+ * Sizes the bucket ring. A relaxation from the current bin reaches at most
+ * ceil(max_weight / delta) bins further, so that many slots plus the
+ * current one cover every queued bin; the integer part plus two gives at
+ * least that, and one more absorbs rounding in distance / delta. A delta
+ * far below the heaviest edge is widened so the ring stays small, which
+ * keeps results exact and only changes the order of work.
+ */
+static size_t bucket_count(const c_graph_csr_t* csr, double* delta) {
+    double max_weight = 0;
+    for (int i = 0; i < csr->num_edges; i++) {
+        if (csr->weights[i] > max_weight) max_weight = csr->weights[i];
+    }
+    if (max_weight / *delta > DELTA_MAX_BUCKETS) *delta = max_weight / DELTA_MAX_BUCKETS;
+    return (size_t)(max_weight / *delta) + 3;
+}
+
+/*
+ * Function: fill_parents
+ * ----------------------
+ * Derives predecessors from final distances with a breadth-first pass over
+ * tight edges (dist[u] + w == dist[v]) from the source. Every reached
+ * vertex got its distance from such an edge, and walking out from the
+ * source keeps zero-weight cycles from forming parent loops.
+ *
+ * returns: 0 if successful, -1 if allocation fails
+ */
+static int fill_parents(const c_graph_csr_t* csr, c_graph_spt_t* tree) {
+    int* queue = (int*)malloc(csr->num_ids * sizeof(int));
+    if (!queue) return -1;
+    for (int i = 0; i < csr->num_ids; i++) tree->parent[i] = -1;
+
+    int head = 0, tail = 0;
+    queue[tail++] = tree->source;
+    while (head < tail) {
+        int u = queue[head++];
+        for (int i = csr->offsets[u]; i < csr->offsets[u + 1]; i++) {
+            int v = csr->targets[i];
+            if (v == tree->source || tree->parent[v] != -1) continue;
+            if (tree->dist[u] + csr->weights[i] != tree->dist[v]) continue;
+            tree->parent[v] = u;
+            queue[tail++] = v;
+        }
+    }
+    free(queue);
+    return 0;
+}
+
+/*
+ * Function: graph_spt_delta_stepping
+ * ----------------------------------
+ * Parallel single-source shortest paths by delta-stepping. Vertices are
+ * kept in bins of width delta by tentative distance; all vertices of the
+ * lowest non-empty bin are relaxed at once by all threads, instead of one
+ * vertex at a time as in Dijkstra. Small deltas approach Dijkstra's order
+ * with little parallelism per step, large ones approach Bellman-Ford with
+ * lots of parallelism but repeated work. Distances are the same as those
+ * of graph_dijkstra. Edge weights must be non-negative. Bins live in a ring
+ * sized by the heaviest edge, so memory does not grow with path lengths.
+ *
+ * graph: pointer to the graph structure
+ * source: ID of the source vertex
+ * delta: bucket width, or <= 0 for the average edge weight
+ * threads: number of threads to use, or <= 0 for the number of online CPUs
+ *
+ * returns: pointer to the tree, or NULL if source is not a vertex or allocation fails
+ */
+c_graph_spt_t* graph_spt_delta_stepping(c_graph_t* graph, int source, double delta, int threads) {
+    c_graph_csr_t* csr = graph_csr_get(graph, 0);
+    if (!csr) return NULL;
+    if (source < 0 || source >= csr->num_ids || !csr->present[source]) return NULL;
+    if (delta <= 0) delta = default_delta(csr);
+    size_t num_buckets = bucket_count(csr, &delta);
+    threads = graph_thread_count(threads);
+
+    int n = csr->num_ids;
+    c_graph_spt_t* tree = graph_spt_alloc(source, n);
+    delta_job_t job;
+    memset(&job, 0, sizeof(job));
+    pthread_mutex_init(&job.start_lock, NULL);
+    pthread_cond_init(&job.start_cond, NULL);
+    job.csr = csr;
+    job.delta = delta;
+    job.num_buckets = num_buckets;
+    job.dist = (_Atomic double*)malloc(n * sizeof(_Atomic double));
+    job.stamp = (atomic_int*)malloc(n * sizeof(atomic_int));
+    job.frontier = (int*)malloc(n * sizeof(int));
+    job.workers = (delta_worker_t*)calloc(threads, sizeof(delta_worker_t));
+    delta_thread_t* args = (delta_thread_t*)malloc(threads * sizeof(delta_thread_t));
+    pthread_t* handles = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    int ok = tree && job.dist && job.stamp && job.frontier && job.workers && args && handles;
+    for (int t = 0; ok && t < threads; t++) {
+        job.workers[t].bins = (delta_bin_t*)calloc(num_buckets, sizeof(delta_bin_t));
+        ok = job.workers[t].bins != NULL;
+    }
+
+    if (ok) {
+        for (int i = 0; i < n; i++) {
+            atomic_init(&job.dist[i], DBL_MAX);
+            atomic_init(&job.stamp[i], -1);
+        }
+        atomic_init(&job.dist[source], 0.0);
+        job.frontier[0] = source;
+        atomic_init(&job.frontier_size, 1);
+        atomic_init(&job.next_index, 0);
+        atomic_init(&job.next_bin, 0);
+        atomic_init(&job.failed, 0);
+        job.current_bin = 0;
+        job.iteration = 0;
+        job.done = 0;
+        for (int t = 0; t < threads; t++) {
+            args[t].job = &job;
+            args[t].worker = &job.workers[t];
+        }
+    }
+
+    if (ok) {
+        // Size the barrier to the threads that actually started before any of them reaches it
+        int started = 0;
+        pthread_mutex_lock(&job.start_lock);
+        while (started < threads - 1
+               && pthread_create(&handles[started], NULL, delta_thread_run, &args[started]) == 0) {
+            started++;
+        }
+        pthread_barrier_init(&job.barrier, NULL, started + 1);
+        job.started = 1;
+        pthread_cond_broadcast(&job.start_cond);
+        pthread_mutex_unlock(&job.start_lock);
+
+        delta_thread_run(&args[started]);
+        for (int t = 0; t < started; t++) pthread_join(handles[t], NULL);
+        pthread_barrier_destroy(&job.barrier);
+        ok = !atomic_load(&job.failed);
+    }
+
+    if (ok) {
+        long long processed = 0;
+        for (int t = 0; t < threads; t++) processed += job.workers[t].processed;
+        graph_settled_count = processed;
+        for (int i = 0; i < n; i++) tree->dist[i] = atomic_load(&job.dist[i]);
+        ok = fill_parents(csr, tree) == 0;
+    }
+
+    for (int t = 0; job.workers && t < threads; t++) {
+        for (size_t bin = 0; job.workers[t].bins && bin < num_buckets; bin++) free(job.workers[t].bins[bin].ids);
+        free(job.workers[t].bins);
+    }
+    free(job.workers);
+    free((void*)job.dist);
+    free((void*)job.stamp);
+    free(job.frontier);
+    free(args);
+    free(handles);
+    pthread_mutex_destroy(&job.start_lock);
+    pthread_cond_destroy(&job.start_cond);
+
+    if (!ok) {
+        graph_spt_destroy(tree);
+        return NULL;
+    }
+    return tree;
+}
@@ -1,5 +1,6 @@
 #include "c_graph_internal.h"
 #include "c_graph.h"
+#include "c_bit_vector.h"
 #include <stdlib.h>
 #include <stdbool.h>
 
@@ -32,14 +33,14 @@ static int get_max_vertex_id(c_graph_t* graph) {
  *
  * graph: pointer to the graph structure
  * u: current vertex ID
- * visited: boolean array tracking visited vertices
+ * visited: bit vector tracking visited vertices
  * path: array to store the traversal order
  * path_index: pointer to current index in the path array
  *
  * returns: void
  */
-static void dfs_util(c_graph_t* graph, int u, bool* visited, int* path, int* path_index) {
-    visited[u] = true;                  // Mark current vertex as visited
+static void dfs_util(c_graph_t* graph, int u, BitVector* visited, int* path, int* path_index) {
+    bit_vector_set(visited, u);         // Mark current vertex as visited
     path[(*path_index)++] = u;          // Record vertex in path
 
     // Locate the vertex structure corresponding to u
@@ -53,7 +54,7 @@ static void dfs_util(c_graph_t* graph, int u, bool* visited, int* path, int* pat
         c_graph_edge_t* edge = u_vertex->edges;
         while (edge) {
             int v = edge->dest_id;
-            if (!visited[v]) {
+            if (bit_vector_get(visited, v) == 0) {
                 dfs_util(graph, v, visited, path, path_index);
             }
             edge = edge->next;
@@ -86,10 +87,10 @@ int* graph_dfs(c_graph_t* graph, int start_id, int* path_len) {
     }
 
     // Allocate memory for visited flags and traversal path
-    bool* visited = (bool*)calloc(max_id + 1, sizeof(bool));
+    BitVector* visited = create_bit_vector(max_id + 1); // One bit per vertex
     int* path = (int*)malloc((max_id + 1) * sizeof(int));
     if (!visited || !path) {
-        free(visited);
+        destroy_bit_vector(visited);
         free(path);
         *path_len = 0;
         return NULL; // Memory allocation failed
@@ -108,7 +109,7 @@ int* graph_dfs(c_graph_t* graph, int start_id, int* path_len) {
         return NULL;
     }
 
-    free(visited); // Free temporary visited array
+    destroy_bit_vector(visited); // Free temporary visited set
     return result_path;
 }
 
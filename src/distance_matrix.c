@@ -0,0 +1,146 @@
+#include "c_graph_internal.h"
+#include "c_graph.h"
+#include <stdlib.h>
+#include <float.h>
+#include <stdatomic.h>
+
+/* Shared, read-only description of the job plus the next row to hand out */
+typedef struct matrix_job_t {
+    const c_graph_csr_t* csr;
+    const int* sources;
+    int n;
+    const int* targets;
+    int m;
+    const unsigned char* is_target;
+    int distinct_targets;
+    double* out;
+    atomic_int next_row;
+    atomic_int failed;
+} matrix_job_t;
+
+/*
+ * Function: matrix_worker
+ * -----------------------
+ * Claims rows one at a time and fills each with a Dijkstra search from its
+ * source that stops once every target is settled. The heap and distance
+ * array are allocated once per thread; after each row only the vertices the
+ * search touched are reset, so a short search costs nothing per vertex.
+ */
+static void* matrix_worker(void* arg) {
+    matrix_job_t* job = (matrix_job_t*)arg;
+    const c_graph_csr_t* csr = job->csr;
+    c_graph_heap_t* heap = graph_heap_create(csr->num_ids);
+    double* dist = (double*)malloc(csr->num_ids * sizeof(double));
+    if (!heap || !dist) {
+        atomic_store(&job->failed, 1);
+        graph_heap_destroy(heap);
+        free(dist);
+        return NULL;
+    }
+    for (int i = 0; i < csr->num_ids; i++) dist[i] = DBL_MAX;
+
+    int row;
+    while ((row = atomic_fetch_add(&job->next_row, 1)) < job->n) {
+        int source = job->sources[row];
+        int remaining = job->distinct_targets;
+        dist[source] = 0;
+        graph_heap_push(heap, source, 0);
+
+        int u;
+        while (remaining > 0 && (u = graph_heap_pop(heap)) != -1) {
+            if (job->is_target[u]) remaining--;
+            for (int i = csr->offsets[u]; i < csr->offsets[u + 1]; i++) {
+                int v = csr->targets[i];
+                double candidate = dist[u] + csr->weights[i];
+                if (candidate >= dist[v]) continue;
+                dist[v] = candidate;
+                graph_heap_push(heap, v, candidate);
+            }
+        }
+
+        // Every target is settled, or the search ran out: either way its distance is final
+        double* out_row = job->out + (size_t)row * job->m;
+        for (int j = 0; j < job->m; j++) {
+            out_row[j] = dist[job->targets[j]];
+        }
+
+        for (int i = 0; i < heap->touched_count; i++) {
+            dist[heap->touched[i]] = DBL_MAX;
+        }
+        graph_heap_reset(heap);
+    }
+
+    graph_heap_destroy(heap);
+    free(dist);
+    return NULL;
+}
+
+/*
+ * Function: graph_distance_matrix
+ * -------------------------------
+ * Computes shortest distances from every source to every target with one
+ * early-stopping Dijkstra search per source, spread over one thread per
+ * online CPU. Threads take the next unclaimed source when they finish one,
+ * so uneven search sizes do not leave threads idle. Edge weights must be
+ * non-negative.
+ *
+ * graph: pointer to the graph structure
+ * sources: IDs of the source vertices
+ * n: number of sources
+ * targets: IDs of the target vertices (duplicates are allowed)
+ * m: number of targets
+ * out: receives n * m distances, row-major: out[i * m + j] is the distance
+ *      from sources[i] to targets[j], DBL_MAX if unreachable
+ *
+ * returns: 0 if successful, -1 if input is invalid or allocation fails
+ */
+int graph_distance_matrix(c_graph_t* graph, const int* sources, int n, const int* targets, int m, double* out) {
+    if (n < 0 || m < 0 || (n > 0 && !sources) || (m > 0 && !targets) || (n > 0 && m > 0 && !out)) return -1;
+    c_graph_csr_t* csr = graph_csr_get(graph, 0);
+    if (!csr) return -1;
+    if (n == 0 || m == 0) return 0;
+
+    for (int i = 0; i < n; i++) {
+        if (sources[i] < 0 || sources[i] >= csr->num_ids || !csr->present[sources[i]]) return -1;
+    }
+    unsigned char* is_target = (unsigned char*)calloc(csr->num_ids, sizeof(unsigned char));
+    if (!is_target) return -1;
+    int distinct = 0;
+    for (int j = 0; j < m; j++) {
+        int t = targets[j];
+        if (t < 0 || t >= csr->num_ids || !csr->present[t]) {
+            free(is_target);
+            return -1;
+        }
+        if (!is_target[t]) distinct++;
+        is_target[t] = 1;
+    }
+
+    matrix_job_t job;
+    job.csr = csr;
+    job.sources = sources;
+    job.n = n;
+    job.targets = targets;
+    job.m = m;
+    job.is_target = is_target;
+    job.distinct_targets = distinct;
+    job.out = out;
+    atomic_init(&job.next_row, 0);
+    atomic_init(&job.failed, 0);
+
+    int threads = graph_thread_count(0);
+    if (threads > n) threads = n;
+    pthread_t handles[threads];
+    int started[threads];
+    for (int t = 0; t < threads - 1; t++) {
+        started[t] = pthread_create(&handles[t], NULL, matrix_worker, &job) == 0;
+    }
+    matrix_worker(&job); // Rows left by threads that failed to start are picked up here
+    for (int t = 0; t < threads - 1; t++) {
+        if (started[t]) pthread_join(handles[t], NULL);
+    }
+
+    free(is_target);
+    // A worker that could not allocate claims no rows, but if all of them failed some rows are unfilled
+    return (atomic_load(&job.failed) && atomic_load(&job.next_row) < n) ? -1 : 0;
+}
@@ -0,0 +1,173 @@
+#include "eytzinger_index.h"
+#include "binary_search_tree_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EYTZINGER_ALIGNMENT 64
+#define EYTZINGER_PREFETCH_STRIDE 16 /* keys[16k] starts the block four levels below k */
+
+/*
+ * Function: eytzinger_fill
+ * ------------------------
+ * Assigns sorted values to BFS positions with an in-order walk of the
+ * implicit tree. Recursion depth is log2(n).
+ *
+ * keys: 1-based destination array
+ * values: sorted source values
+ * n: number of values
+ * next: index of the next unused value
+ * k: current BFS position
+ *
+ * returns: index of the next unused value after filling the subtree at k
+ */
+static int eytzinger_fill(int *keys, const int *values, int n, int next, long long k){
+    if (k > n) return next;
+
+    next = eytzinger_fill(keys, values, n, next, 2 * k);
+    keys[k] = values[next++];
+    return eytzinger_fill(keys, values, n, next, 2 * k + 1);
+}
+
+/*
+ * Function: create_index
+ * ----------------------
+ * Allocates an index for n keys with a cache-line-aligned key array.
+ *
+ * returns: pointer to the index, or NULL on allocation failure
+ */
+static EytzingerIndex *create_index(int n){
+    EytzingerIndex *index = malloc(sizeof(EytzingerIndex));
+    if (index == NULL) return NULL;
+
+    size_t bytes = sizeof(int) * ((size_t)n + 1);
+    bytes = (bytes + EYTZINGER_ALIGNMENT - 1) / EYTZINGER_ALIGNMENT * EYTZINGER_ALIGNMENT;
+    index->keys = aligned_alloc(EYTZINGER_ALIGNMENT, bytes);
+    if (index->keys == NULL){
+        free(index);
+        return NULL;
+    }
+    index->size = n;
+    return index;
+}
+
+/*
+ * Function: eytzinger_from_sorted
+ * -------------------------------
+ * Builds a read-only index from values in non-decreasing order.
+ *
+ * values: sorted values (duplicates allowed)
+ * n: number of values
+ *
+ * returns: pointer to the index, or NULL if the input is invalid or unsorted, or on allocation failure
+ */
+EytzingerIndex *eytzinger_from_sorted(const int *values, int n){
+    if (n < 0 || (n > 0 && values == NULL)) return NULL;
+    for (int i = 1; i < n; i++){
+        if (values[i - 1] > values[i]) return NULL;
+    }
+
+    EytzingerIndex *index = create_index(n);
+    if (index == NULL) return NULL;
+
+    index->keys[0] = 0; /* Unused slot */
+    eytzinger_fill(index->keys, values, n, 0, 1);
+    return index;
+}
+
+/*
+ * Function: bst_freeze
+ * --------------------
+ * Converts a tree into a read-only index holding the same values. The tree is
+ * flattened in order without recursion and left unchanged.
+ *
+ * root: pointer to the root node (may be NULL for an empty index)
+ *
+ * returns: pointer to the index, or NULL on allocation failure
+ */
+EytzingerIndex *bst_freeze(Node *root){
+    int n = (root == NULL) ? 0 : root->size;
+    int *sorted = malloc(sizeof(int) * ((size_t)n + 1));
+    if (sorted == NULL) return NULL;
+
+    bst_flatten(root, sorted);
+    EytzingerIndex *index = eytzinger_from_sorted(sorted, n);
+    free(sorted);
+    return index;
+}
+
+/*
+ * Function: destroy_eytzinger_index
+ * ---------------------------------
+ * Frees the index.
+ *
+ * index: pointer to the EytzingerIndex to destroy
+ *
+ * returns: void
+ */
+void destroy_eytzinger_index(EytzingerIndex *index){
+    if (index == NULL) return;
+    free(index->keys);
+    free(index);
+}
+
+/*
+ * Function: lower_bound_position
+ * ------------------------------
+ * Branchless descent: each step moves to child 2k or 2k + 1 based on a
+ * comparison result instead of a branch, and prefetches the cache line that
+ * holds the position four levels down. When the walk falls off the tree, the
+ * trailing ones of k are the right turns taken after the last left turn;
+ * shifting them and one more bit away recovers the last node where the search
+ * went left, i.e. the first key >= target.
+ *
+ * returns: BFS position of the first key >= target, or 0 if there is none
+ */
+static inline long long lower_bound_position(const EytzingerIndex *index, int target){
+    const int *keys = index->keys;
+    long long n = index->size;
+    long long k = 1;
+
+    while (k <= n){
+        __builtin_prefetch(keys + k * EYTZINGER_PREFETCH_STRIDE);
+        k = 2 * k + (keys[k] < target);
+    }
+    return k >> __builtin_ffsll(~k);
+}
+
+/*
+ * Function: eytzinger_search
+ * --------------------------
+ * Checks whether a value is in the index.
+ *
+ * index: pointer to the EytzingerIndex
+ * target: value to search for
+ *
+ * returns: 1 if found, 0 otherwise
+ */
+int eytzinger_search(EytzingerIndex *index, int target){
+    if (index == NULL) return 0;
+
+    long long k = lower_bound_position(index, target);
+    return (k != 0 && index->keys[k] == target) ? 1 : 0;
+}
+
+/*
+ * Function: eytzinger_lower_bound
+ * -------------------------------
+ * Finds the smallest value >= target.
+ *
+ * index: pointer to the EytzingerIndex
+ * target: lower bound
+ * value: receives the value if one exists (may be NULL)
+ *
+ * returns: 1 if such a value exists, 0 otherwise
+ */
+int eytzinger_lower_bound(EytzingerIndex *index, int target, int *value){
+    if (index == NULL) return 0;
+
+    long long k = lower_bound_position(index, target);
+    if (k == 0) return 0;
+    if (value != NULL) *value = index->keys[k];
+    return 1;
+}
@@ -16,6 +16,9 @@ c_graph_t* graph_create(int directed) {
     if (graph) {
         graph->directed = directed;
         graph->vertices = NULL;  // Initialize vertex list as empty
+        graph->csr[0] = NULL;
+        graph->csr[1] = NULL;
+        pthread_mutex_init(&graph->csr_lock, NULL);
     }
     return graph;
 }
@@ -50,6 +53,7 @@ int graph_add_vertex(c_graph_t* graph, int id) {
     new_vertex->edges = NULL;  // Initialize edge list as empty
     new_vertex->next = graph->vertices;  // Insert at the beginning
     graph->vertices = new_vertex;
+    graph_csr_invalidate(graph);
 
     return 0;
 }
@@ -75,6 +79,7 @@ int graph_remove_vertex(c_graph_t* graph, int id) {
     }
 
     if (!curr_vertex) return -1; // Vertex not found
+    graph_csr_invalidate(graph);
 
     // Remove vertex from linked list
     if (prev_vertex) {
@@ -122,6 +127,7 @@ int graph_remove_edge(c_graph_t* graph, int src_id, int dest_id) {
         src_vertex = src_vertex->next;
     }
     if (!src_vertex) return -1;
+    graph_csr_invalidate(graph);
 
     // Remove edge from source to destination
     c_graph_edge_t* prev_edge = NULL;
@@ -190,6 +196,8 @@ void graph_destroy(c_graph_t* graph) {
         current_vertex = current_vertex->next;
         free(temp_vertex);
     }
+    graph_csr_invalidate(graph);
+    pthread_mutex_destroy(&graph->csr_lock);
     free(graph);
 }
 
@@ -220,6 +228,7 @@ int graph_add_edge(c_graph_t* graph, int src_id, int dest_id, double weight) {
         current = current->next;
     }
     if (!src_vertex || !dest_vertex) return -1;
+    graph_csr_invalidate(graph);
 
     // Add edge from source to destination
     c_graph_edge_t* new_edge = (c_graph_edge_t*)malloc(sizeof(c_graph_edge_t));
@@ -0,0 +1,229 @@
+#include "c_graph_internal.h"
+#include "c_graph.h"
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <unistd.h>
+
+_Thread_local long long graph_settled_count = 0;
+
+/*
+ * Function: graph_csr_build
+ * -------------------------
+ * Copies the adjacency lists of a graph into flat arrays indexed by vertex
+ * id, so searches can scan a vertex's edges without chasing list pointers
+ * or looking the vertex up by id. Vertices with negative ids are skipped.
+ *
+ * graph: pointer to the graph structure
+ * reverse: 0 to store each edge at its source, 1 to store it at its destination
+ *          (the reverse graph; identical to the forward one for undirected graphs)
+ *
+ * returns: pointer to the CSR snapshot, or NULL if the graph is NULL or empty or allocation fails
+ */
+c_graph_csr_t* graph_csr_build(c_graph_t* graph, int reverse) {
+    if (!graph) return NULL;
+
+    int max_id = -1;
+    int num_edges = 0;
+    for (c_graph_vertex_t* v = graph->vertices; v; v = v->next) {
+        if (v->id > max_id) max_id = v->id;
+        for (c_graph_edge_t* e = v->edges; e; e = e->next) num_edges++;
+    }
+    if (max_id < 0) return NULL;
+
+    c_graph_csr_t* csr = (c_graph_csr_t*)malloc(sizeof(c_graph_csr_t));
+    if (!csr) return NULL;
+    csr->num_ids = max_id + 1;
+    csr->num_edges = 0;
+    csr->offsets = (int*)calloc(max_id + 2, sizeof(int));
+    csr->targets = (int*)malloc((num_edges + 1) * sizeof(int));
+    csr->weights = (double*)malloc((num_edges + 1) * sizeof(double));
+    csr->present = (unsigned char*)calloc(max_id + 1, sizeof(unsigned char));
+    if (!csr->offsets || !csr->targets || !csr->weights || !csr->present) {
+        graph_csr_destroy(csr);
+        return NULL;
+    }
+
+    // Count edges per row, then turn the counts into row start offsets
+    for (c_graph_vertex_t* v = graph->vertices; v; v = v->next) {
+        if (v->id < 0) continue;
+        csr->present[v->id] = 1;
+        for (c_graph_edge_t* e = v->edges; e; e = e->next) {
+            if (e->dest_id < 0) continue;
+            csr->offsets[(reverse ? e->dest_id : v->id) + 1]++;
+        }
+    }
+    for (int i = 0; i < csr->num_ids; i++) {
+        csr->offsets[i + 1] += csr->offsets[i];
+    }
+    csr->num_edges = csr->offsets[csr->num_ids];
+
+    // Fill each row through a moving cursor
+    int* cursor = (int*)malloc(csr->num_ids * sizeof(int));
+    if (!cursor) {
+        graph_csr_destroy(csr);
+        return NULL;
+    }
+    memcpy(cursor, csr->offsets, csr->num_ids * sizeof(int));
+    for (c_graph_vertex_t* v = graph->vertices; v; v = v->next) {
+        if (v->id < 0) continue;
+        for (c_graph_edge_t* e = v->edges; e; e = e->next) {
+            if (e->dest_id < 0) continue;
+            int row = reverse ? e->dest_id : v->id;
+            int slot = cursor[row]++;
+            csr->targets[slot] = reverse ? v->id : e->dest_id;
+            csr->weights[slot] = e->weight;
+        }
+    }
+    free(cursor);
+
+    return csr;
+}
+
+/*
+ * Function: graph_csr_destroy
+ * ---------------------------
+ * Frees a CSR snapshot.
+ *
+ * csr: pointer to the snapshot
+ *
+ * returns: void
+ */
+void graph_csr_destroy(c_graph_csr_t* csr) {
+    if (!csr) return;
+    free(csr->offsets);
+    free(csr->targets);
+    free(csr->weights);
+    free(csr->present);
+    free(csr);
+}
+
+/*
+ * Function: graph_csr_get
+ * -----------------------
+ * Returns the cached CSR view of a graph, building it on first use. The
+ * cache is dropped by any change to the graph, so repeated queries on an
+ * unchanged graph pay for the conversion once. Safe to call from several
+ * threads at once as long as nobody modifies the graph.
+ *
+ * graph: pointer to the graph structure
+ * reverse: 1 for the reverse graph (the forward view is shared for undirected graphs)
+ *
+ * returns: pointer to the CSR view owned by the graph, or NULL if the graph is empty or allocation fails
+ */
+c_graph_csr_t* graph_csr_get(c_graph_t* graph, int reverse) {
+    if (!graph) return NULL;
+    int slot = (reverse && graph->directed) ? 1 : 0;
+
+    pthread_mutex_lock(&graph->csr_lock);
+    if (!graph->csr[slot]) {
+        graph->csr[slot] = graph_csr_build(graph, slot);
+    }
+    c_graph_csr_t* csr = graph->csr[slot];
+    pthread_mutex_unlock(&graph->csr_lock);
+    return csr;
+}
+
+/*
+ * Function: graph_csr_invalidate
+ * ------------------------------
+ * Frees the cached CSR views of a graph. Called by every function that
+ * changes vertices or edges.
+ *
+ * graph: pointer to the graph structure
+ *
+ * returns: void
+ */
+void graph_csr_invalidate(c_graph_t* graph) {
+    for (int slot = 0; slot < 2; slot++) {
+        graph_csr_destroy(graph->csr[slot]);
+        graph->csr[slot] = NULL;
+    }
+}
+
+/*
+ * Function: graph_path_from_parents
+ * ---------------------------------
+ * Builds a start-to-end path by following parent links back from end_id
+ * until a vertex with parent -1 (the start) is reached.
+ *
+ * parent: predecessor of each vertex id, -1 for the start
+ * end_id: ID of the last vertex of the path
+ * path_len: pointer to an integer to store the length of the path
+ *
+ * returns: array of vertex IDs from start to end_id, or NULL if allocation fails
+ */
+int* graph_path_from_parents(const int* parent, int end_id, int* path_len) {
+    int count = 0;
+    for (int current = end_id; current != -1; current = parent[current]) {
+        count++;
+    }
+
+    int* path = (int*)malloc(count * sizeof(int));
+    if (!path) {
+        *path_len = 0;
+        return NULL;
+    }
+
+    int current = end_id;
+    for (int i = count - 1; i >= 0; i--) {
+        path[i] = current;
+        current = parent[current];
+    }
+    *path_len = count;
+    return path;
+}
+
+/*
+ * Function: graph_csr_dijkstra
+ * ----------------------------
+ * Heap-based single-source Dijkstra over a CSR view that settles every
+ * reachable vertex. The heap is reset first, so a workspace can be reused.
+ *
+ * csr: CSR view to search
+ * heap: heap with capacity csr->num_ids
+ * source: ID of the source vertex
+ * dist: receives the distance to every id, DBL_MAX if unreachable
+ * parent: receives the predecessor of every id, -1 for the source and unreachable ids (may be NULL)
+ *
+ * returns: void
+ */
+void graph_csr_dijkstra(const c_graph_csr_t* csr, c_graph_heap_t* heap, int source, double* dist, int* parent) {
+    for (int i = 0; i < csr->num_ids; i++) {
+        dist[i] = DBL_MAX;
+        if (parent) parent[i] = -1;
+    }
+
+    graph_heap_reset(heap);
+    dist[source] = 0;
+    graph_heap_push(heap, source, 0);
+
+    int u;
+    while ((u = graph_heap_pop(heap)) != -1) {
+        graph_settled_count++;
+        for (int i = csr->offsets[u]; i < csr->offsets[u + 1]; i++) {
+            int v = csr->targets[i];
+            double candidate = dist[u] + csr->weights[i];
+            if (candidate >= dist[v]) continue;
+
+            dist[v] = candidate;
+            if (parent) parent[v] = u;
+            graph_heap_push(heap, v, candidate);
+        }
+    }
+}
+
+/*
+ * Function: graph_thread_count
+ * ----------------------------
+ * Resolves the thread count argument of the parallel graph algorithms.
+ *
+ * threads: requested number of threads, <= 0 for one per online CPU
+ *
+ * returns: number of threads to use, at least 1
+ */
+int graph_thread_count(int threads) {
+    if (threads > 0) return threads;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cpus > 0) ? (int)cpus : 1;
+}
@@ -0,0 +1,173 @@
+#include "c_graph_internal.h"
+#include <stdlib.h>
+#include <float.h>
+
+/*
+ * Function: graph_heap_create
+ * ---------------------------
+ * Allocates an empty heap for vertex ids in [0, capacity).
+ *
+ * capacity: number of vertex ids
+ *
+ * returns: pointer to the heap, or NULL if allocation fails
+ */
+c_graph_heap_t* graph_heap_create(int capacity) {
+    if (capacity <= 0) return NULL;
+
+    c_graph_heap_t* heap = (c_graph_heap_t*)malloc(sizeof(c_graph_heap_t));
+    if (!heap) return NULL;
+    heap->ids = (int*)malloc(capacity * sizeof(int));
+    heap->keys = (double*)malloc(capacity * sizeof(double));
+    heap->position = (int*)malloc(capacity * sizeof(int));
+    heap->touched = (int*)malloc(capacity * sizeof(int));
+    if (!heap->ids || !heap->keys || !heap->position || !heap->touched) {
+        graph_heap_destroy(heap);
+        return NULL;
+    }
+
+    for (int i = 0; i < capacity; i++) {
+        heap->position[i] = GRAPH_HEAP_NEW;
+    }
+    heap->size = 0;
+    heap->touched_count = 0;
+    heap->capacity = capacity;
+    return heap;
+}
+
+/*
+ * Function: graph_heap_destroy
+ * ----------------------------
+ * Frees the heap.
+ *
+ * heap: pointer to the heap
+ *
+ * returns: void
+ */
+void graph_heap_destroy(c_graph_heap_t* heap) {
+    if (!heap) return;
+    free(heap->ids);
+    free(heap->keys);
+    free(heap->position);
+    free(heap->touched);
+    free(heap);
+}
+
+/*
+ * Function: graph_heap_reset
+ * --------------------------
+ * Empties the heap for another search. Only the ids pushed since the last
+ * reset are visited, so a search that stopped early is cheap to undo.
+ *
+ * heap: pointer to the heap
+ *
+ * returns: void
+ */
+void graph_heap_reset(c_graph_heap_t* heap) {
+    for (int i = 0; i < heap->touched_count; i++) {
+        heap->position[heap->touched[i]] = GRAPH_HEAP_NEW;
+    }
+    heap->size = 0;
+    heap->touched_count = 0;
+}
+
+/* Places id at slot and records the slot */
+static void heap_place(c_graph_heap_t* heap, int slot, int id) {
+    heap->ids[slot] = id;
+    heap->position[id] = slot;
+}
+
+/* Moves the id at slot up until its parent's key is not larger */
+static void sift_up(c_graph_heap_t* heap, int slot) {
+    int id = heap->ids[slot];
+    double key = heap->keys[id];
+    while (slot > 0) {
+        int parent = (slot - 1) / 2;
+        if (heap->keys[heap->ids[parent]] <= key) break;
+        heap_place(heap, slot, heap->ids[parent]);
+        slot = parent;
+    }
+    heap_place(heap, slot, id);
+}
+
+/* Moves the id at slot down until neither child has a smaller key */
+static void sift_down(c_graph_heap_t* heap, int slot) {
+    int id = heap->ids[slot];
+    double key = heap->keys[id];
+    while (1) {
+        int child = 2 * slot + 1;
+        if (child >= heap->size) break;
+        if (child + 1 < heap->size && heap->keys[heap->ids[child + 1]] < heap->keys[heap->ids[child]]) {
+            child++;
+        }
+        if (heap->keys[heap->ids[child]] >= key) break;
+        heap_place(heap, slot, heap->ids[child]);
+        slot = child;
+    }
+    heap_place(heap, slot, id);
+}
+
+/*
+ * Function: graph_heap_push
+ * -------------------------
+ * Inserts id with key, or lowers its key if it is already queued with a
+ * larger one. A settled id is queued again; searches with non-negative
+ * weights never do that, but A* with an inconsistent heuristic reopens
+ * vertices this way.
+ *
+ * heap: pointer to the heap
+ * id: vertex id in [0, capacity)
+ * key: tentative distance
+ *
+ * returns: 1 if the id was inserted or its key lowered, 0 otherwise
+ */
+int graph_heap_push(c_graph_heap_t* heap, int id, double key) {
+    int slot = heap->position[id];
+
+    if (slot < 0) {
+        if (slot == GRAPH_HEAP_NEW) heap->touched[heap->touched_count++] = id;
+        heap->keys[id] = key;
+        heap->ids[heap->size] = id;
+        sift_up(heap, heap->size++);
+        return 1;
+    }
+
+    if (key >= heap->keys[id]) return 0;
+    heap->keys[id] = key;
+    sift_up(heap, slot);
+    return 1;
+}
+
+/*
+ * Function: graph_heap_pop
+ * ------------------------
+ * Removes the id with the smallest key and marks it settled.
+ *
+ * heap: pointer to the heap
+ *
+ * returns: the id, or -1 if the heap is empty
+ */
+int graph_heap_pop(c_graph_heap_t* heap) {
+    if (heap->size == 0) return -1;
+
+    int id = heap->ids[0];
+    heap->position[id] = GRAPH_HEAP_SETTLED;
+    heap->size--;
+    if (heap->size > 0) {
+        heap->ids[0] = heap->ids[heap->size];
+        sift_down(heap, 0);
+    }
+    return id;
+}
+
+/*
+ * Function: graph_heap_min_key
+ * ----------------------------
+ * Returns the smallest queued key.
+ *
+ * heap: pointer to the heap
+ *
+ * returns: the key, or DBL_MAX if the heap is empty
+ */
+double graph_heap_min_key(const c_graph_heap_t* heap) {
+    return (heap->size == 0) ? DBL_MAX : heap->keys[heap->ids[0]];
+}
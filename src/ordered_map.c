@@ -0,0 +1,322 @@
+#include "ordered_map.h"
+#include "avl_tree_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Nodes extend AvlNode, so casting between the two is valid; avl.value holds the key */
+#define MAP_NODE(node) ((OrderedMapNode *)(node))
+#define KEY(node) ((node)->avl.value)
+#define LEFT(node) MAP_NODE((node)->avl.left)
+#define RIGHT(node) MAP_NODE((node)->avl.right)
+
+/* Frees a subtree, handing each value to free_value if given */
+static void destroy_nodes(OrderedMapNode *root, ordered_map_free_fn free_value){
+    if (root == NULL) return;
+
+    destroy_nodes(LEFT(root), free_value);
+    destroy_nodes(RIGHT(root), free_value);
+    if (free_value != NULL) free_value(root->value);
+    free(root);
+}
+
+/*
+ * Function: create_ordered_map
+ * ----------------------------
+ * Creates an empty map.
+ *
+ * multiset: nonzero to count repeated puts of a key instead of replacing it
+ *
+ * returns: pointer to the map, or NULL on allocation failure
+ */
+OrderedMap *create_ordered_map(int multiset){
+    OrderedMap *map = malloc(sizeof(OrderedMap));
+    if (map == NULL) return NULL;
+
+    map->root = NULL;
+    map->size = 0;
+    map->total = 0;
+    map->multiset = multiset ? 1 : 0;
+    return map;
+}
+
+/*
+ * Function: destroy_ordered_map
+ * -----------------------------
+ * Frees all nodes, then the map. Recursion depth is bounded by the tree
+ * height.
+ *
+ * map: pointer to the OrderedMap to destroy
+ * free_value: called on every stored value (may be NULL if values are not owned by the map)
+ *
+ * returns: void
+ */
+void destroy_ordered_map(OrderedMap *map, ordered_map_free_fn free_value){
+    if (map == NULL) return;
+    destroy_nodes(map->root, free_value);
+    free(map);
+}
+
+/*
+ * Function: put_rec
+ * -----------------
+ * Recursive insert. An existing key is updated in place, which never changes
+ * the shape of the tree, so only a new node triggers rebalancing.
+ *
+ * old_value: receives the replaced value of an existing key
+ * status: set to 1 if a node was added, 0 if an existing key was updated, -1 on allocation failure
+ *
+ * returns: new root of the subtree
+ */
+static OrderedMapNode *put_rec(OrderedMap *map, OrderedMapNode *root, int key, void *value, void **old_value,
+                               int *status){
+    if (root == NULL){
+        OrderedMapNode *node = malloc(sizeof(OrderedMapNode));
+        if (node == NULL){
+            *status = -1;
+            return NULL;
+        }
+        KEY(node) = key;
+        node->avl.height = 1;
+        node->avl.left = NULL;
+        node->avl.right = NULL;
+        node->count = 1;
+        node->value = value;
+        *status = 1;
+        return node;
+    }
+
+    if (key == KEY(root)){
+        if (map->multiset) root->count++;
+        *old_value = root->value;
+        root->value = value;
+        *status = 0;
+        return root;
+    }
+
+    if (key < KEY(root))
+        root->avl.left = (AvlNode *)put_rec(map, LEFT(root), key, value, old_value, status);
+    else
+        root->avl.right = (AvlNode *)put_rec(map, RIGHT(root), key, value, old_value, status);
+
+    if (*status != 1) return root;
+    return MAP_NODE(avl_rebalance(&root->avl));
+}
+
+/*
+ * Function: ordered_map_put
+ * -------------------------
+ * Associates value with key. In map mode an existing value is replaced; in
+ * multiset mode the key's count is incremented and the value replaced. The
+ * replaced value is handed back so the caller can release it.
+ *
+ * map: pointer to the OrderedMap
+ * key: key to insert
+ * value: payload to store (not copied)
+ * old_value: receives the replaced value, or NULL if the key was new (may be NULL)
+ *
+ * returns: 1 if the key was new, 0 if it already existed, -1 on failure
+ */
+int ordered_map_put(OrderedMap *map, int key, void *value, void **old_value){
+    if (map == NULL) return -1;
+
+    int status = 0;
+    void *replaced = NULL;
+    map->root = put_rec(map, map->root, key, value, &replaced, &status);
+    if (old_value != NULL) *old_value = replaced;
+    if (status == -1) return -1;
+
+    if (status == 1) map->size++;
+    if (status == 1 || map->multiset) map->total++;
+    return status;
+}
+
+/*
+ * Function: ordered_map_find
+ * --------------------------
+ * Looks up the node for a key.
+ *
+ * map: pointer to the OrderedMap
+ * key: key to look up
+ *
+ * returns: pointer to the node, or NULL if not found
+ */
+OrderedMapNode *ordered_map_find(OrderedMap *map, int key){
+    if (map == NULL) return NULL;
+
+    OrderedMapNode *current = map->root;
+    while (current != NULL && KEY(current) != key){
+        current = (key < KEY(current)) ? LEFT(current) : RIGHT(current);
+    }
+    return current;
+}
+
+/*
+ * Function: ordered_map_get
+ * -------------------------
+ * Looks up the value for a key. Use ordered_map_find to tell a missing key
+ * from a stored NULL value.
+ *
+ * map: pointer to the OrderedMap
+ * key: key to look up
+ *
+ * returns: the stored value, or NULL if not found
+ */
+void *ordered_map_get(OrderedMap *map, int key){
+    OrderedMapNode *node = ordered_map_find(map, key);
+    return (node == NULL) ? NULL : node->value;
+}
+
+/*
+ * Function: ordered_map_count
+ * ---------------------------
+ * Returns how many times a key is stored.
+ *
+ * map: pointer to the OrderedMap
+ * key: key to look up
+ *
+ * returns: number of occurrences, 0 if not found
+ */
+long long ordered_map_count(OrderedMap *map, int key){
+    OrderedMapNode *node = ordered_map_find(map, key);
+    return (node == NULL) ? 0 : node->count;
+}
+
+/*
+ * Function: remove_rec
+ * --------------------
+ * Recursive delete of the node holding key; the node is freed and its value
+ * returned through removed.
+ *
+ * returns: new root of the subtree
+ */
+static OrderedMapNode *remove_rec(OrderedMapNode *root, int key, int *deleted, void **removed){
+    if (root == NULL) return NULL;
+
+    if (key < KEY(root))
+        root->avl.left = (AvlNode *)remove_rec(LEFT(root), key, deleted, removed);
+    else if (key > KEY(root))
+        root->avl.right = (AvlNode *)remove_rec(RIGHT(root), key, deleted, removed);
+    else{
+        AvlNode *replacement;
+        if (root->avl.left == NULL)
+            replacement = root->avl.right;
+        else if (root->avl.right == NULL)
+            replacement = root->avl.left;
+        else{
+            /* Two children: the in-order successor takes this node's place */
+            AvlNode *rest = avl_remove_min(root->avl.right, &replacement);
+            replacement->right = rest;
+            replacement->left = root->avl.left;
+            replacement = avl_rebalance(replacement);
+        }
+        *deleted = 1;
+        *removed = root->value;
+        free(root);
+        return MAP_NODE(replacement);
+    }
+
+    if (!*deleted) return root;
+    return MAP_NODE(avl_rebalance(&root->avl));
+}
+
+/*
+ * Function: ordered_map_remove
+ * ----------------------------
+ * Removes a key. In multiset mode one occurrence is removed, and the node only
+ * once its count reaches zero.
+ *
+ * map: pointer to the OrderedMap
+ * key: key to remove
+ * value: receives the value of a removed node (may be NULL); untouched if the node stays
+ *
+ * returns: 1 if an occurrence was removed, 0 if not found
+ */
+int ordered_map_remove(OrderedMap *map, int key, void **value){
+    if (map == NULL) return 0;
+
+    OrderedMapNode *node = ordered_map_find(map, key);
+    if (node == NULL) return 0;
+
+    map->total--;
+    if (node->count > 1){
+        node->count--;
+        return 1;
+    }
+
+    int deleted = 0;
+    void *removed = NULL;
+    map->root = remove_rec(map->root, key, &deleted, &removed);
+    map->size--;
+    if (value != NULL) *value = removed;
+    return 1;
+}
+
+/*
+ * Function: ordered_map_size
+ * --------------------------
+ * Returns the number of distinct keys, i.e. the number of nodes.
+ *
+ * map: pointer to the OrderedMap
+ *
+ * returns: number of keys, or -1 if map is NULL
+ */
+long long ordered_map_size(OrderedMap *map){
+    if (map == NULL) return -1;
+    return map->size;
+}
+
+/*
+ * Function: ordered_map_total
+ * ---------------------------
+ * Returns the number of stored occurrences; equal to the size in map mode.
+ *
+ * map: pointer to the OrderedMap
+ *
+ * returns: sum of all counts, or -1 if map is NULL
+ */
+long long ordered_map_total(OrderedMap *map){
+    if (map == NULL) return -1;
+    return map->total;
+}
+
+/* In-order walk of the keys in [low, high], skipping subtrees outside the range */
+static long long range_rec(OrderedMapNode *root, int low, int high, ordered_map_visit_fn visit, void *context){
+    long long visited = 0;
+
+    while (root != NULL){
+        if (KEY(root) < low){
+            root = RIGHT(root);
+            continue;
+        }
+        if (KEY(root) > high){
+            root = LEFT(root);
+            continue;
+        }
+
+        visited += range_rec(LEFT(root), low, high, visit, context);
+        if (visit != NULL) visit(KEY(root), root->value, root->count, context);
+        visited++;
+        root = RIGHT(root);
+    }
+    return visited;
+}
+
+/*
+ * Function: ordered_map_range
+ * ---------------------------
+ * Visits every key in [low, high] in ascending order, once per node with its
+ * count.
+ *
+ * map: pointer to the OrderedMap
+ * low: smallest key to visit
+ * high: largest key to visit
+ * visit: called with each key, value, count and context (may be NULL to only count)
+ * context: passed through to visit
+ *
+ * returns: number of keys visited, or -1 if map is NULL
+ */
+long long ordered_map_range(OrderedMap *map, int low, int high, ordered_map_visit_fn visit, void *context){
+    if (map == NULL) return -1;
+    if (low > high) return 0;
+    return range_rec(map->root, low, high, visit, context);
+}
@@ -0,0 +1,380 @@
+#include "persistent_tree.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * Nodes are never modified once published. Every function below that takes a
+ * subtree by "reference" consumes one reference the caller already holds; a
+ * function that only borrows a subtree retains it before storing it in a new
+ * node. On allocation failure every consumed reference is released, so no
+ * partial path copy is ever leaked and the source version is untouched.
+ */
+
+/* Adds a reference to a shared subtree */
+static PersistentNode *retain(PersistentNode *node){
+    if (node != NULL) atomic_fetch_add_explicit(&node->refs, 1, memory_order_relaxed);
+    return node;
+}
+
+/*
+ * Function: release
+ * -----------------
+ * Drops one reference and frees the node once nothing points at it. Only the
+ * nodes unique to the dropped version are visited, and recursion depth is
+ * bounded by the tree height.
+ *
+ * node: node to release (may be NULL)
+ */
+static void release(PersistentNode *node){
+    while (node != NULL){
+        if (atomic_fetch_sub_explicit(&node->refs, 1, memory_order_acq_rel) != 1) return;
+
+        PersistentNode *left = node->left;
+        PersistentNode *right = node->right;
+        free(node);
+        release(left);
+        node = right; /* Tail position: loop instead of recursing */
+    }
+}
+
+static int height(PersistentNode *node){
+    return (node == NULL) ? 0 : node->height;
+}
+
+/*
+ * Function: make_node
+ * -------------------
+ * Allocates a node that takes over the caller's references to left and right.
+ *
+ * returns: the new node with one reference, or NULL on allocation failure (left and right are released)
+ */
+static PersistentNode *make_node(int value, PersistentNode *left, PersistentNode *right){
+    PersistentNode *node = malloc(sizeof(PersistentNode));
+    if (node == NULL){
+        release(left);
+        release(right);
+        return NULL;
+    }
+
+    int lh = height(left);
+    int rh = height(right);
+    node->value = value;
+    node->height = 1 + ((lh > rh) ? lh : rh);
+    atomic_init(&node->refs, 1);
+    node->left = left;
+    node->right = right;
+    return node;
+}
+
+/*
+ * Function: make_balanced
+ * -----------------------
+ * Like make_node, but restores the AVL invariant when the children's heights
+ * differ by two. Rotations copy the nodes they touch instead of relinking them,
+ * since the originals may be shared with other versions.
+ *
+ * returns: root of the balanced subtree, or NULL on allocation failure (left and right are released)
+ */
+static PersistentNode *make_balanced(int value, PersistentNode *left, PersistentNode *right){
+    int lh = height(left);
+    int rh = height(right);
+
+    if (lh > rh + 1){
+        PersistentNode *pivot = left;
+        PersistentNode *result;
+
+        if (height(pivot->left) >= height(pivot->right)){
+            /* Single right rotation */
+            PersistentNode *lower = make_node(value, retain(pivot->right), right);
+            result = (lower == NULL) ? NULL : make_node(pivot->value, retain(pivot->left), lower);
+        }
+        else{
+            /* Left-right: pivot->right becomes the subtree root */
+            PersistentNode *inner = pivot->right;
+            PersistentNode *lower_right = make_node(value, retain(inner->right), right);
+            PersistentNode *lower_left = make_node(pivot->value, retain(pivot->left), retain(inner->left));
+            if (lower_left == NULL || lower_right == NULL){
+                release(lower_left);
+                release(lower_right);
+                result = NULL;
+            }
+            else
+                result = make_node(inner->value, lower_left, lower_right);
+        }
+
+        release(pivot);
+        return result;
+    }
+
+    if (rh > lh + 1){
+        PersistentNode *pivot = right;
+        PersistentNode *result;
+
+        if (height(pivot->right) >= height(pivot->left)){
+            /* Single left rotation */
+            PersistentNode *lower = make_node(value, left, retain(pivot->left));
+            result = (lower == NULL) ? NULL : make_node(pivot->value, lower, retain(pivot->right));
+        }
+        else{
+            /* Right-left: pivot->left becomes the subtree root */
+            PersistentNode *inner = pivot->left;
+            PersistentNode *lower_left = make_node(value, left, retain(inner->left));
+            PersistentNode *lower_right = make_node(pivot->value, retain(inner->right), retain(pivot->right));
+            if (lower_left == NULL || lower_right == NULL){
+                release(lower_left);
+                release(lower_right);
+                result = NULL;
+            }
+            else
+                result = make_node(inner->value, lower_left, lower_right);
+        }
+
+        release(pivot);
+        return result;
+    }
+
+    return make_node(value, left, right);
+}
+
+/*
+ * Function: insert_node
+ * ---------------------
+ * Copies the search path for value and returns the root of the new subtree.
+ * Duplicates go to the right, as in avl_insert.
+ *
+ * node: borrowed root of the source subtree
+ *
+ * returns: new subtree root with one reference, or NULL on allocation failure
+ */
+static PersistentNode *insert_node(PersistentNode *node, int value){
+    if (node == NULL) return make_node(value, NULL, NULL);
+
+    if (value < node->value){
+        PersistentNode *left = insert_node(node->left, value);
+        if (left == NULL) return NULL;
+        return make_balanced(node->value, left, retain(node->right));
+    }
+
+    PersistentNode *right = insert_node(node->right, value);
+    if (right == NULL) return NULL;
+    return make_balanced(node->value, retain(node->left), right);
+}
+
+/*
+ * Function: remove_min
+ * --------------------
+ * Copies the path to the smallest value of a non-empty subtree without it.
+ *
+ * node: borrowed root of the source subtree
+ * out: receives the new subtree root (NULL if it became empty)
+ * min: receives the removed value
+ *
+ * returns: 1 if successful, -1 on allocation failure
+ */
+static int remove_min(PersistentNode *node, PersistentNode **out, int *min){
+    if (node->left == NULL){
+        *min = node->value;
+        *out = retain(node->right);
+        return 1;
+    }
+
+    PersistentNode *left;
+    if (remove_min(node->left, &left, min) != 1) return -1;
+    *out = make_balanced(node->value, left, retain(node->right));
+    return (*out == NULL) ? -1 : 1;
+}
+
+/*
+ * Function: delete_node
+ * ---------------------
+ * Copies the search path for target and returns the new subtree without one
+ * occurrence of it.
+ *
+ * node: borrowed root of the source subtree
+ * out: receives the new subtree root (NULL if it became empty)
+ *
+ * returns: 1 if deleted, 0 if not found (out is not set), -1 on allocation failure
+ */
+static int delete_node(PersistentNode *node, int target, PersistentNode **out){
+    if (node == NULL) return 0;
+
+    if (target < node->value){
+        PersistentNode *left;
+        int status = delete_node(node->left, target, &left);
+        if (status != 1) return status;
+        *out = make_balanced(node->value, left, retain(node->right));
+        return (*out == NULL) ? -1 : 1;
+    }
+    if (target > node->value){
+        PersistentNode *right;
+        int status = delete_node(node->right, target, &right);
+        if (status != 1) return status;
+        *out = make_balanced(node->value, retain(node->left), right);
+        return (*out == NULL) ? -1 : 1;
+    }
+
+    if (node->left == NULL){
+        *out = retain(node->right);
+        return 1;
+    }
+    if (node->right == NULL){
+        *out = retain(node->left);
+        return 1;
+    }
+
+    /* Two children: the successor takes this node's place */
+    PersistentNode *right;
+    int successor;
+    if (remove_min(node->right, &right, &successor) != 1) return -1;
+    *out = make_balanced(successor, retain(node->left), right);
+    return (*out == NULL) ? -1 : 1;
+}
+
+/* Wraps a root the caller holds a reference to in a version handle */
+static PersistentTree *make_version(PersistentNode *root, long long size){
+    PersistentTree *version = malloc(sizeof(PersistentTree));
+    if (version == NULL){
+        release(root);
+        return NULL;
+    }
+    version->root = root;
+    version->size = size;
+    return version;
+}
+
+/*
+ * Function: create_persistent_tree
+ * --------------------------------
+ * Creates an empty version.
+ *
+ * returns: pointer to the version, or NULL on allocation failure
+ */
+PersistentTree *create_persistent_tree(void){
+    return make_version(NULL, 0);
+}
+
+/*
+ * Function: destroy_persistent_tree
+ * ---------------------------------
+ * Releases a version. Nodes still shared with other versions are kept; only
+ * the ones unique to this version are freed. Versions may be destroyed from
+ * any thread.
+ *
+ * version: pointer to the version to destroy
+ *
+ * returns: void
+ */
+void destroy_persistent_tree(PersistentTree *version){
+    if (version == NULL) return;
+    release(version->root);
+    free(version);
+}
+
+/*
+ * Function: persistent_snapshot
+ * -----------------------------
+ * Takes an O(1) snapshot of a version: the new handle shares the whole tree
+ * and stays valid after the source is destroyed.
+ *
+ * version: pointer to the version
+ *
+ * returns: pointer to the snapshot, or NULL on failure
+ */
+PersistentTree *persistent_snapshot(PersistentTree *version){
+    if (version == NULL) return NULL;
+    return make_version(retain(version->root), version->size);
+}
+
+/*
+ * Function: persistent_insert
+ * ---------------------------
+ * Creates a new version with value added. Only the O(log n) nodes on the
+ * search path are copied; the source version is unchanged and stays valid.
+ *
+ * version: pointer to the source version
+ * value: value to insert (duplicates allowed)
+ *
+ * returns: pointer to the new version, or NULL on failure
+ */
+PersistentTree *persistent_insert(PersistentTree *version, int value){
+    if (version == NULL) return NULL;
+
+    PersistentNode *root = insert_node(version->root, value);
+    if (root == NULL) return NULL;
+    return make_version(root, version->size + 1);
+}
+
+/*
+ * Function: persistent_delete
+ * ---------------------------
+ * Creates a new version with one occurrence of value removed. If value is not
+ * present the result is a snapshot of the source.
+ *
+ * version: pointer to the source version
+ * value: value to delete
+ * deleted: receives 1 if a value was removed, 0 otherwise (may be NULL)
+ *
+ * returns: pointer to the new version, or NULL on failure
+ */
+PersistentTree *persistent_delete(PersistentTree *version, int value, int *deleted){
+    if (deleted != NULL) *deleted = 0;
+    if (version == NULL) return NULL;
+
+    PersistentNode *root;
+    int status = delete_node(version->root, value, &root);
+    if (status == -1) return NULL;
+    if (status == 0) return persistent_snapshot(version);
+
+    PersistentTree *result = make_version(root, version->size - 1);
+    if (result != NULL && deleted != NULL) *deleted = 1;
+    return result;
+}
+
+/*
+ * Function: persistent_search
+ * ---------------------------
+ * Searches a version for a value. Safe to call concurrently with updates that
+ * derive new versions, since nodes are never modified.
+ *
+ * version: pointer to the version
+ * target: value to search for
+ *
+ * returns: pointer to the node holding the value, or NULL if not found
+ */
+PersistentNode *persistent_search(PersistentTree *version, int target){
+    if (version == NULL) return NULL;
+
+    PersistentNode *node = version->root;
+    while (node != NULL && node->value != target){
+        node = (target < node->value) ? node->left : node->right;
+    }
+    return node;
+}
+
+/*
+ * Function: persistent_size
+ * -------------------------
+ * Returns the number of values in a version.
+ *
+ * version: pointer to the version
+ *
+ * returns: number of values, or -1 if version is NULL
+ */
+long long persistent_size(PersistentTree *version){
+    if (version == NULL) return -1;
+    return version->size;
+}
+
+/*
+ * Function: persistent_height
+ * ---------------------------
+ * Returns the height of a version's tree.
+ *
+ * version: pointer to the version
+ *
+ * returns: height of the tree, 0 for an empty tree or NULL version
+ */
+int persistent_height(PersistentTree *version){
+    if (version == NULL) return 0;
+    return height(version->root);
+}
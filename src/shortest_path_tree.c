@@ -0,0 +1,185 @@
+#include "c_graph_internal.h"
+#include "c_graph.h"
+#include <stdlib.h>
+#include <float.h>
+
+/*
+ * Function: graph_spt_alloc
+ * -------------------------
+ * Allocates an uninitialized tree for num_ids vertex ids.
+ *
+ * returns: pointer to the tree, or NULL if allocation fails
+ */
+c_graph_spt_t* graph_spt_alloc(int source, int num_ids) {
+    c_graph_spt_t* tree = (c_graph_spt_t*)malloc(sizeof(c_graph_spt_t));
+    if (!tree) return NULL;
+    tree->source = source;
+    tree->num_ids = num_ids;
+    tree->dist = (double*)malloc(num_ids * sizeof(double));
+    tree->parent = (int*)malloc(num_ids * sizeof(int));
+    if (!tree->dist || !tree->parent) {
+        graph_spt_destroy(tree);
+        return NULL;
+    }
+    return tree;
+}
+
+/*
+ * Function: graph_spt_dijkstra
+ * ----------------------------
+ * Runs Dijkstra from source to completion and keeps the whole result, so
+ * the distance and path to any number of targets can be read afterwards
+ * without searching again. Edge weights must be non-negative.
+ *
+ * graph: pointer to the graph structure
+ * source: ID of the source vertex
+ *
+ * returns: pointer to the tree, or NULL if source is not a vertex or allocation fails
+ */
+c_graph_spt_t* graph_spt_dijkstra(c_graph_t* graph, int source) {
+    c_graph_csr_t* csr = graph_csr_get(graph, 0);
+    if (!csr) return NULL;
+    if (source < 0 || source >= csr->num_ids || !csr->present[source]) return NULL;
+
+    c_graph_spt_t* tree = graph_spt_alloc(source, csr->num_ids);
+    c_graph_heap_t* heap = graph_heap_create(csr->num_ids);
+    if (!tree || !heap) {
+        graph_spt_destroy(tree);
+        graph_heap_destroy(heap);
+        return NULL;
+    }
+
+    graph_settled_count = 0;
+    graph_csr_dijkstra(csr, heap, source, tree->dist, tree->parent);
+    graph_heap_destroy(heap);
+    return tree;
+}
+
+/*
+ * Function: graph_spt_bfs
+ * -----------------------
+ * Breadth-first counterpart of graph_spt_dijkstra: edge weights are
+ * ignored and distances count edges.
+ *
+ * graph: pointer to the graph structure
+ * source: ID of the source vertex
+ *
+ * returns: pointer to the tree, or NULL if source is not a vertex or allocation fails
+ */
+c_graph_spt_t* graph_spt_bfs(c_graph_t* graph, int source) {
+    c_graph_csr_t* csr = graph_csr_get(graph, 0);
+    if (!csr) return NULL;
+    if (source < 0 || source >= csr->num_ids || !csr->present[source]) return NULL;
+
+    int n = csr->num_ids;
+    c_graph_spt_t* tree = graph_spt_alloc(source, n);
+    int* queue = (int*)malloc(n * sizeof(int));
+    if (!tree || !queue) {
+        graph_spt_destroy(tree);
+        free(queue);
+        return NULL;
+    }
+
+    for (int i = 0; i < n; i++) {
+        tree->dist[i] = DBL_MAX;
+        tree->parent[i] = -1;
+    }
+    tree->dist[source] = 0;
+    int head = 0, tail = 0;
+    queue[tail++] = source;
+    graph_settled_count = 0;
+
+    while (head < tail) {
+        int u = queue[head++];
+        graph_settled_count++;
+        for (int i = csr->offsets[u]; i < csr->offsets[u + 1]; i++) {
+            int v = csr->targets[i];
+            if (tree->dist[v] != DBL_MAX) continue;
+            tree->dist[v] = tree->dist[u] + 1;
+            tree->parent[v] = u;
+            queue[tail++] = v;
+        }
+    }
+
+    free(queue);
+    return tree;
+}
+
+/*
+ * Function: graph_spt_destroy
+ * ---------------------------
+ * Frees a shortest-path tree.
+ *
+ * tree: pointer to the tree
+ *
+ * returns: void
+ */
+void graph_spt_destroy(c_graph_spt_t* tree) {
+    if (!tree) return;
+    free(tree->dist);
+    free(tree->parent);
+    free(tree);
+}
+
+/*
+ * Function: graph_spt_source
+ * --------------------------
+ * Returns the vertex the tree was grown from.
+ *
+ * tree: pointer to the tree
+ *
+ * returns: ID of the source vertex, or -1 if tree is NULL
+ */
+int graph_spt_source(const c_graph_spt_t* tree) {
+    return tree ? tree->source : -1;
+}
+
+/*
+ * Function: graph_spt_distance
+ * ----------------------------
+ * Looks up the shortest distance from the source to a vertex.
+ *
+ * tree: pointer to the tree
+ * target: ID of the vertex
+ *
+ * returns: the distance, or DBL_MAX if target is unreachable or not a valid id
+ */
+double graph_spt_distance(const c_graph_spt_t* tree, int target) {
+    if (!tree || target < 0 || target >= tree->num_ids) return DBL_MAX;
+    return tree->dist[target];
+}
+
+/*
+ * Function: graph_spt_parent
+ * --------------------------
+ * Looks up the predecessor of a vertex on its shortest path from the source.
+ *
+ * tree: pointer to the tree
+ * target: ID of the vertex
+ *
+ * returns: ID of the predecessor, or -1 for the source, unreachable vertices and invalid ids
+ */
+int graph_spt_parent(const c_graph_spt_t* tree, int target) {
+    if (!tree || target < 0 || target >= tree->num_ids) return -1;
+    return tree->parent[target];
+}
+
+/*
+ * Function: graph_spt_path
+ * ------------------------
+ * Extracts the shortest path from the source to a vertex by following
+ * predecessors, in time proportional to the length of the path.
+ *
+ * tree: pointer to the tree
+ * target: ID of the destination vertex
+ * path_len: pointer to an integer to store the length of the path
+ *
+ * returns: array of vertex IDs from the source to target,
+ *          or NULL if target is unreachable or input is invalid
+ */
+int* graph_spt_path(const c_graph_spt_t* tree, int target, int* path_len) {
+    if (!path_len) return NULL;
+    *path_len = 0;
+    if (graph_spt_distance(tree, target) == DBL_MAX) return NULL;
+    return graph_path_from_parents(tree->parent, target, path_len);
+}
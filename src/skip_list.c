@@ -0,0 +1,463 @@
+#include "skip_list.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COLLECT_INTERVAL 64 /* Retirements between epoch advance attempts */
+
+#define IS_MARKED(link) ((link) & 1)
+#define POINTER(link) ((SkipListNode *)((link) & ~(uintptr_t)1))
+
+/*
+ * Function: create_skip_list_node
+ * -------------------------------
+ * Allocates a node with level next pointers, all set to NULL.
+ *
+ * returns: pointer to the node, or NULL if allocation fails
+ */
+static SkipListNode *create_skip_list_node(int key, int level){
+    SkipListNode *node = malloc(sizeof(SkipListNode) + sizeof(_Atomic(uintptr_t)) * level);
+    if (node == NULL) return NULL;
+
+    node->key = key;
+    node->level = level;
+    node->retired_next = NULL;
+    atomic_init(&node->owners, 2);
+    for (int i = 0; i < level; i++) atomic_init(&node->next[i], 0);
+    return node;
+}
+
+/* Frees a chain of retired nodes */
+static void free_retired(SkipListNode *node){
+    while (node != NULL){
+        SkipListNode *next = node->retired_next;
+        free(node);
+        node = next;
+    }
+}
+
+/*
+ * Function: create_skip_list
+ * --------------------------
+ * Allocates an empty lock-free skip list set of int keys.
+ *
+ * returns: pointer to the created SkipList, or NULL if allocation fails
+ */
+SkipList *create_skip_list(void){
+    SkipList *list = malloc(sizeof(SkipList));
+    if (list == NULL) return NULL;
+
+    list->head = create_skip_list_node(0, SKIP_LIST_MAX_LEVEL);
+    if (list->head == NULL){
+        free(list);
+        return NULL;
+    }
+
+    atomic_init(&list->epoch, 2);
+    atomic_init(&list->size, 0);
+    for (int i = 0; i < SKIP_LIST_MAX_THREADS; i++){
+        SkipListHandle *handle = &list->handles[i];
+        handle->list = list;
+        atomic_init(&handle->in_use, 0);
+        atomic_init(&handle->state, 0);
+        memset(handle->limbo, 0, sizeof(handle->limbo));
+        handle->random_state = 0x9E3779B97F4A7C15ULL * (i + 1);
+        handle->retired_since_collect = 0;
+    }
+    return list;
+}
+
+/*
+ * Function: destroy_skip_list
+ * ---------------------------
+ * Frees the list, every node still linked, and every retired node. No thread
+ * may be using the list.
+ *
+ * list: pointer to the SkipList to destroy
+ *
+ * returns: void
+ */
+void destroy_skip_list(SkipList *list){
+    if (list == NULL) return;
+
+    /* Nodes still linked at level 0, marked or not, have not been retired */
+    SkipListNode *node = POINTER(atomic_load_explicit(&list->head->next[0], memory_order_relaxed));
+    while (node != NULL){
+        SkipListNode *next = POINTER(atomic_load_explicit(&node->next[0], memory_order_relaxed));
+        free(node);
+        node = next;
+    }
+
+    for (int i = 0; i < SKIP_LIST_MAX_THREADS; i++){
+        for (int j = 0; j < 3; j++) free_retired(list->handles[i].limbo[j].nodes);
+    }
+    free(list->head);
+    free(list);
+}
+
+/*
+ * Function: skip_list_attach
+ * --------------------------
+ * Claims a per-thread handle. Each thread must use its own handle for every
+ * operation; handles are reused after skip_list_detach.
+ *
+ * list: pointer to the SkipList
+ *
+ * returns: pointer to the handle, or NULL if all SKIP_LIST_MAX_THREADS handles are in use
+ */
+SkipListHandle *skip_list_attach(SkipList *list){
+    if (list == NULL) return NULL;
+
+    for (int i = 0; i < SKIP_LIST_MAX_THREADS; i++){
+        int expected = 0;
+        if (atomic_compare_exchange_strong(&list->handles[i].in_use, &expected, 1)) return &list->handles[i];
+    }
+    return NULL;
+}
+
+/*
+ * Function: skip_list_detach
+ * --------------------------
+ * Releases a handle. Its pending retired nodes stay with the handle slot and
+ * are freed by its next owner or by destroy_skip_list.
+ *
+ * handle: handle returned by skip_list_attach
+ *
+ * returns: void
+ */
+void skip_list_detach(SkipListHandle *handle){
+    if (handle == NULL) return;
+    atomic_store(&handle->state, 0);
+    atomic_store(&handle->in_use, 0);
+}
+
+/*
+ * Function: enter_epoch / exit_epoch
+ * ----------------------------------
+ * Bracket every operation. While a handle is active with epoch e, the global
+ * epoch cannot pass e + 1, so nodes retired from then on stay allocated until
+ * the handle exits.
+ */
+static void enter_epoch(SkipListHandle *handle){
+    unsigned long long epoch = atomic_load(&handle->list->epoch);
+    atomic_store(&handle->state, (epoch << 1) | 1);
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+static void exit_epoch(SkipListHandle *handle){
+    atomic_store_explicit(&handle->state, 0, memory_order_release);
+}
+
+/*
+ * Function: try_advance_epoch
+ * ---------------------------
+ * Advances the global epoch if every active handle has observed it.
+ */
+static void try_advance_epoch(SkipList *list){
+    unsigned long long epoch = atomic_load(&list->epoch);
+
+    for (int i = 0; i < SKIP_LIST_MAX_THREADS; i++){
+        unsigned long long state = atomic_load(&list->handles[i].state);
+        if ((state & 1) && (state >> 1) != epoch) return;
+    }
+    atomic_compare_exchange_strong(&list->epoch, &epoch, epoch + 1);
+}
+
+/*
+ * Function: collect
+ * -----------------
+ * Frees this handle's limbo lists that are at least two epochs old: every
+ * thread that could still hold a pointer into them has since left its
+ * critical section.
+ */
+static void collect(SkipListHandle *handle){
+    unsigned long long epoch = atomic_load(&handle->list->epoch);
+
+    for (int i = 0; i < 3; i++){
+        SkipListLimbo *limbo = &handle->limbo[i];
+        if (limbo->nodes != NULL && limbo->epoch + 2 <= epoch){
+            free_retired(limbo->nodes);
+            limbo->nodes = NULL;
+        }
+    }
+}
+
+/*
+ * Function: retire
+ * ----------------
+ * Queues an unlinked node to be freed once no thread can still reach it.
+ * Nodes are grouped by the epoch they were retired in.
+ */
+static void retire(SkipListHandle *handle, SkipListNode *node){
+    unsigned long long epoch = atomic_load(&handle->list->epoch);
+    SkipListLimbo *limbo = &handle->limbo[epoch % 3];
+
+    if (limbo->epoch != epoch){
+        free_retired(limbo->nodes); /* At least three epochs old */
+        limbo->nodes = NULL;
+        limbo->epoch = epoch;
+    }
+    node->retired_next = limbo->nodes;
+    limbo->nodes = node;
+
+    if (++handle->retired_since_collect >= COLLECT_INTERVAL){
+        handle->retired_since_collect = 0;
+        try_advance_epoch(handle->list);
+        collect(handle);
+    }
+}
+
+/*
+ * Function: release_node
+ * ----------------------
+ * Drops one of the node's two owners (its inserter and its deleter). The
+ * inserter may still be linking upper levels after the node was deleted, so
+ * the node is retired only when both have finished unlinking it.
+ */
+static void release_node(SkipListHandle *handle, SkipListNode *node){
+    if (atomic_fetch_sub(&node->owners, 1) == 1) retire(handle, node);
+}
+
+/* Geometric level with p = 1/2 from a per-handle xorshift generator */
+static int random_level(SkipListHandle *handle){
+    unsigned long long x = handle->random_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    handle->random_state = x;
+
+    int level = 1 + __builtin_ctzll(x | (1ULL << (SKIP_LIST_MAX_LEVEL - 1)));
+    return level;
+}
+
+/*
+ * Function: find
+ * --------------
+ * Locates the predecessors and successors of key at every level, unlinking
+ * any marked node it passes. Restarts from the head if an unlink loses a race.
+ *
+ * returns: 1 if an unmarked node with key is linked at level 0, 0 otherwise
+ */
+static int find(SkipList *list, int key, SkipListNode **preds, SkipListNode **succs){
+retry:;
+    SkipListNode *pred = list->head;
+    SkipListNode *curr = NULL;
+
+    for (int level = SKIP_LIST_MAX_LEVEL - 1; level >= 0; level--){
+        curr = POINTER(atomic_load(&pred->next[level]));
+        while (curr != NULL){
+            uintptr_t succ = atomic_load(&curr->next[level]);
+            while (IS_MARKED(succ)){
+                uintptr_t expected = (uintptr_t)curr;
+                if (!atomic_compare_exchange_strong(&pred->next[level], &expected, succ & ~(uintptr_t)1)) goto retry;
+                curr = POINTER(succ);
+                if (curr == NULL) break;
+                succ = atomic_load(&curr->next[level]);
+            }
+            if (curr == NULL || curr->key >= key) break;
+            pred = curr;
+            curr = POINTER(succ);
+        }
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+
+    return curr != NULL && curr->key == key;
+}
+
+/*
+ * Function: skip_list_insert
+ * --------------------------
+ * Adds a key. The node becomes visible with one CAS at level 0, which is the
+ * linearization point; upper levels are linked afterwards and only speed up
+ * searches.
+ *
+ * handle: calling thread's handle
+ * key: key to insert
+ *
+ * returns: 1 if inserted, 0 if the key was already present, -1 if handle is NULL or allocation fails
+ */
+int skip_list_insert(SkipListHandle *handle, int key){
+    if (handle == NULL) return -1;
+
+    SkipList *list = handle->list;
+    SkipListNode *preds[SKIP_LIST_MAX_LEVEL], *succs[SKIP_LIST_MAX_LEVEL];
+    int top = random_level(handle);
+    SkipListNode *node = NULL;
+
+    enter_epoch(handle);
+    while (1){
+        if (find(list, key, preds, succs)){
+            exit_epoch(handle);
+            free(node);
+            return 0;
+        }
+
+        if (node == NULL){
+            node = create_skip_list_node(key, top);
+            if (node == NULL){
+                exit_epoch(handle);
+                return -1;
+            }
+        }
+        for (int level = 0; level < top; level++){
+            atomic_store_explicit(&node->next[level], (uintptr_t)succs[level], memory_order_relaxed);
+        }
+
+        uintptr_t expected = (uintptr_t)succs[0];
+        if (atomic_compare_exchange_strong(&preds[0]->next[0], &expected, (uintptr_t)node)) break;
+    }
+    atomic_fetch_add(&list->size, 1);
+
+    for (int level = 1; level < top; level++){
+        while (1){
+            /* Point the new node at the current successor unless it is being deleted */
+            uintptr_t next = atomic_load(&node->next[level]);
+            if (IS_MARKED(next)) goto linked;
+            if (POINTER(next) != succs[level] &&
+                !atomic_compare_exchange_strong(&node->next[level], &next, (uintptr_t)succs[level])){
+                goto linked;
+            }
+
+            uintptr_t expected = (uintptr_t)succs[level];
+            if (atomic_compare_exchange_strong(&preds[level]->next[level], &expected, (uintptr_t)node)) break;
+
+            /* Predecessor changed: recompute, and stop if the node was deleted meanwhile */
+            if (!find(list, key, preds, succs) || succs[0] != node) goto linked;
+        }
+    }
+
+linked:
+    /* A concurrent delete may have missed levels linked after its cleanup */
+    if (IS_MARKED(atomic_load(&node->next[0]))) find(list, key, preds, succs);
+    release_node(handle, node);
+    exit_epoch(handle);
+    return 1;
+}
+
+/*
+ * Function: skip_list_search
+ * --------------------------
+ * Checks whether a key is present. Never writes to shared memory.
+ *
+ * handle: calling thread's handle
+ * key: key to search for
+ *
+ * returns: 1 if present, 0 otherwise
+ */
+int skip_list_search(SkipListHandle *handle, int key){
+    if (handle == NULL) return 0;
+
+    enter_epoch(handle);
+    SkipListNode *pred = handle->list->head;
+    SkipListNode *curr = NULL;
+    for (int level = SKIP_LIST_MAX_LEVEL - 1; level >= 0; level--){
+        curr = POINTER(atomic_load_explicit(&pred->next[level], memory_order_acquire));
+        while (curr != NULL && curr->key < key){
+            pred = curr;
+            curr = POINTER(atomic_load_explicit(&curr->next[level], memory_order_acquire));
+        }
+    }
+
+    int found = curr != NULL && curr->key == key &&
+                !IS_MARKED(atomic_load_explicit(&curr->next[0], memory_order_acquire));
+    exit_epoch(handle);
+    return found;
+}
+
+/*
+ * Function: skip_list_delete
+ * --------------------------
+ * Removes a key. The node is marked top-down; marking level 0 is the
+ * linearization point and decides which concurrent deleter wins. The winner
+ * then unlinks the node at every level through find.
+ *
+ * handle: calling thread's handle
+ * key: key to delete
+ *
+ * returns: 1 if deletion was successful, 0 if key not found
+ */
+int skip_list_delete(SkipListHandle *handle, int key){
+    if (handle == NULL) return 0;
+
+    SkipList *list = handle->list;
+    SkipListNode *preds[SKIP_LIST_MAX_LEVEL], *succs[SKIP_LIST_MAX_LEVEL];
+
+    enter_epoch(handle);
+    if (!find(list, key, preds, succs)){
+        exit_epoch(handle);
+        return 0;
+    }
+
+    SkipListNode *node = succs[0];
+    for (int level = node->level - 1; level >= 1; level--){
+        atomic_fetch_or(&node->next[level], (uintptr_t)1);
+    }
+    if (IS_MARKED(atomic_fetch_or(&node->next[0], (uintptr_t)1))){
+        exit_epoch(handle); /* Another thread deleted it first */
+        return 0;
+    }
+
+    atomic_fetch_sub(&list->size, 1);
+    find(list, key, preds, succs); /* Unlink at every level */
+    release_node(handle, node);
+    exit_epoch(handle);
+    return 1;
+}
+
+/*
+ * Function: skip_list_range
+ * -------------------------
+ * Visits the keys in [low, high] in ascending order. Keys inserted or deleted
+ * concurrently may or may not be visited. The callback runs inside the
+ * handle's critical section and must not use the same handle.
+ *
+ * handle: calling thread's handle
+ * low: inclusive lower bound
+ * high: inclusive upper bound
+ * visit: function called with each key (may be NULL to only count)
+ * context: passed through to visit
+ *
+ * returns: number of keys visited, or -1 if handle is NULL
+ */
+long long skip_list_range(SkipListHandle *handle, int low, int high, skip_list_visit_fn visit, void *context){
+    if (handle == NULL) return -1;
+    if (low > high) return 0;
+
+    enter_epoch(handle);
+    SkipListNode *pred = handle->list->head;
+    SkipListNode *curr = NULL;
+    for (int level = SKIP_LIST_MAX_LEVEL - 1; level >= 0; level--){
+        curr = POINTER(atomic_load_explicit(&pred->next[level], memory_order_acquire));
+        while (curr != NULL && curr->key < low){
+            pred = curr;
+            curr = POINTER(atomic_load_explicit(&curr->next[level], memory_order_acquire));
+        }
+    }
+
+    long long count = 0;
+    while (curr != NULL && curr->key <= high){
+        uintptr_t next = atomic_load_explicit(&curr->next[0], memory_order_acquire);
+        if (!IS_MARKED(next)){
+            if (visit != NULL) visit(curr->key, context);
+            count++;
+        }
+        curr = POINTER(next);
+    }
+    exit_epoch(handle);
+    return count;
+}
+
+/*
+ * Function: skip_list_size
+ * ------------------------
+ * Returns the number of keys. Exact when no operation is in flight.
+ *
+ * list: pointer to the SkipList
+ *
+ * returns: number of keys, or -1 if list is NULL
+ */
+long long skip_list_size(SkipList *list){
+    if (list == NULL) return -1;
+    return atomic_load(&list->size);
+}
@@ -0,0 +1,491 @@
+#include "treap.h"
+#include "c_vector_sort.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Subproblems smaller than this run on the current thread */
+#define TREAP_PARALLEL_GRAIN 16384
+
+enum treap_set_op{
+    TREAP_UNION,
+    TREAP_INTERSECTION,
+    TREAP_DIFFERENCE
+};
+
+/* Mixes the key bits so priorities look random but are reproducible */
+static unsigned int key_priority(int key){
+    unsigned long long x = (unsigned int)key + 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return (unsigned int)(x ^ (x >> 31));
+}
+
+static inline int node_size(TreapNode *node){
+    return (node == NULL) ? 0 : node->size;
+}
+
+static inline void update_size(TreapNode *node){
+    node->size = 1 + node_size(node->left) + node_size(node->right);
+}
+
+/*
+ * Function: treap_create_node
+ * ---------------------------
+ * Allocates a single-node treap.
+ *
+ * key: key to store
+ *
+ * returns: pointer to the node, or NULL on allocation failure
+ */
+TreapNode *treap_create_node(int key){
+    TreapNode *node = malloc(sizeof(TreapNode));
+    if (node == NULL) return NULL;
+
+    node->key = key;
+    node->priority = key_priority(key);
+    node->size = 1;
+    node->left = NULL;
+    node->right = NULL;
+    return node;
+}
+
+/*
+ * Function: destroy_treap
+ * -----------------------
+ * Frees all nodes. Recursion depth is the treap height, O(log n) expected.
+ *
+ * root: pointer to the root node
+ *
+ * returns: void
+ */
+void destroy_treap(TreapNode *root){
+    while (root != NULL){
+        TreapNode *right = root->right;
+        destroy_treap(root->left);
+        free(root);
+        root = right;
+    }
+}
+
+/*
+ * Function: treap_split
+ * ---------------------
+ * Splits a treap into the keys below key and the keys above it. Both halves
+ * keep the heap order on priorities, so no rebalancing is needed.
+ *
+ * root: treap to split (consumed)
+ * key: split key
+ * less: receives the treap of keys < key
+ * greater: receives the treap of keys > key
+ *
+ * returns: the detached node holding key, or NULL if key is not present
+ */
+TreapNode *treap_split(TreapNode *root, int key, TreapNode **less, TreapNode **greater){
+    if (root == NULL){
+        *less = NULL;
+        *greater = NULL;
+        return NULL;
+    }
+
+    TreapNode *match;
+    if (key < root->key){
+        match = treap_split(root->left, key, less, &root->left);
+        update_size(root);
+        *greater = root;
+    }
+    else if (key > root->key){
+        match = treap_split(root->right, key, &root->right, greater);
+        update_size(root);
+        *less = root;
+    }
+    else{
+        *less = root->left;
+        *greater = root->right;
+        root->left = NULL;
+        root->right = NULL;
+        root->size = 1;
+        match = root;
+    }
+    return match;
+}
+
+/*
+ * Function: treap_join
+ * --------------------
+ * Concatenates two treaps where every key of less is below every key of
+ * greater, merging along the inner spines by priority.
+ *
+ * less: treap of smaller keys (consumed)
+ * greater: treap of larger keys (consumed)
+ *
+ * returns: root of the joined treap
+ */
+TreapNode *treap_join(TreapNode *less, TreapNode *greater){
+    if (less == NULL) return greater;
+    if (greater == NULL) return less;
+
+    if (less->priority > greater->priority){
+        less->right = treap_join(less->right, greater);
+        update_size(less);
+        return less;
+    }
+    greater->left = treap_join(less, greater->left);
+    update_size(greater);
+    return greater;
+}
+
+/*
+ * Function: treap_search
+ * ----------------------
+ * Searches for a key.
+ *
+ * root: pointer to the root node
+ * key: key to search for
+ *
+ * returns: pointer to the node holding key, or NULL if not found
+ */
+TreapNode *treap_search(TreapNode *root, int key){
+    while (root != NULL && root->key != key){
+        root = (key < root->key) ? root->left : root->right;
+    }
+    return root;
+}
+
+/*
+ * Function: treap_size
+ * --------------------
+ * Returns the number of keys in a treap in O(1).
+ *
+ * root: pointer to the root node
+ *
+ * returns: number of keys
+ */
+int treap_size(TreapNode *root){
+    return node_size(root);
+}
+
+/* Inserts a node whose key is known to be absent; returns the new subtree root */
+static TreapNode *insert_node(TreapNode *root, TreapNode *node){
+    if (root == NULL) return node;
+
+    if (node->priority > root->priority){
+        treap_split(root, node->key, &node->left, &node->right);
+        update_size(node);
+        return node;
+    }
+    if (node->key < root->key)
+        root->left = insert_node(root->left, node);
+    else
+        root->right = insert_node(root->right, node);
+    update_size(root);
+    return root;
+}
+
+/*
+ * Function: treap_insert
+ * ----------------------
+ * Adds a key to the set.
+ *
+ * root: pointer to the root pointer, updated in place
+ * key: key to insert
+ *
+ * returns: 1 if inserted, 0 if already present, -1 on allocation failure
+ */
+int treap_insert(TreapNode **root, int key){
+    if (root == NULL) return -1;
+    if (treap_search(*root, key) != NULL) return 0;
+
+    TreapNode *node = treap_create_node(key);
+    if (node == NULL) return -1;
+    *root = insert_node(*root, node);
+    return 1;
+}
+
+/* Removes key from a subtree; returns the new subtree root */
+static TreapNode *delete_node(TreapNode *root, int key){
+    if (key == root->key){
+        TreapNode *joined = treap_join(root->left, root->right);
+        free(root);
+        return joined;
+    }
+    if (key < root->key)
+        root->left = delete_node(root->left, key);
+    else
+        root->right = delete_node(root->right, key);
+    update_size(root);
+    return root;
+}
+
+/*
+ * Function: treap_delete
+ * ----------------------
+ * Removes a key from the set.
+ *
+ * root: pointer to the root pointer, updated in place
+ * key: key to delete
+ *
+ * returns: 1 if deleted, 0 if not found
+ */
+int treap_delete(TreapNode **root, int key){
+    if (root == NULL || treap_search(*root, key) == NULL) return 0;
+    *root = delete_node(*root, key);
+    return 1;
+}
+
+typedef struct set_task{
+    int op;
+    TreapNode *a;
+    TreapNode *b;
+    int threads;
+    TreapNode *result;
+}SetTask;
+
+static TreapNode *set_operation(int op, TreapNode *a, TreapNode *b, int threads);
+
+static void *set_task_run(void *arg){
+    SetTask *task = arg;
+    task->result = set_operation(task->op, task->a, task->b, task->threads);
+    return NULL;
+}
+
+/*
+ * Function: run_halves
+ * --------------------
+ * Computes the two independent recursive calls of a set operation. When the
+ * thread budget allows and the first half is big enough to pay for a thread,
+ * it runs on a new thread with half the budget while the calling thread takes
+ * the second half. If the thread cannot be started it runs inline.
+ */
+static void run_halves(SetTask *first, SetTask *second, int threads){
+    int spawn = threads > 1 && node_size(first->a) + node_size(first->b) >= TREAP_PARALLEL_GRAIN;
+
+    first->threads = spawn ? threads / 2 : threads;
+    second->threads = spawn ? threads - threads / 2 : threads;
+
+    pthread_t thread;
+    if (spawn && pthread_create(&thread, NULL, set_task_run, first) == 0){
+        set_task_run(second);
+        pthread_join(thread, NULL);
+        return;
+    }
+    set_task_run(first);
+    set_task_run(second);
+}
+
+/*
+ * Function: set_operation
+ * -----------------------
+ * Join-based set algebra. The root with the higher priority (for difference,
+ * the root of b) splits the other treap; the two sides are solved
+ * independently and glued back with the root or a join. Each split costs the
+ * depth of the tree being split, which gives O(m log(n/m + 1)) work for sizes
+ * m <= n, and O(log^2 n) span expected when the halves run in parallel.
+ *
+ * returns: root of the result; both inputs are consumed
+ */
+static TreapNode *set_operation(int op, TreapNode *a, TreapNode *b, int threads){
+    if (a == NULL || b == NULL){
+        if (op == TREAP_UNION) return (a != NULL) ? a : b;
+        if (op == TREAP_INTERSECTION){
+            destroy_treap(a);
+            destroy_treap(b);
+            return NULL;
+        }
+        destroy_treap(b);
+        return a;
+    }
+
+    SetTask left = {op, NULL, NULL, 1, NULL};
+    SetTask right = {op, NULL, NULL, 1, NULL};
+
+    if (op == TREAP_DIFFERENCE){
+        /* Split a around b's root; b's root itself is dropped */
+        TreapNode *match = treap_split(a, b->key, &left.a, &right.a);
+        left.b = b->left;
+        right.b = b->right;
+        free(b);
+        free(match);
+        run_halves(&left, &right, threads);
+        return treap_join(left.result, right.result);
+    }
+
+    /* Union and intersection are symmetric: keep the higher priority on top */
+    if (a->priority < b->priority){
+        TreapNode *swap = a;
+        a = b;
+        b = swap;
+    }
+
+    TreapNode *match = treap_split(b, a->key, &left.b, &right.b);
+    left.a = a->left;
+    right.a = a->right;
+    run_halves(&left, &right, threads);
+
+    if (op == TREAP_INTERSECTION && match == NULL){
+        free(a);
+        return treap_join(left.result, right.result);
+    }
+    free(match);
+    a->left = left.result;
+    a->right = right.result;
+    update_size(a);
+    return a;
+}
+
+/* Resolves a thread count, where <= 0 means the number of online CPUs */
+static int thread_budget(int threads){
+    if (threads > 0) return threads;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cpus > 0) ? (int)cpus : 1;
+}
+
+/*
+ * Function: treap_union
+ * ---------------------
+ * Computes a ∪ b.
+ *
+ * a: first set (consumed)
+ * b: second set (consumed)
+ * threads: maximum number of threads to use, or <= 0 for the number of online CPUs
+ *
+ * returns: root of the union
+ */
+TreapNode *treap_union(TreapNode *a, TreapNode *b, int threads){
+    return set_operation(TREAP_UNION, a, b, thread_budget(threads));
+}
+
+/*
+ * Function: treap_intersection
+ * ----------------------------
+ * Computes a ∩ b.
+ *
+ * a: first set (consumed)
+ * b: second set (consumed)
+ * threads: maximum number of threads to use, or <= 0 for the number of online CPUs
+ *
+ * returns: root of the intersection
+ */
+TreapNode *treap_intersection(TreapNode *a, TreapNode *b, int threads){
+    return set_operation(TREAP_INTERSECTION, a, b, thread_budget(threads));
+}
+
+/*
+ * Function: treap_difference
+ * --------------------------
+ * Computes a \ b.
+ *
+ * a: set to subtract from (consumed)
+ * b: set of keys to remove (consumed)
+ * threads: maximum number of threads to use, or <= 0 for the number of online CPUs
+ *
+ * returns: root of the difference
+ */
+TreapNode *treap_difference(TreapNode *a, TreapNode *b, int threads){
+    return set_operation(TREAP_DIFFERENCE, a, b, thread_budget(threads));
+}
+
+/*
+ * Function: build_batch
+ * ---------------------
+ * Sorts a copy of keys, drops duplicates and builds a treap from the run in
+ * O(n): nodes are appended in key order while a stack holds the right spine,
+ * and each node's size is final once it is popped off the spine.
+ *
+ * returns: 1 if successful (root may be NULL for an empty batch), -1 on allocation failure
+ */
+static int build_batch(const int *keys, int n, TreapNode **root){
+    *root = NULL;
+    if (n == 0) return 1;
+
+    int *sorted = malloc(sizeof(int) * (size_t)n);
+    TreapNode **spine = malloc(sizeof(TreapNode *) * (size_t)n);
+    if (sorted == NULL || spine == NULL){
+        free(sorted);
+        free(spine);
+        return -1;
+    }
+    memcpy(sorted, keys, sizeof(int) * (size_t)n);
+    if (radix_sort_ints(sorted, n) != 1){
+        free(sorted);
+        free(spine);
+        return -1;
+    }
+
+    int depth = 0;
+    for (int i = 0; i < n; i++){
+        if (i > 0 && sorted[i] == sorted[i - 1]) continue;
+
+        TreapNode *node = treap_create_node(sorted[i]);
+        if (node == NULL){
+            /* Everything built so far hangs off the linked spine */
+            destroy_treap(depth > 0 ? spine[0] : NULL);
+            free(sorted);
+            free(spine);
+            return -1;
+        }
+
+        TreapNode *popped = NULL;
+        while (depth > 0 && spine[depth - 1]->priority < node->priority){
+            popped = spine[--depth];
+            update_size(popped);
+        }
+        node->left = popped;
+        if (depth > 0) spine[depth - 1]->right = node;
+        spine[depth++] = node;
+    }
+
+    while (depth > 0) update_size(spine[--depth]);
+    *root = spine[0];
+    free(sorted);
+    free(spine);
+    return 1;
+}
+
+/*
+ * Function: treap_insert_batch
+ * ----------------------------
+ * Inserts many keys at once by building a treap from the batch and taking its
+ * union with the set. Duplicates in the batch or already in the set are
+ * ignored. On failure the set is unchanged.
+ *
+ * root: pointer to the root pointer, updated in place
+ * keys: keys to insert, in any order
+ * n: number of keys
+ * threads: maximum number of threads to use, or <= 0 for the number of online CPUs
+ *
+ * returns: 1 if successful, -1 if the input is invalid or on allocation failure
+ */
+int treap_insert_batch(TreapNode **root, const int *keys, int n, int threads){
+    if (root == NULL || n < 0 || (n > 0 && keys == NULL)) return -1;
+
+    TreapNode *batch;
+    if (build_batch(keys, n, &batch) != 1) return -1;
+    *root = treap_union(*root, batch, threads);
+    return 1;
+}
+
+/*
+ * Function: treap_delete_batch
+ * ----------------------------
+ * Deletes many keys at once by building a treap from the batch and taking
+ * the difference. Keys not in the set are ignored. On failure the set is
+ * unchanged.
+ *
+ * root: pointer to the root pointer, updated in place
+ * keys: keys to delete, in any order
+ * n: number of keys
+ * threads: maximum number of threads to use, or <= 0 for the number of online CPUs
+ *
+ * returns: 1 if successful, -1 if the input is invalid or on allocation failure
+ */
+int treap_delete_batch(TreapNode **root, const int *keys, int n, int threads){
+    if (root == NULL || n < 0 || (n > 0 && keys == NULL)) return -1;
+
+    TreapNode *batch;
+    if (build_batch(keys, n, &batch) != 1) return -1;
+    *root = treap_difference(*root, batch, threads);
+    return 1;
+}
@@ -0,0 +1,242 @@
+#include "include/art_tree.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <limits.h>
+
+typedef struct {
+    long long keys[4096];
+    int values[4096];
+    int count;
+} collected;
+
+void collect(long long key, int value, void *context) {
+    collected *out = context;
+    if (out->count < 4096) {
+        out->keys[out->count] = key;
+        out->values[out->count] = value;
+    }
+    out->count++;
+}
+
+void test_insert_and_search() {
+    printf("Testing art_insert and art_search...\n");
+
+    ArtTree *tree = create_art_tree();
+    assert(tree != NULL && art_size(tree) == 0);
+
+    int value = 0;
+    assert(art_search(tree, 5, &value) == 0);
+    assert(art_insert(tree, 5, 50) == 1);
+    assert(art_insert(tree, -5, -50) == 1);
+    assert(art_insert(tree, INT_MIN, 1) == 1);
+    assert(art_insert(tree, INT_MAX, 2) == 1);
+    assert(art_insert(tree, 0, 3) == 1);
+
+    assert(art_search(tree, 5, &value) == 1 && value == 50);
+    assert(art_search(tree, -5, &value) == 1 && value == -50);
+    assert(art_search(tree, INT_MIN, &value) == 1 && value == 1);
+    assert(art_search(tree, INT_MAX, &value) == 1 && value == 2);
+    assert(art_search(tree, 0, NULL) == 1);
+    assert(art_search(tree, 6, NULL) == 0);
+    assert(art_search(tree, 5 + 256, NULL) == 0);
+    assert(art_size(tree) == 5);
+    printf("✓ Insert and search work for negative and extreme keys\n");
+
+    assert(art_insert(tree, 5, 51) == 0);
+    assert(art_search(tree, 5, &value) == 1 && value == 51);
+    assert(art_size(tree) == 5);
+    printf("✓ Inserting an existing key updates its value\n");
+
+    assert(art_insert(NULL, 1, 1) == -1);
+    assert(art_search(NULL, 1, NULL) == 0);
+    assert(art_delete(NULL, 1) == 0);
+    assert(art_size(NULL) == -1);
+    printf("✓ NULL tree is handled\n");
+
+    destroy_art_tree(tree);
+}
+
+void test_node_growth_and_shrink() {
+    printf("\nTesting growth through all node sizes and back...\n");
+
+    ArtTree *tree = create_art_tree();
+
+    // Keys sharing the top seven bytes all land in one node under a 7-byte prefix
+    for (int i = 0; i < 256; i++) {
+        assert(art_insert(tree, 0x1000 + i, i) == 1);
+        if (i == 3) assert(tree->root->type == ART_NODE4);
+        if (i == 15) assert(tree->root->type == ART_NODE16);
+        if (i == 47) assert(tree->root->type == ART_NODE48);
+    }
+    assert(tree->root->type == ART_NODE256);
+    assert(tree->root->prefix_len == 7);
+    for (int i = 0; i < 256; i++) {
+        int value;
+        assert(art_search(tree, 0x1000 + i, &value) == 1 && value == i);
+    }
+    printf("✓ A node grows from Node4 to Node256\n");
+
+    for (int i = 255; i >= 2; i--) assert(art_delete(tree, 0x1000 + i) == 1);
+    assert(tree->root->type == ART_NODE4 && tree->root->count == 2);
+    assert(art_delete(tree, 0x1001) == 1);
+    assert(art_search(tree, 0x1000, NULL) == 1);
+    assert(art_delete(tree, 0x1000) == 1);
+    assert(tree->root == NULL && art_size(tree) == 0);
+    printf("✓ Deletes shrink the node and collapse it when one child is left\n");
+
+    destroy_art_tree(tree);
+}
+
+void test_prefix_split_and_merge() {
+    printf("\nTesting prefix splits and merges...\n");
+
+    ArtTree *tree = create_art_tree();
+    art_insert(tree, 0x01020304, 1);
+    art_insert(tree, 0x01020305, 2);
+    assert(tree->root->prefix_len == 7);
+
+    // Differs in the second byte: the prefix is split above the existing node
+    art_insert(tree, 0x01FF0000, 3);
+    assert(tree->root->prefix_len == 5);
+    assert(art_search(tree, 0x01020304, NULL) && art_search(tree, 0x01020305, NULL));
+    assert(art_search(tree, 0x01FF0000, NULL));
+    assert(!art_search(tree, 0x01030304, NULL));
+
+    // Removing the branch merges the prefixes back together
+    assert(art_delete(tree, 0x01FF0000) == 1);
+    assert(tree->root->prefix_len == 7);
+    assert(art_search(tree, 0x01020304, NULL) && art_search(tree, 0x01020305, NULL));
+    printf("✓ Prefixes split on mismatch and merge on collapse\n");
+
+    destroy_art_tree(tree);
+}
+
+void test_ordered_iteration() {
+    printf("\nTesting art_range...\n");
+
+    ArtTree *tree = create_art_tree();
+    int keys[] = {300, -1, 7, 65536, INT_MIN, -70000, 0, 255, 256, INT_MAX};
+    int n = sizeof(keys) / sizeof(keys[0]);
+    for (int i = 0; i < n; i++) art_insert(tree, keys[i], keys[i] / 2);
+
+    collected *out = calloc(1, sizeof(collected));
+    assert(art_range(tree, INT_MIN, INT_MAX, collect, out) == n);
+    int expected[] = {INT_MIN, -70000, -1, 0, 7, 255, 256, 300, 65536, INT_MAX};
+    for (int i = 0; i < n; i++) {
+        assert(out->keys[i] == expected[i]);
+        assert(out->values[i] == expected[i] / 2);
+    }
+    printf("✓ Full iteration visits keys in signed order\n");
+
+    out->count = 0;
+    assert(art_range(tree, -1, 256, collect, out) == 5);
+    assert(out->keys[0] == -1 && out->keys[4] == 256);
+    assert(art_range(tree, 1, 6, NULL, NULL) == 0);
+    assert(art_range(tree, 10, 5, NULL, NULL) == 0);
+    printf("✓ Range bounds are inclusive\n");
+
+    free(out);
+    destroy_art_tree(tree);
+}
+
+void test_64bit_keys() {
+    printf("\nTesting 64-bit keys...\n");
+
+    ArtTree *tree = create_art_tree();
+    // Pairs that agree in their low 32 bits must stay distinct
+    long long keys[] = {5, (1LL << 32) + 5, -(1LL << 32) + 5, LLONG_MAX, LLONG_MIN, 1LL << 40, -(1LL << 40), -1};
+    int n = sizeof(keys) / sizeof(keys[0]);
+    for (int i = 0; i < n; i++) assert(art_insert(tree, keys[i], i) == 1);
+    assert(art_size(tree) == n);
+    for (int i = 0; i < n; i++) {
+        int value = -1;
+        assert(art_search(tree, keys[i], &value) == 1 && value == i);
+    }
+    assert(art_search(tree, (1LL << 33) + 5, NULL) == 0);
+    printf("✓ Keys that differ only above bit 31 are distinct\n");
+
+    collected *out = calloc(1, sizeof(collected));
+    assert(art_range(tree, LLONG_MIN, LLONG_MAX, collect, out) == n);
+    long long expected[] = {LLONG_MIN, -(1LL << 40), -(1LL << 32) + 5, -1, 5, (1LL << 32) + 5, 1LL << 40, LLONG_MAX};
+    for (int i = 0; i < n; i++) assert(out->keys[i] == expected[i]);
+    out->count = 0;
+    assert(art_range(tree, 0, (1LL << 40) - 1, collect, out) == 2);
+    assert(out->keys[0] == 5 && out->keys[1] == (1LL << 32) + 5);
+    printf("✓ Ranges span the full 64-bit order\n");
+
+    assert(art_delete(tree, (1LL << 32) + 5) == 1);
+    assert(art_search(tree, 5, NULL) == 1);
+    assert(art_search(tree, (1LL << 32) + 5, NULL) == 0);
+    printf("✓ Deleting one key leaves its 32-bit twin\n");
+
+    free(out);
+    destroy_art_tree(tree);
+}
+
+int compare_ints(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+void test_random_operations() {
+    printf("\nTesting random operations against a reference array...\n");
+
+    srand(42);
+    int range = 1 << 20;
+    char *present = calloc(range, 1);
+    ArtTree *tree = create_art_tree();
+    long long expected = 0;
+
+    // Keys spread over a sparse range so every node type and prefix length appears
+    for (int step = 0; step < 300000; step++) {
+        int slot = rand() % range;
+        int key = (slot - range / 2) * 2047;
+        if (rand() % 3 == 0) {
+            assert(art_delete(tree, key) == present[slot]);
+            if (present[slot]) { present[slot] = 0; expected--; }
+        } else {
+            assert(art_insert(tree, key, slot) == !present[slot]);
+            if (!present[slot]) { present[slot] = 1; expected++; }
+        }
+    }
+    assert(art_size(tree) == expected);
+
+    for (int slot = 0; slot < range; slot += 7) {
+        int value;
+        int key = (slot - range / 2) * 2047;
+        assert(art_search(tree, key, &value) == present[slot]);
+        if (present[slot]) assert(value == slot);
+    }
+
+    // Ordered iteration matches the sorted reference
+    int *sorted = malloc(sizeof(int) * expected);
+    int count = 0;
+    for (int slot = 0; slot < range; slot++) {
+        if (present[slot]) sorted[count++] = (slot - range / 2) * 2047;
+    }
+    qsort(sorted, count, sizeof(int), compare_ints);
+    collected *out = calloc(1, sizeof(collected));
+    assert(art_range(tree, sorted[100], INT_MAX, collect, out) == expected - 100);
+    for (int i = 0; i < 4096 && 100 + i < count; i++) assert(out->keys[i] == sorted[100 + i]);
+    printf("✓ 300000 random operations match the reference\n");
+
+    free(out);
+    free(sorted);
+    free(present);
+    destroy_art_tree(tree);
+}
+
+int main() {
+    printf("=== Adaptive Radix Tree Test Suite ===\n\n");
+
+    test_insert_and_search();
+    test_node_growth_and_shrink();
+    test_prefix_split_and_merge();
+    test_ordered_iteration();
+    test_64bit_keys();
+    test_random_operations();
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
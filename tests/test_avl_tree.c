@@ -0,0 +1,144 @@
+#include "include/avl_tree.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+
+// Checks ordering, stored heights and the AVL balance invariant; returns the node count
+int check_avl(AvlNode *root, long long low, long long high) {
+    if (root == NULL) return 0;
+    assert(root->value >= low && root->value <= high);
+
+    int left = avl_height(root->left);
+    int right = avl_height(root->right);
+    assert(root->height == 1 + (left > right ? left : right));
+    assert(left - right >= -1 && left - right <= 1);
+
+    return 1 + check_avl(root->left, low, root->value) + check_avl(root->right, root->value, high);
+}
+
+void test_insert_and_search() {
+    printf("Testing avl_insert and avl_search...\n");
+
+    AvlNode *root = NULL;
+    AvlNode *node = avl_insert(&root, 50);
+    assert(node != NULL && root == node && node->height == 1);
+    avl_insert(&root, 30);
+    avl_insert(&root, 70);
+    avl_insert(&root, 20);
+
+    assert(avl_search(root, 30) != NULL);
+    assert(avl_search(root, 30)->value == 30);
+    assert(avl_search(root, 99) == NULL);
+    assert(avl_search(NULL, 1) == NULL);
+    assert(check_avl(root, -2147483648LL, 2147483647LL) == 4);
+    printf("✓ Insert and search work correctly\n");
+
+    destroy_avl_tree(root);
+}
+
+void test_sorted_insert_stays_balanced() {
+    printf("\nTesting sorted and reverse-sorted inserts...\n");
+
+    int n = 100000;
+    AvlNode *ascending = NULL;
+    AvlNode *descending = NULL;
+    for (int i = 0; i < n; i++) {
+        avl_insert(&ascending, i);
+        avl_insert(&descending, n - i);
+    }
+
+    // An AVL tree with n nodes has height below 1.44 log2(n + 2)
+    assert(avl_height(ascending) <= 24);
+    assert(avl_height(descending) <= 24);
+    assert(check_avl(ascending, 0, n) == n);
+    assert(check_avl(descending, 0, n) == n);
+    for (int i = 0; i < n; i++) assert(avl_search(ascending, i) != NULL);
+    printf("✓ %d sorted keys give height %d instead of %d\n", n, avl_height(ascending), n);
+
+    destroy_avl_tree(ascending);
+    destroy_avl_tree(descending);
+}
+
+void test_delete() {
+    printf("\nTesting avl_delete...\n");
+
+    AvlNode *root = NULL;
+    assert(avl_delete(&root, 1) == 0);
+
+    int n = 20000;
+    for (int i = 0; i < n; i++) avl_insert(&root, (i * 7919) % n); // Permutation of [0, n)
+    assert(avl_delete(&root, n + 5) == 0);
+
+    // Delete every even key: leaves, single-child and two-child nodes
+    for (int i = 0; i < n; i += 2) assert(avl_delete(&root, i) == 1);
+    assert(check_avl(root, 0, n) == n / 2);
+    for (int i = 0; i < n; i++) assert((avl_search(root, i) != NULL) == (i % 2 == 1));
+    printf("✓ Deletes keep the tree ordered and balanced\n");
+
+    for (int i = 1; i < n; i += 2) assert(avl_delete(&root, i) == 1);
+    assert(root == NULL);
+    printf("✓ Deleting every key empties the tree\n");
+}
+
+void test_duplicates() {
+    printf("\nTesting duplicate values...\n");
+
+    AvlNode *root = NULL;
+    for (int i = 0; i < 100; i++) avl_insert(&root, i % 10);
+    assert(check_avl(root, 0, 9) == 100);
+
+    for (int i = 0; i < 10; i++) assert(avl_delete(&root, 3) == 1);
+    assert(avl_search(root, 3) == NULL);
+    assert(avl_delete(&root, 3) == 0);
+    assert(check_avl(root, 0, 9) == 90);
+    printf("✓ Each delete removes one copy of a duplicate\n");
+
+    destroy_avl_tree(root);
+}
+
+void test_random_operations() {
+    printf("\nTesting random operations against a reference...\n");
+
+    int range = 2000;
+    int *counts = calloc(range, sizeof(int));
+    AvlNode *root = NULL;
+    int size = 0;
+    srand(42);
+
+    for (int op = 0; op < 50000; op++) {
+        int key = rand() % range;
+        if (rand() % 3 == 0) {
+            int deleted = avl_delete(&root, key);
+            assert(deleted == (counts[key] > 0));
+            if (deleted) {
+                counts[key]--;
+                size--;
+            }
+        }
+        else {
+            avl_insert(&root, key);
+            counts[key]++;
+            size++;
+        }
+    }
+
+    assert(check_avl(root, 0, range) == size);
+    for (int key = 0; key < range; key++) assert((avl_search(root, key) != NULL) == (counts[key] > 0));
+    printf("✓ Tree matches the reference after 50000 mixed operations\n");
+
+    free(counts);
+    destroy_avl_tree(root);
+}
+
+int main() {
+    printf("=== AVL Tree Test Suite ===\n\n");
+
+    test_insert_and_search();
+    test_sorted_insert_stays_balanced();
+    test_delete();
+    test_duplicates();
+    test_random_operations();
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "include/binary_search_tree.h"
+#include "include/binary_search_tree_internal.h"
 #include <stdio.h>
 #include <assert.h>
 #include <stdlib.h>
@@ -326,6 +327,203 @@ void test_comprehensive_delete() {
     destroy_binary_search_tree(root);
 }
 
+void test_pooled_tree() {
+    printf("\nTesting pooled tree handle...\n");
+
+    BSTree *tree = create_bst_tree();
+    assert(tree != NULL && bst_size(tree) == 0);
+    assert(bst_search(tree, 1) == NULL);
+    assert(bst_delete(tree, 1) == 0);
+
+    int n = BST_SLAB_NODES * 2 + 10; // Spans three slabs
+    for (int i = 0; i < n; i++) {
+        Node *node = bst_insert(tree, (int)((i * 7919LL) % n));
+        assert(node != NULL);
+    }
+    assert(bst_size(tree) == n);
+    assert(count_nodes(tree->root) == n);
+    for (int i = 0; i < n; i++) assert(bst_search(tree, i)->value == i);
+    printf("✓ Inserted %d values across several slabs\n", n);
+
+    for (int i = 0; i < n; i += 2) assert(bst_delete(tree, i) == 1);
+    assert(bst_size(tree) == n / 2);
+    for (int i = 0; i < n; i++) assert((bst_search(tree, i) != NULL) == (i % 2 == 1));
+    printf("✓ Deleted every even value\n");
+
+    // Freed nodes are reused before any new slab is allocated
+    Node *slabs_before = (Node *)tree->slabs;
+    int used_before = tree->slab_used;
+    for (int i = 0; i < n; i += 2) bst_insert(tree, i);
+    assert((Node *)tree->slabs == slabs_before && tree->slab_used == used_before);
+    assert(count_nodes(tree->root) == n);
+    printf("✓ Reinserts reuse nodes from the free list\n");
+
+    destroy_bst_tree(tree);
+}
+
+void test_deep_tree() {
+    printf("\nTesting a degenerate 10M-deep tree...\n");
+
+    // Link the chain directly: inserting sorted keys one by one is O(n^2)
+    int depth = 10000000;
+    Node *root = create_node(0);
+    root->size = depth;
+    Node *tail = root;
+    for (int i = 1; i < depth; i++) {
+        tail->right = create_node(i);
+        assert(tail->right != NULL);
+        tail = tail->right;
+        tail->size = depth - i;
+    }
+
+    assert(binary_search(root, depth - 1) == tail);
+    assert(delete_node(&root, depth - 1) == 1);          // Deepest leaf
+    assert(delete_node(&root, depth / 2) == 1);          // Middle of the chain
+    assert(delete_node(&root, 0) == 1 && root->value == 1); // Root
+    assert(delete_node(&root, depth) == 0);
+    assert(binary_search(root, depth / 2) == NULL);
+    assert(binary_search(root, depth - 2) != NULL);
+    assert(root->size == depth - 3);
+    printf("✓ Deletes at any depth do not recurse\n");
+
+    // Left spine as well, so destroy has to rotate
+    Node *left_chain = create_node(depth);
+    Node *left_tail = left_chain;
+    for (int i = depth - 1; i > depth - 1000000; i--) {
+        left_tail->left = create_node(i);
+        left_tail = left_tail->left;
+    }
+    destroy_binary_search_tree(left_chain);
+    destroy_binary_search_tree(root);
+    printf("✓ Destroyed deep left and right spines without overflowing the stack\n");
+}
+
+// Checks every stored subtree size; returns the size of the subtree
+int check_sizes(Node *root) {
+    if (root == NULL) return 0;
+    int size = 1 + check_sizes(root->left) + check_sizes(root->right);
+    assert(root->size == size);
+    return size;
+}
+
+int compare_ints(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+void test_order_statistics() {
+    printf("\nTesting select, rank, count_range and iteration...\n");
+
+    BSTree *tree = create_bst_tree();
+    int n = 3000;
+    int *sorted = malloc(sizeof(int) * n);
+    srand(9);
+    for (int i = 0; i < n; i++) {
+        sorted[i] = rand() % 1000; // Plenty of duplicates
+        bst_insert(tree, sorted[i]);
+    }
+    qsort(sorted, n, sizeof(int), compare_ints);
+    assert(check_sizes(tree->root) == n);
+
+    for (int k = 0; k < n; k++) assert(bst_select(tree->root, k)->value == sorted[k]);
+    assert(bst_select(tree->root, n) == NULL && bst_select(tree->root, -1) == NULL);
+    assert(bst_select(NULL, 0) == NULL);
+    printf("✓ bst_select returns the k-th smallest value\n");
+
+    for (int v = -1; v <= 1000; v++) {
+        int less = 0;
+        while (less < n && sorted[less] < v) less++;
+        assert(bst_rank(tree->root, v) == less);
+    }
+    assert(bst_count_range(tree->root, 0, 999) == n);
+    assert(bst_count_range(tree->root, 500, 499) == 0);
+    int in_range = 0;
+    for (int i = 0; i < n; i++) in_range += (sorted[i] >= 250 && sorted[i] <= 750);
+    assert(bst_count_range(tree->root, 250, 750) == in_range);
+    printf("✓ bst_rank and bst_count_range match a sorted reference\n");
+
+    BSTIterator it;
+    int value, index = bst_rank(tree->root, 400);
+    bst_iterator_seek(&it, tree->root, 400);
+    while (bst_iterator_next(&it, &value)) {
+        assert(value == sorted[index]);
+        index++;
+    }
+    assert(index == n);
+    bst_iterator_seek(&it, tree->root, 5000);
+    assert(bst_iterator_next(&it, &value) == 0);
+    printf("✓ Iterator visits values in order from the seek position, duplicates included\n");
+
+    // Sizes stay exact through deletes of every kind of node
+    for (int i = 0; i < n; i += 3) assert(bst_delete(tree, sorted[i]) == 1);
+    assert(bst_delete(tree, 5000) == 0);
+    assert(check_sizes(tree->root) == bst_size(tree));
+    Node *root = create_node(0);
+    for (int i = 1; i < 200; i++) binary_insert(root, i % 37);
+    for (int i = 0; i < 100; i++) delete_node(&root, i % 37);
+    assert(check_sizes(root) == 100);
+    printf("✓ Subtree sizes are maintained by insert and delete\n");
+
+    destroy_binary_search_tree(root);
+    destroy_bst_tree(tree);
+    free(sorted);
+}
+
+int tree_height(Node *root) {
+    if (root == NULL) return 0;
+    int left = tree_height(root->left), right = tree_height(root->right);
+    return 1 + (left > right ? left : right);
+}
+
+void test_bulk_build_and_merge() {
+    printf("\nTesting bulk build and merge...\n");
+
+    int unsorted[] = {3, 1, 2};
+    assert(bst_build_sorted(unsorted, 3) == NULL);
+    BSTree *empty = bst_build_sorted(NULL, 0);
+    assert(empty != NULL && bst_size(empty) == 0 && empty->root == NULL);
+    destroy_bst_tree(empty);
+
+    int n = 100000;
+    Vector *vector = create_vector(n);
+    for (int i = 0; i < n; i++) add_at_end(vector, i * 2);
+    BSTree *tree = bst_build_from_vector(vector);
+    assert(tree != NULL && bst_size(tree) == n);
+    assert(tree_height(tree->root) == 17); // ceil(log2(n + 1))
+    assert(check_sizes(tree->root) == n);
+    assert(tree->slabs->next == NULL); // One allocation for every node
+    for (int k = 0; k < n; k += 997) assert(bst_select(tree->root, k)->value == k * 2);
+    printf("✓ Sorted Vector builds a perfectly balanced tree in one slab\n");
+
+    // The built tree supports the usual operations
+    assert(bst_delete(tree, 10) == 1);
+    assert(bst_insert(tree, 11) != NULL);
+    assert(bst_search(tree, 11) != NULL && bst_search(tree, 10) == NULL);
+
+    int batch[] = {-5, 1, 11, 11, 500001};
+    assert(bst_merge_sorted(tree, unsorted, 3) == -1);
+    assert(bst_merge_sorted(tree, batch, 5) == 1);
+    assert(bst_size(tree) == n + 5);
+    assert(check_sizes(tree->root) == n + 5);
+    assert(tree->slabs->next == NULL && tree->free_list == NULL);
+    assert(bst_select(tree->root, 0)->value == -5);
+    assert(bst_select(tree->root, n + 4)->value == 500001);
+    assert(bst_count_range(tree->root, 11, 11) == 3);
+    BSTIterator it;
+    int value, previous = -10, visited = 0;
+    bst_iterator_seek(&it, tree->root, -10);
+    while (bst_iterator_next(&it, &value)) {
+        assert(value >= previous);
+        previous = value;
+        visited++;
+    }
+    assert(visited == n + 5);
+    printf("✓ Sorted batch merges into a rebuilt balanced tree\n");
+
+    destroy_bst_tree(tree);
+    destroy_vector(vector);
+}
+
 int main() {
     printf("=== Binary Search Tree Test Suite ===\n\n");
     
@@ -339,6 +537,10 @@ int main() {
     test_delete_two_children_node();
     test_delete_root_scenarios();
     test_comprehensive_delete();
+    test_pooled_tree();
+    test_order_statistics();
+    test_bulk_build_and_merge();
+    test_deep_tree();
     
     printf("\n=== All tests passed! ===\n");
     
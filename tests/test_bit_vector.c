@@ -0,0 +1,142 @@
+#include "include/c_bit_vector.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+void test_set_get_clear() {
+    printf("Testing set, get and clear...\n");
+
+    assert(create_bit_vector(0) == NULL);
+    BitVector *bits = create_bit_vector(130);
+    assert(bits != NULL);
+
+    for (long long i = 0; i < 130; i++) assert(bit_vector_get(bits, i) == 0);
+    bit_vector_set(bits, 0);
+    bit_vector_set(bits, 63);
+    bit_vector_set(bits, 64);
+    bit_vector_set(bits, 129);
+    bit_vector_set(bits, 130); // Out of range, ignored
+    assert(bit_vector_get(bits, 0) == 1 && bit_vector_get(bits, 63) == 1);
+    assert(bit_vector_get(bits, 64) == 1 && bit_vector_get(bits, 129) == 1);
+    assert(bit_vector_get(bits, 1) == 0);
+    assert(bit_vector_get(bits, 130) == -1 && bit_vector_get(bits, -1) == -1);
+    assert(bit_vector_count(bits) == 4);
+    printf("✓ Bits are set across word boundaries\n");
+
+    bit_vector_clear(bits, 63);
+    assert(bit_vector_get(bits, 63) == 0 && bit_vector_count(bits) == 3);
+    assert(bit_vector_test_and_set(bits, 5) == 0);
+    assert(bit_vector_test_and_set(bits, 5) == 1);
+    printf("✓ Clear and test_and_set work\n");
+
+    bit_vector_reset(bits);
+    assert(bit_vector_count(bits) == 0);
+    printf("✓ Reset clears every bit\n");
+
+    destroy_bit_vector(bits);
+}
+
+void test_bulk_operations() {
+    printf("\nTesting bulk operations...\n");
+
+    BitVector *a = create_bit_vector(1000);
+    BitVector *b = create_bit_vector(1000);
+    BitVector *other = create_bit_vector(999);
+    for (long long i = 0; i < 1000; i += 2) bit_vector_set(a, i); // Evens
+    for (long long i = 0; i < 1000; i += 3) bit_vector_set(b, i); // Multiples of 3
+
+    assert(bit_vector_and(a, other) == -1);
+
+    BitVector *c = create_bit_vector(1000);
+    bit_vector_or(c, a);
+    assert(bit_vector_and(c, b) == 1);
+    assert(bit_vector_count(c) == 167); // Multiples of 6 in [0, 1000)
+    printf("✓ and keeps the intersection\n");
+
+    bit_vector_reset(c);
+    bit_vector_or(c, a);
+    assert(bit_vector_or(c, b) == 1);
+    assert(bit_vector_count(c) == 500 + 334 - 167);
+    printf("✓ or keeps the union\n");
+
+    assert(bit_vector_andnot(a, b) == 1);
+    assert(bit_vector_count(a) == 500 - 167);
+    assert(bit_vector_get(a, 6) == 0 && bit_vector_get(a, 4) == 1);
+    printf("✓ andnot keeps the difference\n");
+
+    destroy_bit_vector(a);
+    destroy_bit_vector(b);
+    destroy_bit_vector(c);
+    destroy_bit_vector(other);
+}
+
+void test_rank_select() {
+    printf("\nTesting rank and select...\n");
+
+    long long n = 200000;
+    BitVector *bits = create_bit_vector(n);
+    char *reference = calloc(n, 1);
+    srand(7);
+    for (long long i = 0; i < n; i++) {
+        if (rand() % 3 == 0) {
+            bit_vector_set(bits, i);
+            reference[i] = 1;
+        }
+    }
+
+    long long ones = 0;
+    for (long long i = 0; i < n; i++) {
+        assert(bit_vector_rank(bits, i) == ones);
+        if (reference[i]) {
+            assert(bit_vector_select(bits, ones) == i);
+            ones++;
+        }
+    }
+    assert(bit_vector_rank(bits, n) == ones);
+    assert(bit_vector_select(bits, ones) == -1);
+    assert(bit_vector_select(bits, -1) == -1);
+    printf("✓ rank and select match a reference on %lld bits\n", n);
+
+    // Modifying the bits invalidates the index, which is rebuilt on demand
+    bit_vector_set(bits, 0);
+    bit_vector_clear(bits, n - 1);
+    assert(bit_vector_rank(bits, n) == bit_vector_count(bits));
+    assert(bit_vector_select(bits, 0) == 0);
+    printf("✓ Index is rebuilt after modification\n");
+
+    free(reference);
+    destroy_bit_vector(bits);
+}
+
+void test_sparse_and_dense() {
+    printf("\nTesting sparse and dense vectors...\n");
+
+    BitVector *sparse = create_bit_vector(1 << 20);
+    bit_vector_set(sparse, 12345);
+    bit_vector_set(sparse, (1 << 20) - 1);
+    assert(bit_vector_select(sparse, 0) == 12345);
+    assert(bit_vector_select(sparse, 1) == (1 << 20) - 1);
+    assert(bit_vector_rank(sparse, 12346) == 1);
+    printf("✓ Select finds bits far apart\n");
+
+    BitVector *dense = create_bit_vector(5000);
+    for (long long i = 0; i < 5000; i++) bit_vector_set(dense, i);
+    for (long long k = 0; k < 5000; k++) assert(bit_vector_select(dense, k) == k);
+    assert(bit_vector_rank(dense, 4321) == 4321);
+    printf("✓ Select works when every bit is set\n");
+
+    destroy_bit_vector(sparse);
+    destroy_bit_vector(dense);
+}
+
+int main() {
+    printf("=== BitVector Test Suite ===\n\n");
+
+    test_set_get_clear();
+    test_bulk_operations();
+    test_rank_select();
+    test_sparse_and_dense();
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,230 @@
+#include "include/bplus_tree_internal.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <limits.h>
+
+// Node allocations left before the test allocator starts failing; -1 never fails
+static int allocations_left = -1;
+
+static void *failing_alloc(size_t alignment, size_t size) {
+    if (allocations_left == 0) return NULL;
+    if (allocations_left > 0) allocations_left--;
+    return aligned_alloc(alignment, size);
+}
+
+// Checks key order, fill bounds and uniform leaf depth; returns the number of keys
+long long check_node(BPlusNode *node, long long low, long long high, int depth, int height, int is_root) {
+    if (node->is_leaf) {
+        assert(depth == height);
+        BPlusLeaf *leaf = (BPlusLeaf *)node;
+        if (!is_root) assert(node->count >= BPLUS_LEAF_KEYS / 2);
+        for (int i = 0; i < node->count; i++) {
+            assert(leaf->keys[i] >= low && leaf->keys[i] < high);
+            if (i > 0) assert(leaf->keys[i - 1] < leaf->keys[i]);
+        }
+        return node->count;
+    }
+
+    BPlusInternal *internal = (BPlusInternal *)node;
+    assert(node->count >= (is_root ? 1 : BPLUS_INTERNAL_KEYS / 2));
+    long long total = 0;
+    for (int i = 0; i <= node->count; i++) {
+        long long child_low = (i == 0) ? low : internal->keys[i - 1];
+        long long child_high = (i == node->count) ? high : internal->keys[i];
+        assert(child_low <= child_high);
+        total += check_node(internal->children[i], child_low, child_high, depth + 1, height, 0);
+    }
+    return total;
+}
+
+void check_tree(BPlusTree *tree) {
+    assert(check_node(tree->root, LLONG_MIN, LLONG_MAX, 1, tree->height, 1) == bplus_size(tree));
+}
+
+void test_node_layout() {
+    printf("Testing node layout...\n");
+
+    assert(sizeof(BPlusLeaf) <= 256);
+    assert(sizeof(BPlusInternal) <= 512);
+    BPlusTree *tree = create_bplus_tree();
+    assert(((unsigned long)tree->root % BPLUS_NODE_ALIGNMENT) == 0);
+    printf("✓ Nodes fit in whole cache lines and are line-aligned\n");
+
+    destroy_bplus_tree(tree);
+}
+
+void test_insert_search() {
+    printf("\nTesting bplus_insert and bplus_search...\n");
+
+    BPlusTree *tree = create_bplus_tree();
+    int value = 0;
+    assert(bplus_search(tree, 5, &value) == 0);
+    assert(bplus_insert(tree, 5, 50) == 1);
+    assert(bplus_search(tree, 5, &value) == 1 && value == 50);
+    assert(bplus_insert(tree, 5, 55) == 0); // Update, no duplicate
+    assert(bplus_search(tree, 5, &value) == 1 && value == 55);
+    assert(bplus_size(tree) == 1);
+    printf("✓ Insert, update and search work\n");
+
+    int n = 200000;
+    for (int i = 0; i < n; i++) assert(bplus_insert(tree, i * 2, i) >= 0); // Sorted input
+    for (int i = 0; i < n; i++) {
+        assert(bplus_search(tree, i * 2, &value) == 1);
+        assert(value == i);
+        if (i != 2) assert(bplus_search(tree, i * 2 + 1, NULL) == 0); // 5 was inserted above
+    }
+    assert(bplus_insert(tree, INT_MIN, 1) == 1 && bplus_insert(tree, INT_MAX, 2) == 1);
+    assert(bplus_search(tree, INT_MIN, &value) == 1 && value == 1);
+    assert(bplus_search(tree, INT_MAX, &value) == 1 && value == 2);
+    check_tree(tree);
+    printf("✓ %lld keys in a tree of height %d\n", bplus_size(tree), tree->height);
+
+    destroy_bplus_tree(tree);
+}
+
+void test_iteration_and_range() {
+    printf("\nTesting ordered iteration and range counts...\n");
+
+    BPlusTree *tree = create_bplus_tree();
+    for (int i = 999; i >= 0; i--) bplus_insert(tree, i * 10, -i); // Reverse order input
+
+    BPlusIterator it;
+    bplus_seek(tree, 0, &it);
+    int key, value, expected = 0;
+    while (bplus_next(&it, &key, &value)) {
+        assert(key == expected * 10 && value == -expected);
+        expected++;
+    }
+    assert(expected == 1000);
+    printf("✓ Iteration visits every key in order\n");
+
+    bplus_seek(tree, 4995, &it);
+    assert(bplus_next(&it, &key, NULL) == 1 && key == 5000);
+    bplus_seek(tree, 100000, &it);
+    assert(bplus_next(&it, &key, NULL) == 0);
+    printf("✓ Seek lands on the first key at or above the target\n");
+
+    assert(bplus_range_count(tree, 0, 9990) == 1000);
+    assert(bplus_range_count(tree, 15, 45) == 3);
+    assert(bplus_range_count(tree, 100, 100) == 1);
+    assert(bplus_range_count(tree, 101, 109) == 0);
+    assert(bplus_range_count(tree, 50, 10) == 0);
+    assert(bplus_range_count(tree, INT_MIN, INT_MAX) == 1000);
+    printf("✓ Range counts are exact\n");
+
+    destroy_bplus_tree(tree);
+}
+
+void test_delete() {
+    printf("\nTesting bplus_delete...\n");
+
+    BPlusTree *tree = create_bplus_tree();
+    assert(bplus_delete(tree, 1) == 0);
+
+    int n = 100000;
+    for (int i = 0; i < n; i++) bplus_insert(tree, (int)((i * 7919LL) % n), i);
+    assert(bplus_delete(tree, n) == 0);
+
+    for (int i = 0; i < n; i += 2) assert(bplus_delete(tree, i) == 1);
+    check_tree(tree);
+    for (int i = 0; i < n; i++) assert(bplus_search(tree, i, NULL) == (i % 2));
+    printf("✓ Deleting half the keys keeps the tree valid\n");
+
+    for (int i = 1; i < n; i += 2) assert(bplus_delete(tree, i) == 1);
+    assert(bplus_size(tree) == 0 && tree->height == 1);
+    check_tree(tree);
+    printf("✓ Deleting every key collapses the tree to an empty leaf\n");
+
+    destroy_bplus_tree(tree);
+}
+
+void test_random_operations() {
+    printf("\nTesting random operations against a reference...\n");
+
+    int range = 50000;
+    char *present = calloc(range, 1);
+    BPlusTree *tree = create_bplus_tree();
+    srand(3);
+
+    for (int op = 0; op < 400000; op++) {
+        int key = rand() % range;
+        if (rand() % 2) {
+            assert(bplus_insert(tree, key, key) == !present[key]);
+            present[key] = 1;
+        }
+        else {
+            assert(bplus_delete(tree, key) == present[key]);
+            present[key] = 0;
+        }
+        if (op % 50000 == 0) check_tree(tree);
+    }
+
+    check_tree(tree);
+    long long expected = 0;
+    for (int key = 0; key < range; key++) {
+        assert(bplus_search(tree, key, NULL) == present[key]);
+        expected += present[key];
+    }
+    assert(bplus_size(tree) == expected);
+    assert(bplus_range_count(tree, 0, range) == expected);
+    printf("✓ Tree matches the reference after 400000 mixed operations\n");
+
+    free(present);
+    destroy_bplus_tree(tree);
+}
+
+void test_allocation_failure() {
+    printf("\nTesting inserts that run out of memory mid-split...\n");
+
+    BPlusTree *tree = create_bplus_tree();
+    bplus_set_allocator(failing_alloc);
+    int failures = 0;
+    for (int key = 0; key < 20000; key++) {
+        // Fail at each possible allocation of the split: leaf, internal nodes, new root
+        for (int allowed = 0; allowed < 4; allowed++) {
+            long long size = bplus_size(tree);
+            int height = tree->height;
+            allocations_left = allowed;
+            int result = bplus_insert(tree, key, key);
+            allocations_left = -1;
+            if (result == 1) {
+                assert(bplus_delete(tree, key) == 1);
+                continue;
+            }
+
+            assert(result == -1);
+            failures++;
+            assert(bplus_size(tree) == size && tree->height == height);
+            assert(bplus_search(tree, key, NULL) == 0);
+            if (key % 16 == 0) check_tree(tree);
+        }
+        assert(bplus_insert(tree, key, key) == 1);
+    }
+
+    check_tree(tree);
+    assert(tree->height >= 4);
+    for (int key = 0; key < 20000; key++) {
+        int value = -1;
+        assert(bplus_search(tree, key, &value) == 1 && value == key);
+    }
+    assert(bplus_range_count(tree, 0, 20000) == 20000);
+    printf("✓ %d failed inserts left the tree unchanged\n", failures);
+
+    bplus_set_allocator(NULL);
+    destroy_bplus_tree(tree);
+}
+
+int main() {
+    printf("=== B+ Tree Test Suite ===\n\n");
+
+    test_node_layout();
+    test_insert_search();
+    test_iteration_and_range();
+    test_delete();
+    test_random_operations();
+    test_allocation_failure();
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
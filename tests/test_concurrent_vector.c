@@ -0,0 +1,120 @@
+#include "include/c_concurrent_vector.h"
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_PRODUCERS 4
+#define NUM_READERS 3
+#define ITEMS_PER_PRODUCER 200000
+
+// Values encode (producer + 1, sequence) so readers can validate what they see; 0 is never written
+#define ENCODE(producer, seq) ((((producer) + 1) << 24) | (seq))
+
+typedef struct {
+    ConcurrentVector *vec;
+    int id;
+} worker_args;
+
+static atomic_int producers_done;
+static atomic_int reader_errors;
+
+void *producer(void *arg) {
+    worker_args *args = arg;
+    for (int seq = 0; seq < ITEMS_PER_PRODUCER; seq++) {
+        if (concurrent_add_at_end(args->vec, ENCODE(args->id, seq)) < 0) abort();
+    }
+    atomic_fetch_add(&producers_done, 1);
+    return NULL;
+}
+
+void *reader(void *arg) {
+    worker_args *args = arg;
+    while (atomic_load(&producers_done) < NUM_PRODUCERS) {
+        long long size = concurrent_current_size(args->vec);
+        // Sample the published prefix, including its newest element
+        for (long long i = size - 1; i >= 0 && i >= size - 64; i--) {
+            int value = concurrent_get_value_at_index(args->vec, i);
+            int producer_id = (value >> 24) - 1, seq = value & 0xFFFFFF;
+            if (producer_id < 0 || producer_id >= NUM_PRODUCERS || seq >= ITEMS_PER_PRODUCER) {
+                atomic_fetch_add(&reader_errors, 1);
+            }
+        }
+        if (size > 0 && concurrent_vector_at(args->vec, size) != NULL && size == concurrent_current_size(args->vec)) {
+            atomic_fetch_add(&reader_errors, 1); // unpublished index must not be readable
+        }
+        sched_yield(); // keep producers running on machines with few cores
+    }
+    return NULL;
+}
+
+void test_single_thread() {
+    printf("Testing single-threaded use...\n");
+
+    ConcurrentVector *vec = create_concurrent_vector();
+    assert(concurrent_current_size(vec) == 0);
+    assert(concurrent_get_value_at_index(vec, 0) == -1);
+
+    // Crosses several segment boundaries
+    for (int i = 0; i < 100000; i++) assert(concurrent_add_at_end(vec, i) == i);
+    const int *first = concurrent_vector_at(vec, 0);
+    for (int i = 100000; i < 300000; i++) concurrent_add_at_end(vec, i);
+
+    assert(concurrent_current_size(vec) == 300000);
+    assert(concurrent_vector_at(vec, 0) == first); // elements never move
+    for (int i = 0; i < 300000; i++) assert(concurrent_get_value_at_index(vec, i) == i);
+    printf("✓ Appends across segments keep values and addresses stable\n");
+
+    destroy_concurrent_vector(vec);
+}
+
+void test_concurrent_stress() {
+    printf("\nTesting %d producers with %d concurrent readers...\n", NUM_PRODUCERS, NUM_READERS);
+
+    ConcurrentVector *vec = create_concurrent_vector();
+    pthread_t producers[NUM_PRODUCERS], readers[NUM_READERS];
+    worker_args producer_args[NUM_PRODUCERS], reader_args[NUM_READERS];
+
+    for (int r = 0; r < NUM_READERS; r++) {
+        reader_args[r] = (worker_args){vec, r};
+        pthread_create(&readers[r], NULL, reader, &reader_args[r]);
+    }
+    for (int p = 0; p < NUM_PRODUCERS; p++) {
+        producer_args[p] = (worker_args){vec, p};
+        pthread_create(&producers[p], NULL, producer, &producer_args[p]);
+    }
+    for (int p = 0; p < NUM_PRODUCERS; p++) pthread_join(producers[p], NULL);
+    for (int r = 0; r < NUM_READERS; r++) pthread_join(readers[r], NULL);
+
+    assert(atomic_load(&reader_errors) == 0);
+    printf("✓ Readers only ever observed fully written elements\n");
+
+    long long total = (long long)NUM_PRODUCERS * ITEMS_PER_PRODUCER;
+    assert(concurrent_current_size(vec) == total);
+
+    // Each producer's values appear exactly once and in its append order
+    int next_seq[NUM_PRODUCERS] = {0};
+    for (long long i = 0; i < total; i++) {
+        int value = concurrent_get_value_at_index(vec, i);
+        int producer_id = (value >> 24) - 1, seq = value & 0xFFFFFF;
+        assert(producer_id >= 0 && producer_id < NUM_PRODUCERS);
+        assert(seq == next_seq[producer_id]);
+        next_seq[producer_id]++;
+    }
+    for (int p = 0; p < NUM_PRODUCERS; p++) assert(next_seq[p] == ITEMS_PER_PRODUCER);
+    printf("✓ All %lld appends published exactly once, per-producer order kept\n", total);
+
+    destroy_concurrent_vector(vec);
+}
+
+int main() {
+    printf("=== Concurrent Vector Test Suite ===\n\n");
+
+    test_single_thread();
+    test_concurrent_stress();
+
+    printf("\n=== All tests passed! ===\n");
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include "include/eytzinger_index.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <limits.h>
+
+void test_layout() {
+    printf("Testing BFS layout...\n");
+
+    int values[] = {1, 2, 3, 4, 5, 6, 7};
+    EytzingerIndex *index = eytzinger_from_sorted(values, 7);
+    assert(index != NULL && index->size == 7);
+    int expected[] = {0, 4, 2, 6, 1, 3, 5, 7};
+    for (int k = 1; k <= 7; k++) assert(index->keys[k] == expected[k]);
+    assert(((unsigned long)index->keys % 64) == 0);
+    printf("✓ Keys are stored in BFS order in an aligned array\n");
+
+    int unsorted[] = {2, 1};
+    assert(eytzinger_from_sorted(unsorted, 2) == NULL);
+    destroy_eytzinger_index(index);
+}
+
+void test_search_every_size() {
+    printf("\nTesting search and lower bound for sizes 0..300...\n");
+
+    int values[300];
+    for (int i = 0; i < 300; i++) values[i] = i * 3;
+
+    for (int n = 0; n <= 300; n++) {
+        EytzingerIndex *index = eytzinger_from_sorted(values, n);
+        assert(index != NULL);
+        for (int target = -2; target <= n * 3 + 2; target++) {
+            assert(eytzinger_search(index, target) == (target >= 0 && target < n * 3 && target % 3 == 0));
+
+            int value = -1;
+            int expected_exists = target <= (n - 1) * 3;
+            assert(eytzinger_lower_bound(index, target, &value) == (n > 0 && expected_exists));
+            if (n > 0 && expected_exists) {
+                int expected = (target <= 0) ? 0 : (target + 2) / 3 * 3;
+                assert(value == expected);
+            }
+        }
+        destroy_eytzinger_index(index);
+    }
+    printf("✓ Results match a sorted-array reference at every size\n");
+}
+
+void test_extremes_and_duplicates() {
+    printf("\nTesting extreme values and duplicates...\n");
+
+    int values[] = {INT_MIN, INT_MIN, 0, 5, 5, 5, INT_MAX};
+    EytzingerIndex *index = eytzinger_from_sorted(values, 7);
+    assert(eytzinger_search(index, INT_MIN) == 1);
+    assert(eytzinger_search(index, INT_MAX) == 1);
+    assert(eytzinger_search(index, 5) == 1);
+    assert(eytzinger_search(index, 4) == 0);
+    int value;
+    assert(eytzinger_lower_bound(index, 1, &value) == 1 && value == 5);
+    assert(eytzinger_lower_bound(index, INT_MIN + 1, &value) == 1 && value == 0);
+    printf("✓ INT_MIN, INT_MAX and duplicate keys are found\n");
+
+    destroy_eytzinger_index(index);
+}
+
+void test_freeze_tree() {
+    printf("\nTesting bst_freeze...\n");
+
+    EytzingerIndex *empty = bst_freeze(NULL);
+    assert(empty != NULL && empty->size == 0 && eytzinger_search(empty, 0) == 0);
+    destroy_eytzinger_index(empty);
+
+    BSTree *tree = create_bst_tree();
+    srand(21);
+    for (int i = 0; i < 50000; i++) bst_insert(tree, rand() % 100000);
+
+    EytzingerIndex *index = bst_freeze(tree->root);
+    assert(index->size == bst_size(tree));
+    for (int target = 0; target < 100000; target++) {
+        assert(eytzinger_search(index, target) == (bst_search(tree, target) != NULL));
+    }
+    printf("✓ Frozen index answers like the tree for every key\n");
+
+    destroy_eytzinger_index(index);
+    destroy_bst_tree(tree);
+}
+
+int main() {
+    printf("=== Eytzinger Index Test Suite ===\n\n");
+
+    test_layout();
+    test_search_every_size();
+    test_extremes_and_duplicates();
+    test_freeze_tree();
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
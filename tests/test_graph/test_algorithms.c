@@ -3,6 +3,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <math.h>
+#include <float.h>
 
 #define ASSERT(condition, test_failed_ptr) \
     if (!(condition)) { \
@@ -71,3 +73,440 @@ void test_dijkstra_shortest_path(int* test_failed) {
     free(path);
     graph_destroy(graph);
 }
+
+#define RANDOM_GRAPH_SIZE 60
+
+// Builds a random graph and records its edge weights in w (0 = no edge)
+static c_graph_t* build_random_graph(int directed, unsigned int seed, double* w) {
+    c_graph_t* graph = graph_create(directed);
+    int n = RANDOM_GRAPH_SIZE;
+    srand(seed);
+    memset(w, 0, sizeof(double) * n * n);
+    for (int i = 0; i < n; i++) graph_add_vertex(graph, i);
+    for (int e = 0; e < 3 * n; e++) {
+        int a = rand() % n, b = rand() % n;
+        if (a == b || w[a * n + b] != 0) continue;
+        double weight = 1 + rand() % 20;
+        graph_add_edge(graph, a, b, weight);
+        w[a * n + b] = weight;
+        if (!directed) w[b * n + a] = weight;
+    }
+    return graph;
+}
+
+// Returns the cost of a path, or -1 if it is not a start-to-end walk along edges
+static double path_cost(const double* w, const int* path, int len, int start, int end) {
+    if (!path || len < 1 || path[0] != start || path[len - 1] != end) return -1;
+    double cost = 0;
+    for (int i = 0; i + 1 < len; i++) {
+        double weight = w[path[i] * RANDOM_GRAPH_SIZE + path[i + 1]];
+        if (weight == 0) return -1;
+        cost += weight;
+    }
+    return cost;
+}
+
+void test_bidirectional_dijkstra(int* test_failed) {
+    static double w[RANDOM_GRAPH_SIZE * RANDOM_GRAPH_SIZE];
+
+    for (int directed = 0; directed <= 1; directed++) {
+        c_graph_t* graph = build_random_graph(directed, 45 + directed, w);
+        for (int s = 0; s < RANDOM_GRAPH_SIZE; s += 7) {
+            for (int t = 0; t < RANDOM_GRAPH_SIZE; t += 3) {
+                int expected_len = 0, len = 0;
+                int* expected = graph_dijkstra(graph, s, t, &expected_len);
+                int* path = graph_bidirectional_dijkstra(graph, s, t, &len);
+                ASSERT((expected == NULL) == (path == NULL), test_failed);
+                if (path) {
+                    double cost = path_cost(w, path, len, s, t);
+                    ASSERT(cost >= 0, test_failed);
+                    ASSERT(cost == path_cost(w, expected, expected_len, s, t), test_failed);
+                } else {
+                    ASSERT(len == 0, test_failed);
+                }
+                free(expected);
+                free(path);
+            }
+        }
+        graph_destroy(graph);
+    }
+
+    // The cached CSR view must follow changes to the graph
+    c_graph_t* graph = graph_create(1);
+    for (int i = 0; i < 3; i++) graph_add_vertex(graph, i);
+    graph_add_edge(graph, 0, 1, 1);
+    int len = 0;
+    int* path = graph_bidirectional_dijkstra(graph, 0, 2, &len);
+    ASSERT(path == NULL && len == 0, test_failed);
+    graph_add_edge(graph, 1, 2, 1);
+    path = graph_bidirectional_dijkstra(graph, 0, 2, &len);
+    ASSERT(path && len == 3 && path[1] == 1, test_failed);
+    free(path);
+
+    path = graph_bidirectional_dijkstra(graph, 1, 1, &len);
+    ASSERT(path && len == 1 && path[0] == 1, test_failed);
+    free(path);
+    ASSERT(graph_bidirectional_dijkstra(graph, 0, 7, &len) == NULL && len == 0, test_failed);
+    ASSERT(graph_bidirectional_dijkstra(NULL, 0, 1, &len) == NULL, test_failed);
+    graph_destroy(graph);
+}
+
+// Euclidean distance on a grid whose edge weights are at least the distance between endpoints
+static double grid_distance(int vertex_id, int end_id, void* ctx) {
+    int side = *(int*)ctx;
+    double dx = vertex_id % side - end_id % side;
+    double dy = vertex_id / side - end_id / side;
+    return sqrt(dx * dx + dy * dy);
+}
+
+// Deliberately inconsistent but admissible: forces A* to reopen vertices
+static double jumpy_heuristic(int vertex_id, int end_id, void* ctx) {
+    (void)ctx;
+    return (vertex_id % 2 == 0 && vertex_id != end_id) ? 1 : 0;
+}
+
+void test_astar(int* test_failed) {
+    static double w[RANDOM_GRAPH_SIZE * RANDOM_GRAPH_SIZE];
+
+    for (int directed = 0; directed <= 1; directed++) {
+        c_graph_t* graph = build_random_graph(directed, 46 + directed, w);
+        c_graph_landmarks_t* landmarks = graph_landmarks_create(graph, 4);
+        ASSERT(landmarks != NULL, test_failed);
+
+        for (int s = 0; s < RANDOM_GRAPH_SIZE; s += 5) {
+            for (int t = 0; t < RANDOM_GRAPH_SIZE; t += 4) {
+                int expected_len = 0, plain_len = 0, alt_len = 0, jumpy_len = 0;
+                int* expected = graph_dijkstra(graph, s, t, &expected_len);
+                int* plain = graph_astar(graph, s, t, NULL, NULL, &plain_len);
+                int* alt = graph_astar(graph, s, t, graph_landmark_heuristic, landmarks, &alt_len);
+                int* jumpy = graph_astar(graph, s, t, jumpy_heuristic, NULL, &jumpy_len);
+
+                double cost = path_cost(w, expected, expected_len, s, t);
+                ASSERT((plain == NULL) == (expected == NULL), test_failed);
+                ASSERT((alt == NULL) == (expected == NULL), test_failed);
+                ASSERT((jumpy == NULL) == (expected == NULL), test_failed);
+                if (expected) {
+                    ASSERT(path_cost(w, plain, plain_len, s, t) == cost, test_failed);
+                    ASSERT(path_cost(w, alt, alt_len, s, t) == cost, test_failed);
+                    ASSERT(path_cost(w, jumpy, jumpy_len, s, t) == cost, test_failed);
+                    // Landmark bounds never exceed the true distance
+                    ASSERT(graph_landmark_heuristic(s, t, landmarks) <= cost, test_failed);
+                }
+                free(expected);
+                free(plain);
+                free(alt);
+                free(jumpy);
+            }
+        }
+        graph_landmarks_destroy(landmarks);
+        graph_destroy(graph);
+    }
+
+    // Coordinate heuristic on a grid with unit-or-longer edges
+    int side = 12;
+    c_graph_t* grid = graph_create(0);
+    for (int i = 0; i < side * side; i++) graph_add_vertex(grid, i);
+    for (int i = 0; i < side * side; i++) {
+        if (i % side + 1 < side) graph_add_edge(grid, i, i + 1, 1 + (i % 3));
+        if (i + side < side * side) graph_add_edge(grid, i, i + side, 1 + (i % 2));
+    }
+    int len = 0, expected_len = 0;
+    int* expected = graph_dijkstra(grid, 0, side * side - 1, &expected_len);
+    int* path = graph_astar(grid, 0, side * side - 1, grid_distance, &side, &len);
+    ASSERT(path && expected && path[0] == 0 && path[len - 1] == side * side - 1, test_failed);
+    free(expected);
+    free(path);
+
+    ASSERT(graph_astar(grid, 0, side * side, NULL, NULL, &len) == NULL && len == 0, test_failed);
+    ASSERT(graph_landmarks_create(grid, 0) == NULL, test_failed);
+    graph_destroy(grid);
+}
+
+/* Writes a two-vertex hierarchy file with at most one edge in each array, all stored at vertex 0 */
+static void write_small_ch(const char* filename, const int rank[2], int out_node, int out_middle,
+                           int in_node, int in_middle) {
+    FILE* file = fopen(filename, "wb");
+    if (!file) return;
+    int n = 2;
+    unsigned char present[2] = {1, 1};
+    double weight = 1;
+    fwrite("DSACH001", 1, 8, file);
+    fwrite(&n, sizeof(int), 1, file);
+    fwrite(present, 1, 2, file);
+    fwrite(rank, sizeof(int), 2, file);
+    int nodes[2] = {out_node, in_node};
+    int middles[2] = {out_middle, in_middle};
+    for (int side = 0; side < 2; side++) {
+        int m = nodes[side] >= 0 ? 1 : 0;
+        int offsets[3] = {0, m, m};
+        fwrite(&m, sizeof(int), 1, file);
+        fwrite(offsets, sizeof(int), 3, file);
+        fwrite(&nodes[side], sizeof(int), m, file);
+        fwrite(&middles[side], sizeof(int), m, file);
+        fwrite(&weight, sizeof(double), m, file);
+    }
+    fclose(file);
+}
+
+void test_contraction_hierarchy(int* test_failed) {
+    static double w[RANDOM_GRAPH_SIZE * RANDOM_GRAPH_SIZE];
+    const char* filename = "test_graph_ch.bin";
+
+    for (int directed = 0; directed <= 1; directed++) {
+        c_graph_t* graph = build_random_graph(directed, 47 + directed, w);
+        c_graph_ch_t* ch = graph_ch_build(graph, 1);
+        c_graph_ch_t* parallel = graph_ch_build(graph, 3);
+        ASSERT(ch != NULL && parallel != NULL, test_failed);
+        ASSERT(graph_ch_save(parallel, filename) == 0, test_failed);
+        c_graph_ch_t* loaded = graph_ch_load(filename);
+        ASSERT(loaded != NULL, test_failed);
+
+        c_graph_ch_t* hierarchies[3] = {ch, parallel, loaded};
+        for (int s = 0; s < RANDOM_GRAPH_SIZE; s += 3) {
+            for (int t = 0; t < RANDOM_GRAPH_SIZE; t++) {
+                int expected_len = 0;
+                int* expected = graph_dijkstra(graph, s, t, &expected_len);
+                double cost = path_cost(w, expected, expected_len, s, t);
+                for (int h = 0; h < 3; h++) {
+                    int len = 0;
+                    int* path = graph_ch_query(hierarchies[h], s, t, &len);
+                    ASSERT((path == NULL) == (expected == NULL), test_failed);
+                    if (path) {
+                        ASSERT(path_cost(w, path, len, s, t) == cost, test_failed);
+                    } else {
+                        ASSERT(len == 0, test_failed);
+                    }
+                    free(path);
+                }
+                free(expected);
+            }
+        }
+        graph_ch_destroy(ch);
+        graph_ch_destroy(parallel);
+        graph_ch_destroy(loaded);
+        graph_destroy(graph);
+    }
+
+    // Gaps in the id range, a trivial query and invalid ids
+    c_graph_t* graph = graph_create(1);
+    graph_add_vertex(graph, 0);
+    graph_add_vertex(graph, 2);
+    graph_add_vertex(graph, 5);
+    graph_add_edge(graph, 0, 2, 1);
+    graph_add_edge(graph, 2, 5, 1);
+    graph_add_edge(graph, 0, 5, 3);
+    c_graph_ch_t* ch = graph_ch_build(graph, 0);
+    ASSERT(ch != NULL, test_failed);
+    int len = 0;
+    int* path = graph_ch_query(ch, 0, 5, &len);
+    ASSERT(path && len == 3 && path[1] == 2, test_failed);
+    free(path);
+    path = graph_ch_query(ch, 2, 2, &len);
+    ASSERT(path && len == 1 && path[0] == 2, test_failed);
+    free(path);
+    ASSERT(graph_ch_query(ch, 5, 0, &len) == NULL && len == 0, test_failed);
+    ASSERT(graph_ch_query(ch, 1, 5, &len) == NULL && len == 0, test_failed);
+    ASSERT(graph_ch_query(ch, 0, 9, &len) == NULL && len == 0, test_failed);
+    graph_ch_destroy(ch);
+    graph_destroy(graph);
+
+    // A truncated file is rejected
+    FILE* file = fopen(filename, "wb");
+    ASSERT(file != NULL, test_failed);
+    fwrite("DSACH001", 1, 8, file);
+    fclose(file);
+    ASSERT(graph_ch_load(filename) == NULL, test_failed);
+
+    // Files that read fully but break the rank invariants are rejected
+    int ranked[2] = {0, 1};
+    int duplicate[2] = {0, 0};
+    int reversed[2] = {1, 0};
+    write_small_ch(filename, ranked, 1, -1, -1, -1);
+    ch = graph_ch_load(filename);
+    ASSERT(ch != NULL, test_failed);
+    path = graph_ch_query(ch, 0, 1, &len);
+    ASSERT(path && len == 2, test_failed);
+    free(path);
+    graph_ch_destroy(ch);
+    write_small_ch(filename, duplicate, 1, -1, -1, -1);
+    ASSERT(graph_ch_load(filename) == NULL, test_failed);
+    write_small_ch(filename, reversed, 1, -1, -1, -1);
+    ASSERT(graph_ch_load(filename) == NULL, test_failed);
+    // A shortcut through its own start, whose halves would unpack into itself forever
+    write_small_ch(filename, ranked, 1, 0, 0, -1);
+    ASSERT(graph_ch_load(filename) == NULL, test_failed);
+    remove(filename);
+    ASSERT(graph_ch_load("missing_graph_ch.bin") == NULL, test_failed);
+    ASSERT(graph_ch_build(NULL, 1) == NULL, test_failed);
+}
+
+void test_distance_matrix(int* test_failed) {
+    static double w[RANDOM_GRAPH_SIZE * RANDOM_GRAPH_SIZE];
+    int sources[] = {0, 5, 17, 33, 59, 5};
+    int targets[] = {1, 2, 8, 13, 21, 34, 55, 0, 2};
+    int n = sizeof(sources) / sizeof(sources[0]);
+    int m = sizeof(targets) / sizeof(targets[0]);
+    double out[sizeof(sources) / sizeof(sources[0]) * sizeof(targets) / sizeof(targets[0])];
+
+    for (int directed = 0; directed <= 1; directed++) {
+        c_graph_t* graph = build_random_graph(directed, 48 + directed, w);
+        ASSERT(graph_distance_matrix(graph, sources, n, targets, m, out) == 0, test_failed);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < m; j++) {
+                int len = 0;
+                int* path = graph_dijkstra(graph, sources[i], targets[j], &len);
+                double expected = path ? path_cost(w, path, len, sources[i], targets[j]) : DBL_MAX;
+                ASSERT(out[i * m + j] == expected, test_failed);
+                free(path);
+            }
+        }
+        graph_destroy(graph);
+    }
+
+    // Unreachable targets, empty inputs and invalid ids
+    c_graph_t* graph = graph_create(1);
+    for (int i = 0; i < 3; i++) graph_add_vertex(graph, i);
+    graph_add_edge(graph, 0, 1, 2.5);
+    int from[] = {0, 1};
+    int to[] = {1, 2, 0};
+    double small[6];
+    ASSERT(graph_distance_matrix(graph, from, 2, to, 3, small) == 0, test_failed);
+    ASSERT(small[0] == 2.5 && small[1] == DBL_MAX && small[2] == 0, test_failed);
+    ASSERT(small[3] == 0 && small[4] == DBL_MAX && small[5] == DBL_MAX, test_failed);
+    ASSERT(graph_distance_matrix(graph, from, 0, to, 3, small) == 0, test_failed);
+    int bad[] = {7};
+    ASSERT(graph_distance_matrix(graph, bad, 1, to, 3, small) == -1, test_failed);
+    ASSERT(graph_distance_matrix(graph, from, 2, bad, 1, small) == -1, test_failed);
+    ASSERT(graph_distance_matrix(NULL, from, 2, to, 3, small) == -1, test_failed);
+    graph_destroy(graph);
+}
+
+void test_shortest_path_tree(int* test_failed) {
+    static double w[RANDOM_GRAPH_SIZE * RANDOM_GRAPH_SIZE];
+
+    for (int directed = 0; directed <= 1; directed++) {
+        c_graph_t* graph = build_random_graph(directed, 49 + directed, w);
+        for (int s = 0; s < RANDOM_GRAPH_SIZE; s += 11) {
+            c_graph_spt_t* tree = graph_spt_dijkstra(graph, s);
+            c_graph_spt_t* hops = graph_spt_bfs(graph, s);
+            ASSERT(tree && hops && graph_spt_source(tree) == s, test_failed);
+            ASSERT(graph_spt_distance(tree, s) == 0 && graph_spt_parent(tree, s) == -1, test_failed);
+
+            for (int t = 0; t < RANDOM_GRAPH_SIZE; t++) {
+                int expected_len = 0, len = 0, bfs_len = 0, hop_len = 0;
+                int* expected = graph_dijkstra(graph, s, t, &expected_len);
+                int* path = graph_spt_path(tree, t, &len);
+                int* bfs = graph_bfs(graph, s, t, &bfs_len);
+                int* hop_path = graph_spt_path(hops, t, &hop_len);
+                ASSERT((path == NULL) == (expected == NULL), test_failed);
+                ASSERT((hop_path == NULL) == (expected == NULL), test_failed);
+                if (expected) {
+                    double cost = path_cost(w, expected, expected_len, s, t);
+                    ASSERT(path_cost(w, path, len, s, t) == cost, test_failed);
+                    ASSERT(graph_spt_distance(tree, t) == cost, test_failed);
+                    ASSERT(len == 1 || graph_spt_parent(tree, t) == path[len - 2], test_failed);
+                    ASSERT(path_cost(w, hop_path, hop_len, s, t) >= 0, test_failed);
+                    ASSERT(hop_len == bfs_len && graph_spt_distance(hops, t) == hop_len - 1, test_failed);
+                } else {
+                    ASSERT(len == 0 && graph_spt_distance(tree, t) == DBL_MAX, test_failed);
+                    ASSERT(graph_spt_parent(tree, t) == -1, test_failed);
+                }
+                free(expected);
+                free(path);
+                free(bfs);
+                free(hop_path);
+            }
+            graph_spt_destroy(tree);
+            graph_spt_destroy(hops);
+        }
+        graph_destroy(graph);
+    }
+
+    c_graph_t* graph = graph_create(1);
+    graph_add_vertex(graph, 0);
+    graph_add_vertex(graph, 1);
+    c_graph_spt_t* tree = graph_spt_dijkstra(graph, 0);
+    int len = 0;
+    ASSERT(tree != NULL, test_failed);
+    ASSERT(graph_spt_path(tree, 1, &len) == NULL && len == 0, test_failed);
+    ASSERT(graph_spt_path(tree, 5, &len) == NULL && len == 0, test_failed);
+    ASSERT(graph_spt_distance(tree, -1) == DBL_MAX && graph_spt_parent(tree, 9) == -1, test_failed);
+    graph_spt_destroy(tree);
+    ASSERT(graph_spt_dijkstra(graph, 4) == NULL && graph_spt_bfs(graph, -1) == NULL, test_failed);
+    ASSERT(graph_spt_dijkstra(NULL, 0) == NULL, test_failed);
+    graph_destroy(graph);
+}
+
+void test_delta_stepping(int* test_failed) {
+    static double w[RANDOM_GRAPH_SIZE * RANDOM_GRAPH_SIZE];
+    double deltas[] = {0, 0.5, 3, 1000};
+    int thread_counts[] = {1, 4};
+
+    for (int directed = 0; directed <= 1; directed++) {
+        c_graph_t* graph = build_random_graph(directed, 50 + directed, w);
+        for (int s = 0; s < RANDOM_GRAPH_SIZE; s += 13) {
+            c_graph_spt_t* expected = graph_spt_dijkstra(graph, s);
+            ASSERT(expected != NULL, test_failed);
+            for (int d = 0; d < 4; d++) {
+                for (int t = 0; t < 2; t++) {
+                    c_graph_spt_t* tree = graph_spt_delta_stepping(graph, s, deltas[d], thread_counts[t]);
+                    ASSERT(tree && graph_spt_source(tree) == s, test_failed);
+                    for (int v = 0; v < RANDOM_GRAPH_SIZE; v++) {
+                        double dist = graph_spt_distance(tree, v);
+                        ASSERT(dist == graph_spt_distance(expected, v), test_failed);
+                        int len = 0;
+                        int* path = graph_spt_path(tree, v, &len);
+                        ASSERT(dist == DBL_MAX ? path == NULL : path_cost(w, path, len, s, v) == dist, test_failed);
+                        free(path);
+                    }
+                    graph_spt_destroy(tree);
+                }
+            }
+            graph_spt_destroy(expected);
+        }
+        graph_destroy(graph);
+    }
+
+    // Zero-weight cycle: parents must still lead back to the source
+    c_graph_t* graph = graph_create(1);
+    for (int i = 0; i < 4; i++) graph_add_vertex(graph, i);
+    graph_add_edge(graph, 0, 1, 2);
+    graph_add_edge(graph, 1, 2, 0);
+    graph_add_edge(graph, 2, 1, 0);
+    graph_add_edge(graph, 2, 3, 0);
+    c_graph_spt_t* tree = graph_spt_delta_stepping(graph, 0, 1, 2);
+    int len = 0;
+    int* path = graph_spt_path(tree, 3, &len);
+    ASSERT(path && len == 4 && path[0] == 0 && graph_spt_distance(tree, 3) == 2, test_failed);
+    free(path);
+    graph_spt_destroy(tree);
+    ASSERT(graph_spt_delta_stepping(graph, 9, 1, 2) == NULL, test_failed);
+    graph_destroy(graph);
+
+    // A tiny delta against heavy edges must not size buckets by total distance
+    graph = graph_create(1);
+    for (int i = 0; i < 3; i++) graph_add_vertex(graph, i);
+    graph_add_edge(graph, 0, 1, 1e6);
+    graph_add_edge(graph, 1, 2, 1);
+    tree = graph_spt_delta_stepping(graph, 0, 1e-3, 2);
+    ASSERT(tree && graph_spt_distance(tree, 2) == 1000001, test_failed);
+    graph_spt_destroy(tree);
+    graph_destroy(graph);
+
+    // A long chain wraps around the bucket ring many times
+    graph = graph_create(1);
+    for (int i = 0; i < 200; i++) graph_add_vertex(graph, i);
+    for (int i = 0; i + 1 < 200; i++) {
+        graph_add_edge(graph, i, i + 1, (i % 2) ? 0.5 : 7);
+        if (i + 3 < 200) graph_add_edge(graph, i, i + 3, 20);
+    }
+    c_graph_spt_t* expected = graph_spt_dijkstra(graph, 0);
+    tree = graph_spt_delta_stepping(graph, 0, 0.25, 4);
+    ASSERT(tree && expected, test_failed);
+    for (int v = 0; tree && expected && v < 200; v++) {
+        ASSERT(graph_spt_distance(tree, v) == graph_spt_distance(expected, v), test_failed);
+    }
+    graph_spt_destroy(tree);
+    graph_spt_destroy(expected);
+    graph_destroy(graph);
+}
@@ -35,6 +35,12 @@ void test_dfs_traversal(int* test_failed);
 void test_dijkstra_shortest_path(int* test_failed);
 void test_remove_operations(int* test_failed);
 void test_duplicate_vertex(int* test_failed);
+void test_bidirectional_dijkstra(int* test_failed);
+void test_astar(int* test_failed);
+void test_contraction_hierarchy(int* test_failed);
+void test_distance_matrix(int* test_failed);
+void test_shortest_path_tree(int* test_failed);
+void test_delta_stepping(int* test_failed);
 
 int main() {
     register_test(test_graph_creation, "Graph Creation");
@@ -44,6 +50,12 @@ int main() {
     register_test(test_dijkstra_shortest_path, "Dijkstra Shortest Path");
     register_test(test_remove_operations, "Remove Operations");
     register_test(test_duplicate_vertex, "Duplicate Vertex");
+    register_test(test_bidirectional_dijkstra, "Bidirectional Dijkstra");
+    register_test(test_astar, "A* and ALT Landmarks");
+    register_test(test_contraction_hierarchy, "Contraction Hierarchies");
+    register_test(test_distance_matrix, "Distance Matrix");
+    register_test(test_shortest_path_tree, "Shortest Path Tree");
+    register_test(test_delta_stepping, "Delta-Stepping");
 
     int passed = 0;
     for (int i = 0; i < test_count; i++) {
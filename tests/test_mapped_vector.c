@@ -0,0 +1,89 @@
+#include "include/c_mapped_vector.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define NUM_ELEMENTS 100000
+
+// Unique scratch file for this run
+void make_path(char *path, size_t len) {
+    snprintf(path, len, "/tmp/test_mapped_vector_%d.bin", (int)getpid());
+    unlink(path);
+}
+
+void test_create_and_grow(const char *path) {
+    printf("Testing create and growth...\n");
+
+    MappedVector *vec = open_mapped_vector(path, 4);
+    assert(vec != NULL);
+    assert(mapped_current_size(vec) == 0);
+    assert(mapped_current_capacity(vec) == 4);
+
+    for (int i = 0; i < NUM_ELEMENTS; i++) {
+        assert(mapped_add_at_end(vec, i * 3) == 1);
+    }
+    assert(mapped_current_size(vec) == NUM_ELEMENTS);
+    assert(mapped_current_capacity(vec) >= NUM_ELEMENTS);
+    assert(mapped_get_value_at_index(vec, 12345) == 12345 * 3);
+    assert(mapped_get_value_at_index(vec, NUM_ELEMENTS) == -1);
+    printf("✓ Appends grow the file with ftruncate + mremap\n");
+
+    assert(mapped_vector_sync(vec) == 1);
+    close_mapped_vector(vec);
+}
+
+void test_reopen(const char *path) {
+    printf("\nTesting reopen...\n");
+
+    MappedVector *vec = open_mapped_vector(path, 1);
+    assert(vec != NULL);
+    assert(mapped_current_size(vec) == NUM_ELEMENTS);
+    for (int i = 0; i < NUM_ELEMENTS; i += 997) {
+        assert(mapped_get_value_at_index(vec, i) == i * 3);
+    }
+    printf("✓ Contents persist across close/open\n");
+
+    assert(mapped_remove_at_end(vec) == (NUM_ELEMENTS - 1) * 3);
+    assert(mapped_set_at_index(vec, 0, -1) == vec);
+    assert(mapped_get_value_at_index(vec, 0) == -1);
+    assert(mapped_get_value_at_index(vec, 1) == 0);
+    assert(mapped_current_size(vec) == NUM_ELEMENTS);
+    printf("✓ Remove and set_at_index work on a reopened vector\n");
+
+    Vector view;
+    assert(mapped_vector_view(vec, &view) == 1);
+    assert(current_size(&view) == NUM_ELEMENTS);
+    assert(get_value_at_index(&view, 2) == 3);
+    printf("✓ Vector view exposes the mapped elements to Vector accessors\n");
+
+    close_mapped_vector(vec);
+}
+
+void test_invalid_file(const char *path) {
+    printf("\nTesting invalid files...\n");
+
+    FILE *file = fopen(path, "wb");
+    fputs("this is not a mapped vector, just some text that is long enough", file);
+    fclose(file);
+
+    assert(open_mapped_vector(path, 4) == NULL);
+    assert(open_mapped_vector(NULL, 4) == NULL);
+    printf("✓ Files without a valid header are rejected\n");
+}
+
+int main() {
+    printf("=== Mapped Vector Test Suite ===\n\n");
+
+    char path[128];
+    make_path(path, sizeof(path));
+
+    test_create_and_grow(path);
+    test_reopen(path);
+    test_invalid_file(path);
+
+    unlink(path);
+    printf("\n=== All tests passed! ===\n");
+
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include "include/ordered_map.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Checks ordering, heights and the AVL balance invariant; returns the node count
+int check_map(OrderedMapNode *root, long long low, long long high) {
+    if (root == NULL) return 0;
+    int key = root->avl.value;
+    assert(key > low && key < high);
+    assert(root->count >= 1);
+
+    int left = avl_height(root->avl.left);
+    int right = avl_height(root->avl.right);
+    assert(root->avl.height == 1 + (left > right ? left : right));
+    assert(left - right >= -1 && left - right <= 1);
+
+    return 1 + check_map((OrderedMapNode *)root->avl.left, low, key) +
+           check_map((OrderedMapNode *)root->avl.right, key, high);
+}
+
+int check_all(OrderedMap *map) {
+    return check_map(map->root, -2147483649LL, 2147483648LL);
+}
+
+void test_map_mode() {
+    printf("Testing map mode...\n");
+
+    OrderedMap *map = create_ordered_map(0);
+    char *one = "one", *two = "two", *uno = "uno";
+    void *old = one;
+    assert(ordered_map_put(map, 1, one, NULL) == 1);
+    assert(ordered_map_put(map, 2, two, NULL) == 1);
+    assert(ordered_map_put(map, 3, NULL, &old) == 1 && old == NULL);
+    assert(ordered_map_get(map, 1) == one);
+    assert(ordered_map_get(map, 2) == two);
+    assert(ordered_map_get(map, 3) == NULL && ordered_map_find(map, 3) != NULL);
+    assert(ordered_map_find(map, 4) == NULL);
+    printf("✓ Put and get work, NULL values are distinguishable via find\n");
+
+    assert(ordered_map_put(map, 1, uno, &old) == 0 && old == one);
+    assert(ordered_map_get(map, 1) == uno);
+    assert(ordered_map_count(map, 1) == 1);
+    assert(ordered_map_size(map) == 3 && ordered_map_total(map) == 3);
+    printf("✓ Putting an existing key replaces its value and returns the old one\n");
+
+    void *removed = NULL;
+    assert(ordered_map_remove(map, 2, &removed) == 1 && removed == two);
+    assert(ordered_map_remove(map, 2, &removed) == 0);
+    assert(ordered_map_size(map) == 2 && ordered_map_total(map) == 2);
+    printf("✓ Remove returns the stored value\n");
+
+    assert(ordered_map_put(NULL, 1, NULL, NULL) == -1);
+    assert(ordered_map_get(NULL, 1) == NULL);
+    assert(ordered_map_size(NULL) == -1);
+    printf("✓ NULL map is handled\n");
+
+    destroy_ordered_map(map, NULL);
+}
+
+void test_multiset_mode() {
+    printf("\nTesting multiset mode...\n");
+
+    OrderedMap *map = create_ordered_map(1);
+    assert(ordered_map_put(map, 7, NULL, NULL) == 1);
+    for (int i = 0; i < 999; i++) assert(ordered_map_put(map, 7, NULL, NULL) == 0);
+    assert(ordered_map_put(map, 8, NULL, NULL) == 1);
+    assert(ordered_map_count(map, 7) == 1000);
+    assert(ordered_map_count(map, 9) == 0);
+    assert(ordered_map_size(map) == 2 && ordered_map_total(map) == 1001);
+    assert(check_all(map) == 2);
+    printf("✓ 1000 copies of a key take one node\n");
+
+    for (int i = 0; i < 999; i++) assert(ordered_map_remove(map, 7, NULL) == 1);
+    assert(ordered_map_count(map, 7) == 1 && ordered_map_size(map) == 2);
+    assert(ordered_map_remove(map, 7, NULL) == 1);
+    assert(ordered_map_find(map, 7) == NULL && ordered_map_size(map) == 1);
+    assert(ordered_map_total(map) == 1);
+    printf("✓ Removes decrement the count and drop the node at zero\n");
+
+    destroy_ordered_map(map, NULL);
+}
+
+typedef struct {
+    int keys[64];
+    long long counts[64];
+    int n;
+} collected;
+
+void collect(int key, void *value, long long count, void *context) {
+    collected *out = context;
+    assert(value == NULL); // test_range stores no payloads
+    out->keys[out->n] = key;
+    out->counts[out->n] = count;
+    out->n++;
+}
+
+void test_range() {
+    printf("\nTesting ordered_map_range...\n");
+
+    OrderedMap *map = create_ordered_map(1);
+    for (int i = 0; i < 40; i++) ordered_map_put(map, (i * 7) % 20 - 10, NULL, NULL);
+
+    collected out = {{0}, {0}, 0};
+    assert(ordered_map_range(map, -10, 9, collect, &out) == 20);
+    for (int i = 0; i < 20; i++) {
+        assert(out.keys[i] == i - 10);
+        assert(out.counts[i] == 2);
+    }
+    assert(ordered_map_range(map, 0, 4, NULL, NULL) == 5);
+    assert(ordered_map_range(map, 5, 0, NULL, NULL) == 0);
+    printf("✓ Range visits keys in order with their counts\n");
+
+    destroy_ordered_map(map, NULL);
+}
+
+void test_owned_values() {
+    printf("\nTesting destroy with a free function...\n");
+
+    OrderedMap *map = create_ordered_map(0);
+    for (int i = 0; i < 1000; i++) {
+        int *payload = malloc(sizeof(int));
+        *payload = i * i;
+        ordered_map_put(map, i, payload, NULL);
+    }
+    assert(*(int *)ordered_map_get(map, 30) == 900);
+
+    // Replaced payloads come back to the caller, so none leak
+    int *replacement = malloc(sizeof(int));
+    *replacement = -1;
+    void *old = NULL;
+    assert(ordered_map_put(map, 30, replacement, &old) == 0 && *(int *)old == 900);
+    free(old);
+    assert(*(int *)ordered_map_get(map, 30) == -1);
+
+    void *removed;
+    assert(ordered_map_remove(map, 30, &removed) == 1);
+    free(removed);
+    assert(check_all(map) == 999);
+    destroy_ordered_map(map, free);
+    printf("✓ Values are handed to the free function\n");
+}
+
+void test_random_operations() {
+    printf("\nTesting random operations against a reference array...\n");
+
+    srand(44);
+    int range = 500;
+    long long counts[500] = {0};
+    OrderedMap *map = create_ordered_map(1);
+
+    for (int step = 0; step < 200000; step++) {
+        int key = rand() % range;
+        if (rand() % 3 == 0) {
+            assert(ordered_map_remove(map, key, NULL) == (counts[key] > 0));
+            if (counts[key] > 0) counts[key]--;
+        } else {
+            assert(ordered_map_put(map, key, NULL, NULL) == (counts[key] == 0));
+            counts[key]++;
+        }
+    }
+
+    long long size = 0, total = 0;
+    for (int k = 0; k < range; k++) {
+        assert(ordered_map_count(map, k) == counts[k]);
+        size += counts[k] > 0;
+        total += counts[k];
+    }
+    assert(ordered_map_size(map) == size && ordered_map_total(map) == total);
+    assert(check_all(map) == size);
+    printf("✓ 200000 random operations match the reference\n");
+
+    destroy_ordered_map(map, NULL);
+}
+
+int main() {
+    printf("=== Ordered Map Test Suite ===\n\n");
+
+    test_map_mode();
+    test_multiset_mode();
+    test_range();
+    test_owned_values();
+    test_random_operations();
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
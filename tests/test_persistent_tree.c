@@ -0,0 +1,273 @@
+#include "include/persistent_tree.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+// Checks ordering, stored heights and the AVL balance invariant; returns the node count
+int check_version(PersistentNode *root, long long low, long long high) {
+    if (root == NULL) return 0;
+    assert(root->value >= low && root->value <= high);
+    assert(atomic_load(&root->refs) >= 1);
+
+    int left = root->left ? root->left->height : 0;
+    int right = root->right ? root->right->height : 0;
+    assert(root->height == 1 + (left > right ? left : right));
+    assert(left - right >= -1 && left - right <= 1);
+
+    return 1 + check_version(root->left, low, root->value) + check_version(root->right, root->value, high);
+}
+
+void test_insert_and_search() {
+    printf("Testing persistent_insert and persistent_search...\n");
+
+    PersistentTree *empty = create_persistent_tree();
+    assert(empty != NULL && persistent_size(empty) == 0 && persistent_height(empty) == 0);
+
+    PersistentTree *one = persistent_insert(empty, 50);
+    PersistentTree *two = persistent_insert(one, 30);
+    PersistentTree *three = persistent_insert(two, 70);
+
+    assert(persistent_search(three, 30) != NULL);
+    assert(persistent_search(three, 30)->value == 30);
+    assert(persistent_search(three, 99) == NULL);
+    assert(persistent_search(NULL, 1) == NULL);
+    assert(check_version(three->root, -2147483648LL, 2147483647LL) == 3);
+
+    // Older versions are unchanged
+    assert(persistent_size(empty) == 0 && persistent_search(empty, 50) == NULL);
+    assert(persistent_size(one) == 1 && persistent_search(one, 30) == NULL);
+    assert(persistent_size(two) == 2 && persistent_search(two, 70) == NULL);
+    printf("✓ Each insert yields a new version and leaves the old ones intact\n");
+
+    destroy_persistent_tree(empty);
+    destroy_persistent_tree(one);
+    destroy_persistent_tree(two);
+    destroy_persistent_tree(three);
+}
+
+void test_structural_sharing() {
+    printf("\nTesting structural sharing between versions...\n");
+
+    int n = 1 << 16;
+    PersistentTree *base = create_persistent_tree();
+    for (int i = 0; i < n; i++) {
+        PersistentTree *next = persistent_insert(base, i);
+        destroy_persistent_tree(base);
+        base = next;
+    }
+    assert(check_version(base->root, 0, n) == n);
+    assert(persistent_height(base) <= 24);
+
+    // The root has exactly one owner until a snapshot takes another reference
+    assert(atomic_load(&base->root->refs) == 1);
+    PersistentTree *snapshot = persistent_snapshot(base);
+    assert(snapshot->root == base->root && atomic_load(&base->root->refs) == 2);
+    assert(persistent_size(snapshot) == n);
+
+    // An update copies only the search path; the subtree on the other side is shared
+    PersistentTree *updated = persistent_insert(base, n);
+    assert(updated->root != base->root);
+    assert(updated->root->left == base->root->left);
+    assert(atomic_load(&base->root->left->refs) == 2);
+    printf("✓ Snapshot is O(1) and an update shares all untouched subtrees\n");
+
+    // Dropping the source keeps shared nodes alive for the other versions
+    destroy_persistent_tree(base);
+    assert(atomic_load(&snapshot->root->refs) == 1);
+    assert(check_version(snapshot->root, 0, n) == n);
+    assert(check_version(updated->root, 0, n) == n + 1);
+    printf("✓ Versions outlive the version they were derived from\n");
+
+    destroy_persistent_tree(snapshot);
+    destroy_persistent_tree(updated);
+}
+
+void test_delete() {
+    printf("\nTesting persistent_delete...\n");
+
+    PersistentTree *version = create_persistent_tree();
+    for (int i = 0; i < 1000; i++) {
+        PersistentTree *next = persistent_insert(version, i);
+        destroy_persistent_tree(version);
+        version = next;
+    }
+
+    int deleted = -1;
+    PersistentTree *removed = persistent_delete(version, 500, &deleted);
+    assert(deleted == 1 && persistent_size(removed) == 999);
+    assert(persistent_search(removed, 500) == NULL);
+    assert(persistent_search(version, 500) != NULL);
+    assert(check_version(removed->root, 0, 1000) == 999);
+
+    PersistentTree *missing = persistent_delete(removed, 500, &deleted);
+    assert(deleted == 0 && missing->root == removed->root);
+    printf("✓ Delete leaves the source version intact\n");
+
+    // Remove everything, every other version is kept until the end
+    PersistentTree *current = persistent_snapshot(version);
+    for (int i = 0; i < 1000; i += 2) {
+        PersistentTree *next = persistent_delete(current, i, &deleted);
+        assert(deleted == 1);
+        destroy_persistent_tree(current);
+        current = next;
+    }
+    for (int i = 999; i > 0; i -= 2) {
+        PersistentTree *next = persistent_delete(current, i, &deleted);
+        assert(deleted == 1);
+        assert(check_version(next->root, 0, 1000) == persistent_size(next));
+        destroy_persistent_tree(current);
+        current = next;
+    }
+    assert(persistent_size(current) == 0 && current->root == NULL);
+    assert(check_version(version->root, 0, 1000) == 1000);
+    printf("✓ Draining one version does not affect another\n");
+
+    destroy_persistent_tree(version);
+    destroy_persistent_tree(removed);
+    destroy_persistent_tree(missing);
+    destroy_persistent_tree(current);
+}
+
+void test_duplicates() {
+    printf("\nTesting duplicate values...\n");
+
+    PersistentTree *version = create_persistent_tree();
+    for (int i = 0; i < 5; i++) {
+        PersistentTree *next = persistent_insert(version, 7);
+        destroy_persistent_tree(version);
+        version = next;
+    }
+    assert(persistent_size(version) == 5);
+
+    int deleted;
+    for (int i = 4; i >= 0; i--) {
+        PersistentTree *next = persistent_delete(version, 7, &deleted);
+        assert(deleted == 1 && persistent_size(next) == i);
+        assert((persistent_search(next, 7) != NULL) == (i > 0));
+        destroy_persistent_tree(version);
+        version = next;
+    }
+    printf("✓ Each delete removes one occurrence\n");
+
+    destroy_persistent_tree(version);
+}
+
+typedef struct {
+    PersistentTree *snapshot;
+    int n;
+    long long found;
+} reader_args;
+
+void *reader(void *arg) {
+    reader_args *args = arg;
+    for (int round = 0; round < 20; round++) {
+        for (int i = 0; i < args->n; i++) {
+            if (persistent_search(args->snapshot, i) != NULL) args->found++;
+        }
+    }
+    destroy_persistent_tree(args->snapshot);
+    return NULL;
+}
+
+void test_concurrent_readers() {
+    printf("\nTesting readers on snapshots while a writer continues...\n");
+
+    int n = 4096;
+    PersistentTree *current = create_persistent_tree();
+    for (int i = 0; i < n; i++) {
+        PersistentTree *next = persistent_insert(current, i);
+        destroy_persistent_tree(current);
+        current = next;
+    }
+
+    // Each reader owns a snapshot and destroys it itself
+    pthread_t threads[4];
+    reader_args args[4];
+    for (int t = 0; t < 4; t++) {
+        args[t].snapshot = persistent_snapshot(current);
+        args[t].n = n;
+        args[t].found = 0;
+        pthread_create(&threads[t], NULL, reader, &args[t]);
+    }
+
+    // Writer deletes everything and drops old versions concurrently
+    int deleted;
+    for (int i = 0; i < n; i++) {
+        PersistentTree *next = persistent_delete(current, i, &deleted);
+        assert(deleted == 1);
+        destroy_persistent_tree(current);
+        current = next;
+    }
+
+    for (int t = 0; t < 4; t++) {
+        pthread_join(threads[t], NULL);
+        assert(args[t].found == 20LL * n);
+    }
+    assert(persistent_size(current) == 0);
+    printf("✓ Readers see their full snapshot while the writer empties the tree\n");
+
+    destroy_persistent_tree(current);
+}
+
+void test_random_operations() {
+    printf("\nTesting random operations against a reference array...\n");
+
+    srand(41);
+    int range = 2000;
+    int counts[2000] = {0};
+    long long expected = 0;
+    PersistentTree *version = create_persistent_tree();
+    PersistentTree *kept[10] = {NULL};
+    long long kept_sizes[10];
+
+    for (int step = 0; step < 50000; step++) {
+        int value = rand() % range;
+        PersistentTree *next;
+        if (rand() % 3 == 0) {
+            int deleted;
+            next = persistent_delete(version, value, &deleted);
+            assert(deleted == (counts[value] > 0));
+            if (deleted) { counts[value]--; expected--; }
+        } else {
+            next = persistent_insert(version, value);
+            counts[value]++;
+            expected++;
+        }
+        assert(next != NULL);
+
+        // Keep a few old versions around to check they never change
+        if (step % 5000 == 0) {
+            int slot = step / 5000;
+            kept[slot] = persistent_snapshot(version);
+            kept_sizes[slot] = persistent_size(version);
+        }
+        destroy_persistent_tree(version);
+        version = next;
+    }
+
+    assert(persistent_size(version) == expected);
+    assert(check_version(version->root, 0, range) == expected);
+    for (int i = 0; i < range; i++) assert((persistent_search(version, i) != NULL) == (counts[i] > 0));
+    for (int slot = 0; slot < 10; slot++) {
+        assert(check_version(kept[slot]->root, 0, range) == kept_sizes[slot]);
+        destroy_persistent_tree(kept[slot]);
+    }
+    printf("✓ 50000 random operations match the reference\n");
+
+    destroy_persistent_tree(version);
+}
+
+int main() {
+    printf("=== Persistent Tree Test Suite ===\n\n");
+
+    test_insert_and_search();
+    test_structural_sharing();
+    test_delete();
+    test_duplicates();
+    test_concurrent_readers();
+    test_random_operations();
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
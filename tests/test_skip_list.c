@@ -0,0 +1,178 @@
+#include "include/skip_list.h"
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_THREADS 4
+#define KEY_RANGE 4096
+#define OPS_PER_THREAD 200000
+
+typedef struct {
+    SkipList *list;
+    int id;
+    long long net_inserts;
+} worker_args;
+
+void collect_key(int key, void *context) {
+    int **cursor = context;
+    **cursor = key;
+    (*cursor)++;
+}
+
+void test_single_thread() {
+    printf("Testing single-threaded use...\n");
+
+    SkipList *list = create_skip_list();
+    SkipListHandle *handle = skip_list_attach(list);
+    assert(handle != NULL);
+    assert(skip_list_search(handle, 1) == 0);
+    assert(skip_list_delete(handle, 1) == 0);
+
+    for (int i = 0; i < 1000; i++) assert(skip_list_insert(handle, (i * 37) % 1000) == 1);
+    assert(skip_list_insert(handle, 500) == 0); // Set semantics
+    assert(skip_list_size(list) == 1000);
+    for (int i = 0; i < 1000; i++) assert(skip_list_search(handle, i) == 1);
+    assert(skip_list_search(handle, 1000) == 0 && skip_list_search(handle, -1) == 0);
+    printf("✓ Insert and search work, duplicates are rejected\n");
+
+    for (int i = 0; i < 1000; i += 2) assert(skip_list_delete(handle, i) == 1);
+    assert(skip_list_delete(handle, 0) == 0);
+    assert(skip_list_size(list) == 500);
+    for (int i = 0; i < 1000; i++) assert(skip_list_search(handle, i) == (i % 2));
+    printf("✓ Delete removes exactly the requested keys\n");
+
+    int keys[1000];
+    int *cursor = keys;
+    assert(skip_list_range(handle, 100, 199, collect_key, &cursor) == 50);
+    for (int i = 0; i < 50; i++) assert(keys[i] == 101 + 2 * i);
+    assert(skip_list_range(handle, -100, 5000, NULL, NULL) == 500);
+    assert(skip_list_range(handle, 10, 5, NULL, NULL) == 0);
+    printf("✓ Range scans visit keys in ascending order\n");
+
+    skip_list_detach(handle);
+    destroy_skip_list(list);
+}
+
+void test_handles() {
+    printf("\nTesting handle management...\n");
+
+    SkipList *list = create_skip_list();
+    SkipListHandle *handles[SKIP_LIST_MAX_THREADS];
+    for (int i = 0; i < SKIP_LIST_MAX_THREADS; i++) assert((handles[i] = skip_list_attach(list)) != NULL);
+    assert(skip_list_attach(list) == NULL);
+    skip_list_detach(handles[3]);
+    assert(skip_list_attach(list) == handles[3]);
+    printf("✓ Handles are limited to SKIP_LIST_MAX_THREADS and reused after detach\n");
+
+    for (int i = 0; i < SKIP_LIST_MAX_THREADS; i++) skip_list_detach(handles[i]);
+    destroy_skip_list(list);
+}
+
+void *mixed_worker(void *arg) {
+    worker_args *args = arg;
+    SkipListHandle *handle = skip_list_attach(args->list);
+    if (handle == NULL) abort();
+
+    unsigned int seed = 1234 + args->id;
+    for (int op = 0; op < OPS_PER_THREAD; op++) {
+        int key = rand_r(&seed) % KEY_RANGE;
+        int choice = rand_r(&seed) % 4;
+        if (choice == 0) args->net_inserts += skip_list_insert(handle, key);
+        else if (choice == 1) args->net_inserts -= skip_list_delete(handle, key);
+        else skip_list_search(handle, key);
+        if ((op & 1023) == 0) sched_yield(); // interleave threads on machines with few cores
+    }
+
+    skip_list_detach(handle);
+    return NULL;
+}
+
+void test_concurrent_mixed() {
+    printf("\nTesting %d threads with mixed insert/delete/search...\n", NUM_THREADS);
+
+    SkipList *list = create_skip_list();
+    pthread_t threads[NUM_THREADS];
+    worker_args args[NUM_THREADS];
+    for (int t = 0; t < NUM_THREADS; t++) {
+        args[t] = (worker_args){list, t, 0};
+        pthread_create(&threads[t], NULL, mixed_worker, &args[t]);
+    }
+
+    long long net = 0;
+    for (int t = 0; t < NUM_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+        net += args[t].net_inserts;
+    }
+
+    // Every successful insert and delete is accounted for exactly once
+    SkipListHandle *handle = skip_list_attach(list);
+    long long present = skip_list_range(handle, 0, KEY_RANGE, NULL, NULL);
+    assert(present == net);
+    assert(skip_list_size(list) == net);
+
+    int *keys = malloc(sizeof(int) * KEY_RANGE);
+    int *cursor = keys;
+    skip_list_range(handle, 0, KEY_RANGE, collect_key, &cursor);
+    for (long long i = 1; i < present; i++) assert(keys[i - 1] < keys[i]);
+    for (long long i = 0; i < present; i++) assert(skip_list_search(handle, keys[i]) == 1);
+    printf("✓ %lld keys remain, matching the successful inserts minus deletes\n", present);
+
+    free(keys);
+    skip_list_detach(handle);
+    destroy_skip_list(list);
+}
+
+void *disjoint_worker(void *arg) {
+    worker_args *args = arg;
+    SkipListHandle *handle = skip_list_attach(args->list);
+    if (handle == NULL) abort();
+
+    // Each thread owns the keys congruent to its id
+    for (int key = args->id; key < 100000; key += NUM_THREADS) {
+        if (skip_list_insert(handle, key) != 1) abort();
+    }
+    for (int key = args->id; key < 100000; key += 2 * NUM_THREADS) {
+        if (skip_list_delete(handle, key) != 1) abort();
+    }
+
+    skip_list_detach(handle);
+    return NULL;
+}
+
+void test_concurrent_disjoint() {
+    printf("\nTesting %d threads on interleaved key sets...\n", NUM_THREADS);
+
+    SkipList *list = create_skip_list();
+    pthread_t threads[NUM_THREADS];
+    worker_args args[NUM_THREADS];
+    for (int t = 0; t < NUM_THREADS; t++) {
+        args[t] = (worker_args){list, t, 0};
+        pthread_create(&threads[t], NULL, disjoint_worker, &args[t]);
+    }
+    for (int t = 0; t < NUM_THREADS; t++) pthread_join(threads[t], NULL);
+
+    SkipListHandle *handle = skip_list_attach(list);
+    for (int key = 0; key < 100000; key++) {
+        int expected = (key % (2 * NUM_THREADS)) >= NUM_THREADS;
+        assert(skip_list_search(handle, key) == expected);
+    }
+    assert(skip_list_size(list) == 50000);
+    printf("✓ Every thread's inserts and deletes took effect\n");
+
+    skip_list_detach(handle);
+    destroy_skip_list(list);
+}
+
+int main() {
+    printf("=== Skip List Test Suite ===\n\n");
+
+    test_single_thread();
+    test_handles();
+    test_concurrent_mixed();
+    test_concurrent_disjoint();
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include "include/c_small_vector.h"
+#include <assert.h>
+#include <stdio.h>
+
+void test_inline_storage() {
+    printf("Testing inline storage...\n");
+
+    SmallVector vec;
+    init_small_vector(&vec);
+    assert(small_current_size(&vec) == 0);
+    assert(small_current_capacity(&vec) == SMALL_VECTOR_INLINE_CAPACITY);
+
+    for (int i = 0; i < SMALL_VECTOR_INLINE_CAPACITY; i++) {
+        assert(small_add_at_end(&vec, i * 10) == 1);
+    }
+    assert(vec.heap == NULL); // Still no allocation
+    assert(small_isFull(&vec) == 1);
+    assert(small_get_value_at_index(&vec, 3) == 30);
+    printf("✓ First %d elements stay inline\n", SMALL_VECTOR_INLINE_CAPACITY);
+
+    free_small_vector(&vec);
+}
+
+void test_spill_to_heap() {
+    printf("\nTesting spill to heap...\n");
+
+    SmallVector vec;
+    init_small_vector(&vec);
+    int n = SMALL_VECTOR_INLINE_CAPACITY * 3 + 1;
+    for (int i = 0; i < n; i++) small_add_at_end(&vec, i);
+
+    assert(vec.heap != NULL);
+    assert(small_current_size(&vec) == n);
+    assert(small_current_capacity(&vec) >= n);
+    for (int i = 0; i < n; i++) assert(small_get_value_at_index(&vec, i) == i);
+    printf("✓ Elements survive the move from inline storage to the heap\n");
+
+    assert(small_remove_at_end(&vec) == n - 1);
+    assert(small_current_size(&vec) == n - 1);
+    printf("✓ Remove works after spilling\n");
+
+    free_small_vector(&vec);
+    assert(vec.heap == NULL && small_current_size(&vec) == 0);
+}
+
+void test_create_and_set() {
+    printf("\nTesting create_small_vector and small_set_at_index...\n");
+
+    assert(create_small_vector(0) == NULL);
+
+    SmallVector *vec = create_small_vector(4);
+    assert(vec != NULL && vec->heap == NULL);
+
+    small_add_at_end(vec, 1);
+    small_add_at_end(vec, 2);
+    small_add_at_end(vec, 3);
+
+    // Insert shifts right, like set_at_index
+    assert(small_set_at_index(vec, 1, 99) == vec);
+    assert(small_get_value_at_index(vec, 0) == 1);
+    assert(small_get_value_at_index(vec, 1) == 99);
+    assert(small_get_value_at_index(vec, 2) == 2);
+    assert(small_current_size(vec) == 4);
+
+    // Index beyond size fills the gap with zeros and spills
+    small_set_at_index(vec, SMALL_VECTOR_INLINE_CAPACITY + 5, 7);
+    assert(small_get_value_at_index(vec, 10) == 0);
+    assert(small_get_value_at_index(vec, SMALL_VECTOR_INLINE_CAPACITY + 5) == 7);
+    assert(small_current_size(vec) == SMALL_VECTOR_INLINE_CAPACITY + 6);
+    printf("✓ set_at_index semantics preserved across the spill\n");
+
+    destroy_small_vector(vec);
+
+    SmallVector *large = create_small_vector(SMALL_VECTOR_INLINE_CAPACITY * 2);
+    assert(large->heap != NULL);
+    assert(small_current_capacity(large) == SMALL_VECTOR_INLINE_CAPACITY * 2);
+    destroy_small_vector(large);
+    printf("✓ Large initial capacity allocates heap storage up front\n");
+}
+
+int main() {
+    printf("=== Small Vector Test Suite ===\n\n");
+
+    test_inline_storage();
+    test_spill_to_heap();
+    test_create_and_set();
+
+    printf("\n=== All tests passed! ===\n");
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+#include "include/treap.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+
+// Checks key order, heap order on priorities and stored sizes; returns the node count
+int check_treap(TreapNode *root, long long low, long long high) {
+    if (root == NULL) return 0;
+    assert(root->key > low && root->key < high);
+    if (root->left) assert(root->left->priority <= root->priority);
+    if (root->right) assert(root->right->priority <= root->priority);
+
+    int count = 1 + check_treap(root->left, low, root->key) + check_treap(root->right, root->key, high);
+    assert(root->size == count);
+    return count;
+}
+
+int check_all(TreapNode *root) {
+    return check_treap(root, -2147483649LL, 2147483648LL);
+}
+
+// Collects keys in order; returns the next free index
+int collect(TreapNode *root, int *out, int count) {
+    if (root == NULL) return count;
+    count = collect(root->left, out, count);
+    out[count++] = root->key;
+    return collect(root->right, out, count);
+}
+
+TreapNode *build_range(int start, int end, int step) {
+    TreapNode *root = NULL;
+    for (int key = start; key < end; key += step) assert(treap_insert(&root, key) == 1);
+    return root;
+}
+
+void test_insert_search_delete() {
+    printf("Testing treap_insert, treap_search and treap_delete...\n");
+
+    TreapNode *root = NULL;
+    assert(treap_insert(&root, 50) == 1);
+    assert(treap_insert(&root, 30) == 1);
+    assert(treap_insert(&root, 70) == 1);
+    assert(treap_insert(&root, 30) == 0);
+    assert(treap_size(root) == 3);
+    assert(treap_search(root, 30) != NULL && treap_search(root, 30)->key == 30);
+    assert(treap_search(root, 40) == NULL);
+    printf("✓ Insert and search work, duplicates are rejected\n");
+
+    assert(treap_delete(&root, 30) == 1);
+    assert(treap_delete(&root, 30) == 0);
+    assert(treap_search(root, 30) == NULL && treap_size(root) == 2);
+    printf("✓ Delete removes keys\n");
+
+    destroy_treap(root);
+
+    // Sorted inserts stay balanced because priorities come from a hash of the key
+    root = build_range(0, 100000, 1);
+    assert(check_all(root) == 100000);
+    for (int key = 0; key < 100000; key += 2) assert(treap_delete(&root, key) == 1);
+    assert(check_all(root) == 50000);
+    printf("✓ 100000 sorted inserts keep the treap invariants\n");
+
+    destroy_treap(root);
+}
+
+void test_split_and_join() {
+    printf("\nTesting treap_split and treap_join...\n");
+
+    TreapNode *root = build_range(0, 1000, 1);
+    TreapNode *less, *greater;
+    TreapNode *match = treap_split(root, 500, &less, &greater);
+    assert(match != NULL && match->key == 500 && match->size == 1);
+    assert(check_treap(less, -1, 500) == 500);
+    assert(check_treap(greater, 500, 1000) == 499);
+
+    root = treap_join(less, greater);
+    assert(check_all(root) == 999 && treap_search(root, 500) == NULL);
+    free(match);
+    printf("✓ Split detaches the key and join restores the rest\n");
+
+    match = treap_split(root, 500, &less, &greater);
+    assert(match == NULL);
+    assert(treap_size(less) == 500 && treap_size(greater) == 499);
+    root = treap_join(less, greater);
+    assert(check_all(root) == 999);
+    printf("✓ Splitting on a missing key keeps every node\n");
+
+    destroy_treap(root);
+}
+
+void test_set_operations(int threads) {
+    printf("\nTesting set operations with %d thread(s)...\n", threads);
+
+    int *keys = malloc(sizeof(int) * 300000);
+
+    // Multiples of 2 in [0, 200000) and multiples of 3 in [0, 300000)
+    TreapNode *result = treap_union(build_range(0, 200000, 2), build_range(0, 300000, 3), threads);
+    int count = collect(result, keys, 0);
+    assert(check_all(result) == count);
+    int expected = 0;
+    for (int k = 0; k < 300000; k++) {
+        if ((k < 200000 && k % 2 == 0) || k % 3 == 0) assert(keys[expected++] == k);
+    }
+    assert(count == expected);
+    destroy_treap(result);
+    printf("✓ Union holds every key of either set\n");
+
+    result = treap_intersection(build_range(0, 200000, 2), build_range(0, 300000, 3), threads);
+    count = collect(result, keys, 0);
+    assert(check_all(result) == count);
+    expected = 0;
+    for (int k = 0; k < 200000; k += 6) assert(keys[expected++] == k);
+    assert(count == expected);
+    destroy_treap(result);
+    printf("✓ Intersection holds only shared keys\n");
+
+    result = treap_difference(build_range(0, 200000, 2), build_range(0, 300000, 3), threads);
+    count = collect(result, keys, 0);
+    assert(check_all(result) == count);
+    expected = 0;
+    for (int k = 0; k < 200000; k += 2) {
+        if (k % 3 != 0) assert(keys[expected++] == k);
+    }
+    assert(count == expected);
+    destroy_treap(result);
+    printf("✓ Difference removes keys of the second set\n");
+
+    // Empty operands
+    assert(treap_union(NULL, NULL, threads) == NULL);
+    assert(treap_intersection(build_range(0, 10, 1), NULL, threads) == NULL);
+    result = treap_difference(build_range(0, 10, 1), NULL, threads);
+    assert(check_all(result) == 10);
+    destroy_treap(result);
+    assert(treap_difference(NULL, build_range(0, 10, 1), threads) == NULL);
+    printf("✓ Empty operands are handled\n");
+
+    free(keys);
+}
+
+void test_batches() {
+    printf("\nTesting treap_insert_batch and treap_delete_batch...\n");
+
+    srand(43);
+    int n = 200000;
+    int *batch = malloc(sizeof(int) * n);
+    char *present = calloc(1 << 20, 1);
+    for (int i = 0; i < n; i++) {
+        batch[i] = rand() % (1 << 20) - (1 << 19);
+        present[batch[i] + (1 << 19)] = 1;
+    }
+
+    TreapNode *root = NULL;
+    assert(treap_insert_batch(&root, batch, n, 4) == 1);
+    int expected = 0;
+    for (int i = 0; i < (1 << 20); i++) expected += present[i];
+    assert(check_all(root) == expected);
+
+    // Inserting the same batch again changes nothing
+    assert(treap_insert_batch(&root, batch, n, 4) == 1);
+    assert(check_all(root) == expected);
+    printf("✓ Unsorted batch with duplicates inserts each key once\n");
+
+    assert(treap_delete_batch(&root, batch, n / 2, 4) == 1);
+    for (int i = 0; i < n / 2; i++) present[batch[i] + (1 << 19)] = 0;
+    expected = 0;
+    for (int i = 0; i < (1 << 20); i++) {
+        expected += present[i];
+        if (i % 97 == 0) assert((treap_search(root, i - (1 << 19)) != NULL) == present[i]);
+    }
+    assert(check_all(root) == expected);
+    printf("✓ Batch delete removes exactly the batch keys\n");
+
+    assert(treap_insert_batch(&root, NULL, 0, 1) == 1);
+    assert(treap_insert_batch(NULL, batch, 1, 1) == -1);
+    assert(treap_delete_batch(&root, NULL, 5, 1) == -1);
+    printf("✓ Invalid input is rejected\n");
+
+    destroy_treap(root);
+    free(batch);
+    free(present);
+}
+
+int main() {
+    printf("=== Treap Test Suite ===\n\n");
+
+    test_insert_search_delete();
+    test_split_and_join();
+    test_set_operations(1);
+    test_set_operations(4);
+    test_batches();
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
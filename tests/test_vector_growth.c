@@ -0,0 +1,99 @@
+#include "include/c_vector.h"
+#include <assert.h>
+#include <stdio.h>
+
+void test_default_doubling() {
+    printf("Testing default growth...\n");
+
+    Vector *vec = create_vector(2);
+    assert(vec->growth == VECTOR_GROWTH_DOUBLE);
+    for (int i = 0; i < 3; i++) add_at_end(vec, i);
+    assert(current_capacity(vec) == 4);
+    printf("✓ Vectors double by default\n");
+
+    destroy_vector(vec);
+}
+
+void test_one_and_half() {
+    printf("\nTesting 1.5x growth...\n");
+
+    Vector *vec = create_vector(10);
+    assert(vector_set_growth(vec, VECTOR_GROWTH_ONE_AND_HALF) == 1);
+    for (int i = 0; i < 11; i++) add_at_end(vec, i);
+    assert(current_capacity(vec) == 16);
+
+    for (int i = 11; i < 1000; i++) add_at_end(vec, i);
+    for (int i = 0; i < 1000; i++) assert(get_value_at_index(vec, i) == i);
+    assert(current_capacity(vec) < 1500);
+    printf("✓ 1.5x growth keeps capacity within 50%% of size\n");
+
+    assert(vector_set_growth(vec, (VectorGrowth)42) == -1);
+    assert(vector_set_growth(NULL, VECTOR_GROWTH_DOUBLE) == -1);
+    destroy_vector(vec);
+}
+
+void test_size_class() {
+    printf("\nTesting size-class growth...\n");
+
+    Vector *vec = create_vector(1);
+    vector_set_growth(vec, VECTOR_GROWTH_SIZE_CLASS);
+    int previous = current_capacity(vec);
+    for (int i = 0; i < 100000; i++) {
+        add_at_end(vec, i);
+        int capacity = current_capacity(vec);
+        if (capacity != previous) {
+            // Byte sizes land on one of four classes per power of two
+            long long bytes = (long long)capacity * sizeof(int);
+            long long power = 1;
+            while (power * 2 <= bytes) power *= 2;
+            assert(bytes % (power / 4 > 0 ? power / 4 : 1) == 0);
+            previous = capacity;
+        }
+    }
+    for (int i = 0; i < 100000; i++) assert(get_value_at_index(vec, i) == i);
+    printf("✓ Size-class growth rounds capacities to allocator classes\n");
+
+    destroy_vector(vec);
+}
+
+void test_mapped_growth() {
+    printf("\nTesting mapped growth for large buffers...\n");
+
+    int n = (VECTOR_MMAP_THRESHOLD / (int)sizeof(int)) * 2 + 17;
+    Vector *vec = create_vector(1024);
+    vector_set_growth(vec, VECTOR_GROWTH_ONE_AND_HALF);
+    vector_use_huge_pages(vec, 1);
+    for (int i = 0; i < n; i++) assert(add_at_end(vec, i) == 1);
+
+#ifdef __linux__
+    assert(vec->flags & VECTOR_FLAG_MAPPED);
+#endif
+    for (int i = 0; i < n; i += 101) assert(get_value_at_index(vec, i) == i);
+    assert(get_value_at_index(vec, n - 1) == n - 1);
+    printf("✓ Buffers above the threshold move to mremap-grown mappings\n");
+
+    // set_at_index beyond capacity also grows through the mapping
+    assert(set_at_index(vec, current_capacity(vec) + 10, 5) != NULL);
+    assert(get_value_at_index(vec, current_size(vec) - 1) == 5);
+    destroy_vector(vec);
+
+    Vector *large = create_vector(VECTOR_MMAP_THRESHOLD / (int)sizeof(int));
+#ifdef __linux__
+    assert(large->flags & VECTOR_FLAG_MAPPED);
+#endif
+    destroy_vector(large);
+    printf("✓ Large initial capacities start out mapped\n");
+}
+
+int main() {
+    printf("=== Vector Growth Test Suite ===\n\n");
+
+    test_default_doubling();
+    test_one_and_half();
+    test_size_class();
+    test_mapped_growth();
+
+    printf("\n=== All tests passed! ===\n");
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include "include/c_vector_simd.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Builds a vector with pseudo-random values in [-range, range]
+Vector *random_vector(int n, int range) {
+    Vector *vec = create_vector(n > 0 ? n : 1);
+    for (int i = 0; i < n; i++) {
+        add_at_end(vec, rand() % (2 * range + 1) - range);
+    }
+    return vec;
+}
+
+void test_sum() {
+    printf("Testing vector_sum...\n");
+
+    // Sizes around the 4/8 lane widths exercise the scalar tails
+    for (int n = 0; n < 40; n++) {
+        Vector *vec = random_vector(n, 1000);
+        long long expected = 0;
+        for (int i = 0; i < n; i++) expected += vec->collection[i];
+        assert(vector_sum(vec) == expected);
+        destroy_vector(vec);
+    }
+
+    // Large values must not overflow 32-bit lanes
+    Vector *big = create_vector(16);
+    for (int i = 0; i < 16; i++) add_at_end(big, 2000000000);
+    assert(vector_sum(big) == 32000000000LL);
+    destroy_vector(big);
+
+    assert(vector_sum(NULL) == 0);
+    printf("✓ vector_sum matches scalar sum\n");
+}
+
+void test_min_max() {
+    printf("\nTesting vector_min_max...\n");
+
+    for (int n = 1; n < 40; n++) {
+        Vector *vec = random_vector(n, 1000);
+        int expected_min = vec->collection[0], expected_max = vec->collection[0];
+        for (int i = 1; i < n; i++) {
+            if (vec->collection[i] < expected_min) expected_min = vec->collection[i];
+            if (vec->collection[i] > expected_max) expected_max = vec->collection[i];
+        }
+        int min = 0, max = 0;
+        assert(vector_min_max(vec, &min, &max) == 1);
+        assert(min == expected_min && max == expected_max);
+        destroy_vector(vec);
+    }
+
+    Vector *empty = create_vector(1);
+    int min, max;
+    assert(vector_min_max(empty, &min, &max) == -1);
+    destroy_vector(empty);
+    printf("✓ vector_min_max matches scalar min/max\n");
+}
+
+void test_find_and_count() {
+    printf("\nTesting vector_find and vector_count_eq...\n");
+
+    for (int n = 0; n < 40; n++) {
+        Vector *vec = random_vector(n, 5);
+        for (int value = -6; value <= 6; value++) {
+            int first = -1, count = 0;
+            for (int i = 0; i < n; i++) {
+                if (vec->collection[i] == value) {
+                    if (first == -1) first = i;
+                    count++;
+                }
+            }
+            assert(vector_find(vec, value) == first);
+            assert(vector_count_eq(vec, value) == count);
+        }
+        destroy_vector(vec);
+    }
+
+    assert(vector_find(NULL, 1) == -1);
+    assert(vector_count_eq(NULL, 1) == -1);
+    printf("✓ vector_find and vector_count_eq match scalar scans\n");
+}
+
+void test_filter() {
+    printf("\nTesting vector_filter...\n");
+
+    for (int n = 0; n < 40; n++) {
+        Vector *vec = random_vector(n, 50);
+        Vector *filtered = vector_filter(vec, -10, 20);
+        assert(filtered != NULL);
+
+        int k = 0;
+        for (int i = 0; i < n; i++) {
+            int v = vec->collection[i];
+            if (v >= -10 && v <= 20) {
+                assert(k < filtered->size && filtered->collection[k] == v);
+                k++;
+            }
+        }
+        assert(k == filtered->size);
+
+        destroy_vector(filtered);
+        destroy_vector(vec);
+    }
+
+    assert(vector_filter(NULL, 0, 1) == NULL);
+    printf("✓ vector_filter keeps matching elements in order\n");
+}
+
+int main() {
+    printf("=== Vector SIMD Test Suite (backend: %s) ===\n\n", vector_simd_backend());
+
+    srand(42);
+    test_sum();
+    test_min_max();
+    test_find_and_count();
+    test_filter();
+
+    printf("\n=== All tests passed! ===\n");
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include "include/c_vector_sort.h"
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Reference ordering checked against qsort
+int qsort_compare(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+int descending(int a, int b) {
+    return (a < b) - (a > b);
+}
+
+// Fills data with one of several input shapes
+void fill(int *data, int n, int shape) {
+    for (int i = 0; i < n; i++) {
+        switch (shape) {
+        case 0: data[i] = rand() - RAND_MAX / 2; break;     // random, both signs
+        case 1: data[i] = i; break;                        // sorted
+        case 2: data[i] = n - i; break;                    // reverse sorted
+        case 3: data[i] = rand() % 4; break;               // heavy duplicates
+        default: data[i] = (i % 2) ? INT_MIN : INT_MAX;    // extremes
+        }
+    }
+}
+
+void check_sorter(const char *name, int (*sorter)(int *, int)) {
+    int sizes[] = {0, 1, 2, 15, 17, 100, 5000, 100000};
+    for (int s = 0; s < 8; s++) {
+        int n = sizes[s];
+        for (int shape = 0; shape < 5; shape++) {
+            int *data = malloc(sizeof(int) * (n + 1));
+            int *expected = malloc(sizeof(int) * (n + 1));
+            fill(data, n, shape);
+            memcpy(expected, data, sizeof(int) * n);
+            qsort(expected, n, sizeof(int), qsort_compare);
+
+            assert(sorter(data, n) == 1);
+            assert(memcmp(data, expected, sizeof(int) * n) == 0);
+            free(data);
+            free(expected);
+        }
+    }
+    printf("✓ %s matches qsort on all input shapes\n", name);
+}
+
+int run_introsort(int *data, int n) {
+    introsort_ints(data, n, NULL);
+    return 1;
+}
+
+int run_parallel_sort(int *data, int n) {
+    return parallel_merge_sort_ints(data, n, 4);
+}
+
+void test_sorters() {
+    printf("Testing raw array sorts...\n");
+    check_sorter("radix_sort_ints", radix_sort_ints);
+    check_sorter("introsort_ints", run_introsort);
+    check_sorter("parallel_merge_sort_ints", run_parallel_sort);
+}
+
+void test_vector_sorts() {
+    printf("\nTesting Vector sorts...\n");
+
+    Vector *vec = create_vector(4);
+    int values[] = {5, -3, 9, 0, 9, -7, 2};
+    for (int i = 0; i < 7; i++) add_at_end(vec, values[i]);
+
+    assert(vector_introsort(vec, descending) == 1);
+    for (int i = 1; i < current_size(vec); i++) {
+        assert(get_value_at_index(vec, i - 1) >= get_value_at_index(vec, i));
+    }
+    printf("✓ vector_introsort honours a custom comparator\n");
+
+    assert(vector_radix_sort(vec) == 1);
+    for (int i = 1; i < current_size(vec); i++) {
+        assert(get_value_at_index(vec, i - 1) <= get_value_at_index(vec, i));
+    }
+    printf("✓ vector_radix_sort sorts ascending\n");
+
+    assert(vector_parallel_merge_sort(vec, 0) == 1);
+    assert(vector_radix_sort(NULL) == -1);
+    destroy_vector(vec);
+}
+
+void test_argsort() {
+    printf("\nTesting argsort...\n");
+
+    Vector *vec = create_vector(8);
+    int values[] = {30, 10, 20, 10, -5, 30};
+    for (int i = 0; i < 6; i++) add_at_end(vec, values[i]);
+
+    int *perm = vector_argsort(vec);
+    assert(perm != NULL);
+    int expected[] = {4, 1, 3, 2, 0, 5}; // stable: equal keys keep input order
+    for (int i = 0; i < 6; i++) assert(perm[i] == expected[i]);
+    assert(get_value_at_index(vec, 0) == 30); // input untouched
+    printf("✓ vector_argsort returns a stable permutation\n");
+
+    free(perm);
+    destroy_vector(vec);
+}
+
+int main() {
+    printf("=== Vector Sort Test Suite ===\n\n");
+
+    srand(7);
+    test_sorters();
+    test_vector_sorts();
+    test_argsort();
+
+    printf("\n=== All tests passed! ===\n");
+
+    return 0;
+}